@@ -39,7 +39,9 @@ public:
         // reserve [100, 199], assuming there won't be more than 100
         // links between any two nodes.
         PATCH_LINK = 100,
-        PARALLEL_MEMORY_WRITER = 200
+        PARALLEL_MEMORY_WRITER = 200,
+        COLLECTING_WRITER = 300,
+        PARALLEL_SILO_WRITER = 400
     };
 
     typedef std::map<int, std::vector<MPI_Request> > RequestsMap;
@@ -211,6 +213,37 @@ public:
         return ret;
     }
 
+    /**
+     * Returns for each rank the ID of the shared memory node (i.e.
+     * the physical machine) it's running on. Nodes are numbered in
+     * ascending order of their lowest rank. This is a collective
+     * operation.
+     */
+    std::vector<std::size_t> nodeIDs() const
+    {
+        MPI_Comm nodeComm;
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank(), MPI_INFO_NULL, &nodeComm);
+
+        // the lowest rank on each node acts as its representative:
+        int leader = rank();
+        MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+        MPI_Comm_free(&nodeComm);
+
+        std::vector<int> leaders = allGather(leader);
+        std::map<int, std::size_t> leaderToNode;
+        std::vector<std::size_t> ret;
+        ret.reserve(leaders.size());
+        for (std::vector<int>::iterator i = leaders.begin(); i != leaders.end(); ++i) {
+            if (leaderToNode.count(*i) == 0) {
+                std::size_t newID = leaderToNode.size();
+                leaderToNode[*i] = newID;
+            }
+            ret << leaderToNode[*i];
+        }
+
+        return ret;
+    }
+
     template<typename T>
     void sendVec(
         const std::vector<T> *vec,
@@ -378,7 +411,46 @@ public:
             comm);
     }
 
-    // fixme: add mpi_allreduce for minighost, add global reduction api for production code
+    /**
+     * Element-wise reduction of num items from all ranks via op (e.g.
+     * MPI_SUM, MPI_MIN, MPI_MAX). The result is only valid on root.
+     */
+    template<typename T>
+    inline void reduce(
+        const T *source,
+        T *target,
+        int num,
+        MPI_Op op,
+        int root,
+        const MPI_Datatype& datatype = Typemaps::lookup<T>()) const
+    {
+        MPI_Reduce(const_cast<T*>(source), target, num, datatype, op, root, comm);
+    }
+
+    /**
+     * Same as reduce(), but the result is available on all ranks.
+     */
+    template<typename T>
+    inline void allReduce(
+        const T *source,
+        T *target,
+        int num,
+        MPI_Op op,
+        const MPI_Datatype& datatype = Typemaps::lookup<T>()) const
+    {
+        MPI_Allreduce(const_cast<T*>(source), target, num, datatype, op, comm);
+    }
+
+    template<typename T>
+    inline T allReduce(
+        const T& item,
+        MPI_Op op,
+        const MPI_Datatype& datatype = Typemaps::lookup<T>()) const
+    {
+        T ret;
+        allReduce(&item, &ret, 1, op, datatype);
+        return ret;
+    }
 
     template<typename T>
     inline std::vector<T> gather(
@@ -274,7 +274,7 @@ public:
 
         void recvSecondPart(APITraits::FalseType)
         {
-            buffer.resize(dataSize);
+            SerializationBufferHelpers::resizeBuffer(&buffer, dataSize);
             mpiLayer.recv(&buffer[0], source, dataSize, tag, cellMPIDatatype);
             wait();
         }
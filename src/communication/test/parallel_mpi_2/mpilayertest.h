@@ -67,6 +67,27 @@ public:
         }
     }
 
+    void testReduce()
+    {
+        MPILayer layer;
+        int root = layer.size() - 1;
+        double source[] = { 1.0 * layer.rank(), -1.0 * layer.rank() };
+        double target[] = { 0, 0 };
+
+        layer.reduce(source, target, 2, MPI_SUM, root);
+        if (layer.rank() == root) {
+            double sum = layer.size() * (layer.size() - 1) / 2;
+            TS_ASSERT_EQUALS( sum, target[0]);
+            TS_ASSERT_EQUALS(-sum, target[1]);
+        }
+
+        layer.allReduce(source, target, 2, MPI_MAX);
+        TS_ASSERT_EQUALS(layer.size() - 1.0, target[0]);
+        TS_ASSERT_EQUALS(0.0,                target[1]);
+
+        TS_ASSERT_EQUALS(0, layer.allReduce(layer.rank(), MPI_MIN));
+    }
+
     void testBroadcast()
     {
         MPILayer layer;
@@ -246,6 +267,19 @@ public:
             layer.cancelAll();
         }
     }
+
+    void testNodeIDs()
+    {
+        MPILayer layer;
+        std::vector<std::size_t> nodeIDs = layer.nodeIDs();
+        TS_ASSERT_EQUALS(std::size_t(layer.size()), nodeIDs.size());
+        // the lowest rank always defines the first node:
+        TS_ASSERT_EQUALS(std::size_t(0), nodeIDs[0]);
+
+        // all ranks need to agree on the mapping:
+        std::vector<std::size_t> masterIDs = layer.broadcastVector(nodeIDs, 0);
+        TS_ASSERT_EQUALS(masterIDs, nodeIDs);
+    }
 };
 
 }
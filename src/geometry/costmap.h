@@ -0,0 +1,203 @@
+#ifndef LIBGEODECOMP_GEOMETRY_COSTMAP_H
+#define LIBGEODECOMP_GEOMETRY_COSTMAP_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/streak.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A CostMap stores the estimated computational cost of the cells
+ * within a simulation domain. Partitions can use it to cut the
+ * domain by cumulative cost instead of by cell count, which is
+ * useful if a model contains cheap (e.g. inactive) regions.
+ *
+ * To keep the memory footprint small, costs may be stored at a
+ * coarser resolution: each entry then represents a block of
+ * blockDim cells, all of which are assumed to have the same cost.
+ */
+template<int DIM>
+class CostMap
+{
+public:
+    explicit CostMap(
+        const CoordBox<DIM>& box = CoordBox<DIM>(),
+        const Coord<DIM>& blockDim = Coord<DIM>::diagonal(1),
+        const double defaultCost = 1.0) :
+        box(box),
+        blockDim(blockDim)
+    {
+        for (int i = 0; i < DIM; ++i) {
+            if (blockDim[i] <= 0) {
+                throw std::invalid_argument("CostMap block dimensions need to be positive");
+            }
+            blocks[i] = (box.dimensions[i] + blockDim[i] - 1) / blockDim[i];
+        }
+
+        costs = std::vector<double>(blocks.prod(), defaultCost);
+    }
+
+    /**
+     * returns the cost of a single cell
+     */
+    inline double operator[](const Coord<DIM>& cell) const
+    {
+        return costs[index(cell)];
+    }
+
+    /**
+     * sets the cost of all cells in the block containing cell.
+     */
+    inline void set(const Coord<DIM>& cell, const double cost)
+    {
+        costs[index(cell)] = cost;
+    }
+
+    inline void set(const Streak<DIM>& streak, const double cost)
+    {
+        Coord<DIM> cursor = streak.origin;
+        for (; cursor.x() < streak.endX; ++cursor.x()) {
+            set(cursor, cost);
+        }
+    }
+
+    /**
+     * Derives the costs by evaluating function for each cell of the
+     * grid, e.g. to sample them from an Initializer. Costs of cells
+     * within one block are averaged.
+     */
+    template<typename GRID_TYPE, typename COST_FUNCTION>
+    void sample(const GRID_TYPE& grid, COST_FUNCTION function)
+    {
+        std::vector<double> sums(costs.size(), 0);
+        std::vector<double> counts(costs.size(), 0);
+        Region<DIM> region;
+        region << box;
+
+        accumulate(grid, region, function, &sums, &counts);
+        setAverages(sums, counts);
+    }
+
+    /**
+     * First half of sample(): adds up the costs of the cells within
+     * region (and the CostMap's bounding box) per block. This is
+     * useful for distributed grids: each process accumulates its own
+     * region, the sums and counts are then reduced, e.g. via
+     * MPI_Allreduce(), and finally passed to setAverages().
+     */
+    template<typename GRID_TYPE, typename COST_FUNCTION>
+    void accumulate(
+        const GRID_TYPE& grid,
+        const Region<DIM>& region,
+        COST_FUNCTION function,
+        std::vector<double> *sums,
+        std::vector<double> *counts) const
+    {
+        Region<DIM> boxRegion;
+        boxRegion << box;
+        Region<DIM> clipped = region & boxRegion;
+
+        std::vector<typename GRID_TYPE::CellType> buffer;
+        for (typename Region<DIM>::StreakIterator i = clipped.beginStreak(); i != clipped.endStreak(); ++i) {
+            Streak<DIM> streak = *i;
+            buffer.resize(streak.length());
+            grid.get(streak, &buffer[0]);
+
+            Coord<DIM> cursor = streak.origin;
+            for (std::size_t j = 0; j < buffer.size(); ++j, ++cursor.x()) {
+                std::size_t block = index(cursor);
+                (*sums)[block] += function(buffer[j]);
+                (*counts)[block] += 1;
+            }
+        }
+    }
+
+    /**
+     * Sets each block's cost to the average sum/count. Blocks without
+     * any samples retain their cost.
+     */
+    void setAverages(const std::vector<double>& sums, const std::vector<double>& counts)
+    {
+        for (std::size_t i = 0; i < costs.size(); ++i) {
+            if (counts[i] > 0) {
+                costs[i] = sums[i] / counts[i];
+            }
+        }
+    }
+
+    /**
+     * total cost of all cells within the intersection of subBox and
+     * the CostMap's bounding box.
+     */
+    double sum(const CoordBox<DIM>& subBox) const
+    {
+        double ret = 0;
+        for (typename CoordBox<DIM>::Iterator i = subBox.begin(); i != subBox.end(); ++i) {
+            if (box.inBounds(*i)) {
+                ret += (*this)[*i];
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * Sums up the costs of all cells within subBox which share the
+     * same coordinate along the given dimension, i.e. the projection
+     * of the costs onto that axis.
+     */
+    std::vector<double> marginal(const CoordBox<DIM>& subBox, const int dim) const
+    {
+        std::vector<double> ret(subBox.dimensions[dim], 0);
+        for (typename CoordBox<DIM>::Iterator i = subBox.begin(); i != subBox.end(); ++i) {
+            if (box.inBounds(*i)) {
+                ret[(*i)[dim] - subBox.origin[dim]] += (*this)[*i];
+            }
+        }
+
+        return ret;
+    }
+
+    inline const CoordBox<DIM>& boundingBox() const
+    {
+        return box;
+    }
+
+    inline const Coord<DIM>& getBlockDim() const
+    {
+        return blockDim;
+    }
+
+    /**
+     * number of blocks along each axis
+     */
+    inline const Coord<DIM>& getNumBlocks() const
+    {
+        return blocks;
+    }
+
+private:
+    CoordBox<DIM> box;
+    Coord<DIM> blockDim;
+    Coord<DIM> blocks;
+    std::vector<double> costs;
+
+    inline std::size_t index(const Coord<DIM>& cell) const
+    {
+        Coord<DIM> relativeCoord = cell - box.origin;
+        Coord<DIM> blockCoord;
+        for (int i = 0; i < DIM; ++i) {
+            blockCoord[i] = relativeCoord[i] / blockDim[i];
+        }
+
+        return blockCoord.toIndex(blocks);
+    }
+};
+
+}
+
+#endif
@@ -22,31 +22,155 @@ public:
         dimensions(dimensions)
     {
         nodeGridDim = getNodeGridDim(weights.size());
+
+        for (int i = 0; i < DIM; ++i) {
+            cuts[i].resize(nodeGridDim[i] + 1);
+            for (int j = 0; j <= nodeGridDim[i]; ++j) {
+                cuts[i][j] = j * dimensions[i] / nodeGridDim[i];
+            }
+        }
     }
 
     Region<DIM> getRegion(const std::size_t node) const
     {
-        Coord<DIM> logicalCoord(node % nodeGridDim.x(),
-                               (node % (nodeGridDim.x() * nodeGridDim.y()))/ nodeGridDim.x());
-        if (DIM > 2){
-            logicalCoord[2] = node / (nodeGridDim.x() * nodeGridDim.y());
+        Region<DIM> r;
+        if (!costBoxes.empty()) {
+            r << costBoxes[node];
+            return r;
         }
 
+        Coord<DIM> logicalCoord = getLogicalCoord(node);
         Coord<DIM> realStart;
         Coord<DIM> realEnd;
         for(int i = 0; i < DIM; ++i){
-            realStart[i] = logicalCoord[i] * dimensions[i] / nodeGridDim[i];
-            realEnd[i] = (logicalCoord[i]+1) * dimensions[i] / nodeGridDim[i];
+            realStart[i] = cuts[i][logicalCoord[i] + 0];
+            realEnd[i]   = cuts[i][logicalCoord[i] + 1];
         }
-        Region<DIM> r;
         r << CoordBox<DIM>(origin + realStart, realEnd - realStart);
         return r;
     }
 
+    /**
+     * Cuts the domain so that each node receives the share of the
+     * total cost given by its weight. Global cut planes can't
+     * achieve this for arbitrary cost distributions, so the cuts are
+     * nested instead: the domain is first cut into slabs along the
+     * last axis, each slab is then cut independently along the next
+     * axis and so on. Nodes retain their position in the node grid.
+     */
+    void setCostMap(const CostMap<DIM>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        costBoxes.resize(weights.size());
+        cutSlabs(costs, CoordBox<DIM>(origin, dimensions), DIM - 1, Coord<DIM>());
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
 private:
     Coord<DIM> origin;
     Coord<DIM> dimensions;
     Coord<DIM> nodeGridDim;
+    std::vector<int> cuts[DIM];
+    std::vector<CoordBox<DIM> > costBoxes;
+
+    Coord<DIM> getLogicalCoord(const std::size_t node) const
+    {
+        Coord<DIM> ret(node % nodeGridDim.x(),
+                       (node % (nodeGridDim.x() * nodeGridDim.y()))/ nodeGridDim.x());
+        if (DIM > 2){
+            ret[2] = node / (nodeGridDim.x() * nodeGridDim.y());
+        }
+
+        return ret;
+    }
+
+    /**
+     * Splits box along the given axis among the slabs of nodes whose
+     * logical coordinates on all higher axes match logicalCoord.
+     */
+    void cutSlabs(const CostMap<DIM>& costs, const CoordBox<DIM>& box, int axis, Coord<DIM> logicalCoord)
+    {
+        // these nodes form a contiguous range of IDs:
+        std::size_t stride = 1;
+        for (int i = 0; i < axis; ++i) {
+            stride *= nodeGridDim[i];
+        }
+        std::size_t begin = logicalCoord.toIndex(nodeGridDim);
+        std::vector<double> slabWeights(nodeGridDim[axis], 0);
+        for (std::size_t node = begin; node < (begin + stride * nodeGridDim[axis]); ++node) {
+            slabWeights[(node - begin) / stride] += weights[node];
+        }
+
+        std::vector<int> slabCuts = costCuts(costs.marginal(box, axis), slabWeights);
+        for (int j = 0; j < nodeGridDim[axis]; ++j) {
+            CoordBox<DIM> slab = box;
+            slab.origin[axis] += slabCuts[j];
+            slab.dimensions[axis] = slabCuts[j + 1] - slabCuts[j];
+            logicalCoord[axis] = j;
+
+            if (axis == 0) {
+                costBoxes[logicalCoord.toIndex(nodeGridDim)] = slab;
+            } else {
+                cutSlabs(costs, slab, axis - 1, logicalCoord);
+            }
+        }
+    }
+
+    /**
+     * returns the offsets at which the slices need to be cut so that
+     * each part receives the share of the total cost given by its
+     * weight. Parts with a non-zero weight receive at least one
+     * slice, as long as there are enough of them.
+     */
+    static std::vector<int> costCuts(const std::vector<double>& sliceCosts, const std::vector<double>& partWeights)
+    {
+        int numSlices = sliceCosts.size();
+        int numParts = partWeights.size();
+        double totalCost = sum(sliceCosts);
+        double totalWeight = sum(partWeights);
+
+        std::vector<int> ret(numParts + 1, 0);
+        ret[numParts] = numSlices;
+        double prefix = 0;
+        double prefixWeight = 0;
+        int slice = 0;
+        for (int j = 1; j < numParts; ++j) {
+            prefixWeight += partWeights[j - 1];
+            double target = (totalWeight == 0) ?
+                totalCost * j / numParts :
+                totalCost * prefixWeight / totalWeight;
+            while ((slice < numSlices) && ((prefix + 0.5 * sliceCosts[slice]) < target)) {
+                prefix += sliceCosts[slice];
+                ++slice;
+            }
+            ret[j] = slice;
+        }
+
+        for (int j = 1; j < numParts; ++j) {
+            if (partWeights[j - 1] > 0) {
+                ret[j] = (std::min)(numSlices, (std::max)(ret[j], ret[j - 1] + 1));
+            }
+        }
+        for (int j = numParts - 1; j > 0; --j) {
+            if (partWeights[j] > 0) {
+                ret[j] = (std::max)(0, (std::min)(ret[j], ret[j + 1] - 1));
+            }
+        }
+        for (int j = 1; j < numParts; ++j) {
+            ret[j] = (std::max)(ret[j], ret[j - 1]);
+        }
+
+        return ret;
+    }
 
     Coord<DIM> getNodeGridDim(const std::size_t totalNodes) const
     {
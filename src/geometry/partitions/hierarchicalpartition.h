@@ -0,0 +1,192 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_HIERARCHICALPARTITION_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_HIERARCHICALPARTITION_H
+
+#include <libgeodecomp/geometry/partitions/partition.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * A two-level partition which reflects the hardware hierarchy of
+ * a cluster: the domain is first split among the nodes (using
+ * OUTER_PARTITION), then each node's share is split among the ranks
+ * running on that node (using INNER_PARTITION). This way most of the
+ * halo traffic stays within a node's shared memory and only the
+ * surfaces of the (larger) per-node subdomains induce network
+ * traffic -- no matter how the MPI launcher has placed the ranks.
+ *
+ * nodeIDs maps each rank (i.e. each entry of weights) to its node.
+ * An empty vector means that each rank resides on a node of its
+ * own, which degenerates to a flat OUTER_PARTITION.
+ *
+ * Both partitions need to be constructible from (origin, dimensions,
+ * offset, weights). If a node's subdomain isn't a box, the inner
+ * partition is set up on its bounding box with a CostMap that
+ * assigns zero cost to all foreign cells, so it needs to cut by
+ * cost while honoring the weights (all space-filling curves,
+ * RecursiveBisectionPartition and CheckerboardingPartition do).
+ */
+template<int DIM, typename OUTER_PARTITION, typename INNER_PARTITION = OUTER_PARTITION>
+class HierarchicalPartition : public Partition<DIM>
+{
+public:
+    using Partition<DIM>::weights;
+
+    inline explicit HierarchicalPartition(
+        const Coord<DIM>& origin = Coord<DIM>(),
+        const Coord<DIM>& dimensions = Coord<DIM>(),
+        const long& offset = 0,
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2),
+        const std::vector<std::size_t>& nodeIDs = std::vector<std::size_t>()) :
+        Partition<DIM>(offset, weights),
+        origin(origin),
+        dimensions(dimensions),
+        offset(offset),
+        nodeIDs(nodeIDs)
+    {
+        if (this->nodeIDs.empty()) {
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                this->nodeIDs << i;
+            }
+        }
+        if (this->nodeIDs.size() != weights.size()) {
+            throw std::invalid_argument("HierarchicalPartition needs exactly one node ID per rank");
+        }
+
+        std::size_t numNodes = 0;
+        for (std::size_t i = 0; i < this->nodeIDs.size(); ++i) {
+            numNodes = (std::max)(numNodes, this->nodeIDs[i] + 1);
+        }
+        ranksOfNode.resize(numNodes);
+        for (std::size_t i = 0; i < this->nodeIDs.size(); ++i) {
+            ranksOfNode[this->nodeIDs[i]] << i;
+        }
+
+        computeRegions(0);
+    }
+
+    Region<DIM> getRegion(const std::size_t node) const
+    {
+        return regions[node];
+    }
+
+    /**
+     * returns the subdomain of a whole node, i.e. the union of the
+     * regions of all ranks on that node.
+     */
+    const Region<DIM>& getNodeRegion(const std::size_t node) const
+    {
+        return nodeRegions[node];
+    }
+
+    std::size_t getNumNodes() const
+    {
+        return ranksOfNode.size();
+    }
+
+    void setCostMap(const CostMap<DIM>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        computeRegions(&costs);
+    }
+
+    /**
+     * Cost maps need to be supported by the outer partition and, for
+     * nodes hosting multiple ranks, by the inner partition.
+     */
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return costMapsSupported;
+    }
+
+private:
+    Coord<DIM> origin;
+    Coord<DIM> dimensions;
+    long offset;
+    std::vector<std::size_t> nodeIDs;
+    std::vector<std::vector<std::size_t> > ranksOfNode;
+    std::vector<Region<DIM> > nodeRegions;
+    std::vector<Region<DIM> > regions;
+    bool costMapsSupported;
+
+    void computeRegions(const CostMap<DIM> *costs)
+    {
+        std::vector<std::size_t> nodeWeights(ranksOfNode.size(), 0);
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            nodeWeights[nodeIDs[i]] += weights[i];
+        }
+
+        OUTER_PARTITION outer(origin, dimensions, offset, nodeWeights);
+        costMapsSupported = outer.supportsCostMaps();
+        if (costs) {
+            outer.setCostMap(*costs);
+        }
+
+        nodeRegions.resize(ranksOfNode.size());
+        regions = std::vector<Region<DIM> >(weights.size());
+        for (std::size_t node = 0; node < ranksOfNode.size(); ++node) {
+            nodeRegions[node] = outer.getRegion(node);
+            splitNode(node, costs);
+        }
+    }
+
+    void splitNode(const std::size_t node, const CostMap<DIM> *costs)
+    {
+        const Region<DIM>& nodeRegion = nodeRegions[node];
+        const std::vector<std::size_t>& ranks = ranksOfNode[node];
+        if (ranks.size() == 1) {
+            regions[ranks[0]] = nodeRegion;
+            return;
+        }
+
+        std::size_t nodeWeight = 0;
+        for (std::size_t i = 0; i < ranks.size(); ++i) {
+            nodeWeight += weights[ranks[i]];
+        }
+        if (nodeRegion.empty() || (nodeWeight == 0)) {
+            return;
+        }
+
+        // the inner partition expects its weights to sum up to the
+        // size of its domain, so we need to rescale them (via their
+        // prefix sums to avoid accumulating rounding errors):
+        CoordBox<DIM> box = nodeRegion.boundingBox();
+        std::size_t boxSize = box.dimensions.prod();
+        std::vector<std::size_t> innerWeights;
+        std::size_t prefix = 0;
+        std::size_t lastBoundary = 0;
+        for (std::size_t i = 0; i < ranks.size(); ++i) {
+            prefix += weights[ranks[i]];
+            std::size_t boundary = static_cast<std::size_t>(
+                static_cast<double>(prefix) * boxSize / nodeWeight + 0.5);
+            innerWeights << boundary - lastBoundary;
+            lastBoundary = boundary;
+        }
+
+        INNER_PARTITION inner(box.origin, box.dimensions, 0, innerWeights);
+        costMapsSupported = costMapsSupported && inner.supportsCostMaps();
+        bool isBox = (nodeRegion.size() == boxSize);
+        if (costs || !isBox) {
+            CostMap<DIM> innerCosts(box, Coord<DIM>::diagonal(1), 0.0);
+            for (typename Region<DIM>::Iterator i = nodeRegion.begin(); i != nodeRegion.end(); ++i) {
+                innerCosts.set(*i, costs ? (*costs)[*i] : 1.0);
+            }
+            inner.setCostMap(innerCosts);
+        }
+
+        for (std::size_t i = 0; i < ranks.size(); ++i) {
+            regions[ranks[i]] = inner.getRegion(i) & nodeRegion;
+        }
+    }
+};
+
+}
+
+#endif
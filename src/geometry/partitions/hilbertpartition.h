@@ -325,6 +325,25 @@ public:
             (*this)[startOffsets[node + 1]]);
     }
 
+    void setCostMap(const CostMap<2>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        this->splitByCost(
+            (*this)[startOffsets.front()],
+            (*this)[startOffsets.back()],
+            costs);
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
 private:
     using SpaceFillingCurve<2>::startOffsets;
 
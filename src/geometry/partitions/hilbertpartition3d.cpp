@@ -0,0 +1,76 @@
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+#include <boost/multi_array/iterator.hpp>
+
+namespace LibGeoDecomp {
+
+namespace {
+
+inline int rotateLeft(int bits, int shift)
+{
+    shift %= 3;
+    return ((bits << shift) | (bits >> (3 - shift))) & 7;
+}
+
+inline int grayCode(int i)
+{
+    return i ^ (i >> 1);
+}
+
+inline int trailingSetBits(int i)
+{
+    int ret = 0;
+    while (i & 1) {
+        ++ret;
+        i >>= 1;
+    }
+    return ret;
+}
+
+/**
+ * corner at which the curve enters the i-th sub-cube
+ */
+inline int entryPoint(int i)
+{
+    return (i == 0) ? 0 : grayCode(2 * ((i - 1) / 2));
+}
+
+/**
+ * axis along which the curve leaves the i-th sub-cube (relative to
+ * the parent's principal direction)
+ */
+inline int intraDirection(int i)
+{
+    if (i == 0) {
+        return 0;
+    }
+    return ((i % 2) == 0) ? (trailingSetBits(i - 1) % 3) : (trailingSetBits(i) % 3);
+}
+
+}
+
+HilbertPartition3D::Form HilbertPartition3D::cubeFormTransitions[HilbertPartition3D::NUM_FORMS][8];
+int HilbertPartition3D::cubeSectorTransitions[HilbertPartition3D::NUM_FORMS][8];
+
+// A Form encodes the entry corner e (0-7) and the direction d (0-2)
+// of a sub-cube's traversal as e * 3 + d.
+void HilbertPartition3D::fillTransitions()
+{
+    for (int form = 0; form < NUM_FORMS; ++form) {
+        int e = form / 3;
+        int d = form % 3;
+
+        for (int i = 0; i < 8; ++i) {
+            cubeSectorTransitions[form][i] = rotateLeft(grayCode(i), d + 1) ^ e;
+
+            int newE = e ^ rotateLeft(entryPoint(i), d + 1);
+            int newD = (d + intraDirection(i) + 1) % 3;
+            cubeFormTransitions[form][i] = newE * 3 + newD;
+        }
+    }
+}
+
+boost::shared_ptr<boost::multi_array<std::vector<Coord<3> >, 4> > HilbertPartition3D::cubeCoordsCache;
+Coord<3> HilbertPartition3D::maxCachedDimensions;
+bool HilbertPartition3D::cachesInitialized = HilbertPartition3D::fillCaches();
+
+}
@@ -0,0 +1,398 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_HILBERTPARTITION3D_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_HILBERTPARTITION3D_H
+
+#include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/partitions/spacefillingcurve.h>
+
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * The 3D counterpart of HilbertPartition: cubes are recursively split
+ * into octants which are then traversed in Hilbert order. Just like
+ * the 2D version, boxes of arbitrary (non power of two, non cubic)
+ * dimensions are handled by splitting each side in two halves of
+ * possibly unequal length.
+ *
+ * The 24 possible orientations of a sub-cube's traversal (Forms) are
+ * derived from the entry corner and the principal direction, as
+ * described by Hamilton in "Compact Hilbert Indices" (2006).
+ */
+class HilbertPartition3D : public SpaceFillingCurve<3>
+{
+    friend class HilbertPartition3DTest;
+public:
+    typedef int Form;
+    static const int NUM_FORMS = 24;
+
+    static boost::shared_ptr<boost::multi_array<std::vector<Coord<3> >, 4> > cubeCoordsCache;
+    static Form cubeFormTransitions[NUM_FORMS][8];
+    static int cubeSectorTransitions[NUM_FORMS][8];
+    static Coord<3> maxCachedDimensions;
+    static bool cachesInitialized;
+
+    class Cube
+    {
+    public:
+        inline Cube(const Coord<3>& origin, const Coord<3> dimensions, const unsigned& octant, const Form& form) :
+            origin(origin),
+            dimensions(dimensions),
+            octant(octant),
+            form(form)
+        {}
+
+        inline std::string toString() const
+        {
+            std::stringstream s;
+            s << "Cube(origin:" << origin << ", dimensions:" << dimensions << ", octant: " << octant << ", form: " << form << ")";
+            return s.str();
+        }
+
+        Coord<3> origin;
+        Coord<3> dimensions;
+        unsigned octant;
+        Form form;
+    };
+
+    class Iterator : public SpaceFillingCurve<3>::Iterator
+    {
+    public:
+        using SpaceFillingCurve<3>::Iterator::cursor;
+        using SpaceFillingCurve<3>::Iterator::endReached;
+        using SpaceFillingCurve<3>::Iterator::hasTrivialDimensions;
+        using SpaceFillingCurve<3>::Iterator::origin;
+        using SpaceFillingCurve<3>::Iterator::sublevelState;
+
+        inline Iterator(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            const unsigned& pos=0,
+            const Form& form=0) :
+            SpaceFillingCurve<3>::Iterator(origin, false)
+        {
+            cubeStack.push_back(Cube(origin, dimensions, 0, form));
+            digDown(pos);
+        }
+
+        inline explicit Iterator(const Coord<3>& origin) :
+            SpaceFillingCurve<3>::Iterator(origin, true)
+        {}
+
+        inline Iterator& operator++()
+        {
+            if (endReached) {
+                return *this;
+            }
+            if (sublevelState == TRIVIAL) {
+                operatorIncTrivial();
+            } else {
+                operatorIncCached();
+            }
+            return *this;
+        }
+
+    private:
+        std::vector<Cube> cubeStack;
+        int trivialCubeDirDim;
+        unsigned trivialCubeCounter;
+        Coord<3> cachedCubeOrigin;
+        Coord<3> *cachedCubeCoordsIterator;
+        Coord<3> *cachedCubeCoordsEnd;
+
+        inline void operatorIncTrivial()
+        {
+            if (--trivialCubeCounter > 0) {
+                cursor[trivialCubeDirDim]++;
+            } else {
+                digUpDown();
+            }
+        }
+
+        inline void operatorIncCached()
+        {
+            cachedCubeCoordsIterator++;
+            if (cachedCubeCoordsIterator != cachedCubeCoordsEnd) {
+                cursor = cachedCubeOrigin + *cachedCubeCoordsIterator;
+            } else {
+                digUpDown();
+            }
+        }
+
+        inline void digUpDown()
+        {
+            digUp();
+            if (endReached) {
+                return;
+            }
+            digDown(0);
+        }
+
+        inline void digDown(const unsigned& offset)
+        {
+            if (cubeStack.empty()) {
+                throw std::logic_error("cannot descend from empty cubes stack");
+            }
+
+            Cube currentCube = pop(cubeStack);
+            const Coord<3>& origin = currentCube.origin;
+            const Coord<3>& dimensions = currentCube.dimensions;
+
+            if ((int)offset >= dimensions.prod()) {
+                endReached = true;
+                cursor = origin;
+                return;
+            }
+            if (hasTrivialDimensions(dimensions)) {
+                digDownTrivial(origin, dimensions, offset);
+            } else if (isCached(dimensions)) {
+                digDownCached(origin, dimensions, offset, currentCube.form);
+            } else {
+                digDownRecursion(offset, currentCube);
+            }
+        }
+
+        inline void digDownTrivial(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            const unsigned& offset)
+        {
+            sublevelState = TRIVIAL;
+            cursor = origin;
+            trivialCubeDirDim = 0;
+            for (int i = 1; i < 3; ++i) {
+                if (dimensions[i] > 1) {
+                    trivialCubeDirDim = i;
+                }
+            }
+
+            trivialCubeCounter = dimensions[trivialCubeDirDim] - offset;
+            cursor[trivialCubeDirDim] += offset;
+        }
+
+        inline void digDownCached(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            const unsigned& offset,
+            const Form& form)
+        {
+            sublevelState = CACHED;
+            std::vector<Coord<3> >& coords =
+                (*cubeCoordsCache)[dimensions.x()][dimensions.y()][dimensions.z()][form];
+            cachedCubeOrigin = origin;
+            cachedCubeCoordsIterator = &coords[offset];
+            cachedCubeCoordsEnd      = &coords[0] + coords.size();
+            cursor = cachedCubeOrigin + *cachedCubeCoordsIterator;
+        }
+
+        inline void digDownRecursion(
+            const unsigned& offset,
+            Cube currentCube)
+        {
+            const Coord<3>& origin = currentCube.origin;
+            const Coord<3>& dimensions = currentCube.dimensions;
+            const Form& form = currentCube.form;
+            Coord<3> halfDimensions = dimensions / 2;
+
+            // accumulated octant sizes, e.g. accuSizes[0] is the sum
+            // of the first 0 octants, ergo 0, accuSizes[3] is the
+            // accumulated size of the first three octants (in
+            // traversal order). Octants may be empty if the cube is
+            // flat along one axis.
+            unsigned accuSizes[9];
+            accuSizes[0] = 0;
+            for (int i = 0; i < 8; ++i) {
+                accuSizes[i + 1] = accuSizes[i] +
+                    sector(origin, dimensions, halfDimensions, cubeSectorTransitions[form][i]).dimensions.prod();
+            }
+
+            unsigned pos = offset + accuSizes[currentCube.octant];
+            if (pos >= accuSizes[8]) {
+                // only trailing, empty octants remain:
+                digUpDown();
+                return;
+            }
+
+            unsigned newOctant = 0;
+            while (pos >= accuSizes[newOctant + 1]) {
+                ++newOctant;
+            }
+            currentCube.octant = newOctant;
+            cubeStack.push_back(currentCube);
+
+            CoordBox<3> newBox = sector(
+                origin,
+                dimensions,
+                halfDimensions,
+                cubeSectorTransitions[form][newOctant]);
+            Form newForm = cubeFormTransitions[form][newOctant];
+            cubeStack.push_back(Cube(newBox.origin, newBox.dimensions, 0, newForm));
+
+            digDown(pos - accuSizes[newOctant]);
+        }
+
+        /**
+         * Each bit of the sector index selects the lower or upper
+         * half along one axis (bit 0: x, bit 1: y, bit 2: z).
+         */
+        inline CoordBox<3> sector(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            const Coord<3>& halfDimensions,
+            const int sector) const
+        {
+            CoordBox<3> ret(origin, halfDimensions);
+            for (int i = 0; i < 3; ++i) {
+                if ((sector >> i) & 1) {
+                    ret.origin[i] += halfDimensions[i];
+                    ret.dimensions[i] = dimensions[i] - halfDimensions[i];
+                }
+            }
+
+            return ret;
+        }
+
+        inline void digUp()
+        {
+            while (!cubeStack.empty()) {
+                if (++cubeStack.back().octant == 8) {
+                    cubeStack.pop_back();
+                } else {
+                    return;
+                }
+            }
+            endReached = true;
+            cursor = origin;
+        }
+
+        inline bool isCached(const Coord<3>& dimensions) const
+        {
+            return (dimensions.x() < maxCachedDimensions.x() &&
+                    dimensions.y() < maxCachedDimensions.y() &&
+                    dimensions.z() < maxCachedDimensions.z());
+        }
+    };
+
+    inline explicit HilbertPartition3D(
+        const Coord<3>& origin=Coord<3>(0, 0, 0),
+        const Coord<3>& dimensions=Coord<3>(0, 0, 0),
+        const long& offset=0,
+        const std::vector<std::size_t>& weights=std::vector<std::size_t>(2)) :
+        SpaceFillingCurve<3>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {}
+
+    inline Iterator operator[](const unsigned& i) const
+    {
+        return Iterator(origin, dimensions, i);
+    }
+
+    inline Iterator begin() const
+    {
+        return (*this)[0];
+    }
+
+    inline Iterator end() const
+    {
+        return Iterator(origin);
+    }
+
+    inline Region<3> getRegion(const std::size_t node) const
+    {
+        return Region<3>(
+            (*this)[startOffsets[node + 0]],
+            (*this)[startOffsets[node + 1]]);
+    }
+
+    void setCostMap(const CostMap<3>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        this->splitByCost(
+            (*this)[startOffsets.front()],
+            (*this)[startOffsets.back()],
+            costs);
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
+private:
+    using SpaceFillingCurve<3>::startOffsets;
+
+    Coord<3> origin;
+    Coord<3> dimensions;
+
+    static void fillTransitions();
+
+    static inline bool fillCaches()
+    {
+        fillTransitions();
+
+        // store cubes of at most 4x4x4 cells, in all 24 orientations
+        Coord<3> maxDim(5, 5, 5);
+        cubeCoordsCache.reset(
+            new boost::multi_array<std::vector<Coord<3> >, 4>(
+                boost::extents[maxDim.x()][maxDim.y()][maxDim.z()][NUM_FORMS]));
+
+        // cubes are being added in order of increasing size so that
+        // the iterators can use the cached smaller cubes while we're
+        // filling the cache:
+        for (int size = 2; size < maxDim.x(); ++size) {
+            maxCachedDimensions = Coord<3>::diagonal(size);
+            CoordBox<3> box(Coord<3>(), Coord<3>::diagonal(size + 1));
+
+            for (CoordBox<3>::Iterator iter = box.begin(); iter != box.end(); ++iter) {
+                Coord<3> dimensions = *iter;
+                if ((dimensions.x() != size) && (dimensions.y() != size) && (dimensions.z() != size)) {
+                    continue;
+                }
+                if (hasTrivialDimensions(dimensions)) {
+                    continue;
+                }
+
+                for (int f = 0; f < NUM_FORMS; ++f) {
+                    std::vector<Coord<3> > coords;
+                    Iterator end(Coord<3>(0, 0, 0));
+                    for (Iterator i(Coord<3>(0, 0, 0), dimensions, 0, f); i != end; ++i) {
+                        coords.push_back(*i);
+                    }
+
+                    (*cubeCoordsCache)[dimensions.x()][dimensions.y()][dimensions.z()][f] = coords;
+                }
+            }
+        }
+
+        maxCachedDimensions = maxDim;
+        return true;
+    }
+
+    static inline bool hasTrivialDimensions(const Coord<3>& dimensions)
+    {
+        return SpaceFillingCurve<3>::Iterator::hasTrivialDimensions(dimensions);
+    }
+};
+
+template<typename _CharT, typename _Traits>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const typename HilbertPartition3D::Cube& cube)
+{
+    __os << cube.toString();
+    return __os;
+}
+
+}
+
+#endif
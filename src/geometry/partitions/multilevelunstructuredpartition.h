@@ -0,0 +1,652 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_MULTILEVELUNSTRUCTUREDPARTITION_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_MULTILEVELUNSTRUCTUREDPARTITION_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/adjacency.h>
+#include <libgeodecomp/geometry/partitions/partition.h>
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A built-in graph partitioner for unstructured grids, to be used
+ * if Scotch is not available. It follows the classic multilevel
+ * scheme: the graph spanned by the Adjacency is coarsened via
+ * heavy-edge matching, the coarsest graph is split via greedy graph
+ * growing, and the partition is then projected back level by level,
+ * getting improved by k-way Fiduccia-Mattheyses refinement on each
+ * level.
+ *
+ * Cell IDs are expected to range from origin to origin + dimensions.
+ * Directed adjacency entries are symmetrized, thus the edge cut
+ * reported by getEdgeCut() equals the number of entries in the
+ * Adjacency which connect cells on different nodes.
+ */
+class MultilevelUnstructuredPartition : public Partition<1>
+{
+public:
+    friend class MultilevelUnstructuredPartitionTest;
+    using Partition<1>::weights;
+
+    /**
+     * maxImbalance is the tolerated ratio by which a node's load may
+     * exceed its target load (as given by weights) during refinement.
+     */
+    explicit MultilevelUnstructuredPartition(
+        const Coord<1>& origin,
+        const Coord<1>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const Adjacency& adjacency,
+        const double maxImbalance = 0.03,
+        const int refinementPasses = 8) :
+        Partition<1>(offset, weights),
+        origin(origin),
+        dimensions(dimensions),
+        maxImbalance(maxImbalance),
+        refinementPasses(refinementPasses),
+        edgeCut(0),
+        imbalance(0),
+        adjacency(adjacency)
+    {
+        buildRegions();
+    }
+
+    Region<1> getRegion(const std::size_t node) const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return regions[node];
+    }
+
+    const Adjacency& getAdjacency() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return adjacency;
+    }
+
+    /**
+     * Sum of the weights of all edges which cross node boundaries.
+     */
+    std::size_t getEdgeCut() const
+    {
+        return edgeCut;
+    }
+
+    /**
+     * Maximum relative overload of any node, i.e. 0.05 means that
+     * the most loaded node received 5% more cells than requested.
+     */
+    double getImbalance() const
+    {
+        return imbalance;
+    }
+
+private:
+    /**
+     * Compressed sparse row representation of a weighted, undirected graph.
+     */
+    class Graph
+    {
+    public:
+        std::vector<int> offsets;
+        std::vector<int> neighbors;
+        std::vector<int> edgeWeights;
+        std::vector<int> vertexWeights;
+
+        inline int size() const
+        {
+            return vertexWeights.size();
+        }
+    };
+
+    /**
+     * A vertex' best move during refinement, prioritized by whether
+     * it relieves an overloaded node and by the reduction of the edge
+     * cut.
+     */
+    class Move
+    {
+    public:
+        Move() :
+            target(-1)
+        {}
+
+        int target;
+        std::pair<int, int> priority;
+    };
+
+    Coord<1> origin;
+    Coord<1> dimensions;
+    double maxImbalance;
+    int refinementPasses;
+    std::size_t edgeCut;
+    double imbalance;
+    std::vector<Region<1> > regions;
+    Adjacency adjacency;
+
+    void buildRegions()
+    {
+        regions.resize(weights.size());
+        if ((dimensions.x() <= 0) || (weights.size() == 0)) {
+            return;
+        }
+
+        std::vector<Graph> graphs(1);
+        std::vector<std::vector<int> > coarseMaps;
+        buildGraph(&graphs[0]);
+
+        std::size_t coarsenTo = std::max<std::size_t>(32, 16 * weights.size());
+        while (std::size_t(graphs.back().size()) > coarsenTo) {
+            Graph coarse;
+            std::vector<int> coarseMap;
+            coarsen(graphs.back(), &coarse, &coarseMap);
+
+            // stop if matching stalls, e.g. for star-shaped graphs:
+            if (coarse.size() > (0.9 * graphs.back().size())) {
+                break;
+            }
+
+            graphs.push_back(Graph());
+            std::swap(graphs.back(), coarse);
+            coarseMaps.push_back(std::vector<int>());
+            std::swap(coarseMaps.back(), coarseMap);
+        }
+
+        std::vector<double> targets = targetWeights(graphs[0].size());
+        std::vector<int> parts;
+        initialPartition(graphs.back(), targets, &parts);
+        refine(graphs.back(), targets, &parts);
+
+        for (int level = graphs.size() - 2; level >= 0; --level) {
+            const std::vector<int>& coarseMap = coarseMaps[level];
+            std::vector<int> fineParts(graphs[level].size());
+            for (std::size_t i = 0; i < fineParts.size(); ++i) {
+                fineParts[i] = parts[coarseMap[i]];
+            }
+            std::swap(parts, fineParts);
+            refine(graphs[level], targets, &parts);
+        }
+
+        computeStatistics(graphs[0], targets, parts);
+        createRegions(parts);
+    }
+
+    void buildGraph(Graph *graph) const
+    {
+        int numCells = dimensions.x();
+        std::vector<std::pair<int, int> > edges;
+
+        for (Adjacency::const_iterator i = adjacency.begin(); i != adjacency.end(); ++i) {
+            int from = i->first - origin.x();
+            if ((from < 0) || (from >= numCells)) {
+                continue;
+            }
+
+            for (std::vector<int>::const_iterator j = i->second.begin(); j != i->second.end(); ++j) {
+                int to = *j - origin.x();
+                if ((to < 0) || (to >= numCells) || (to == from)) {
+                    continue;
+                }
+
+                edges.push_back(std::make_pair(from, to));
+                edges.push_back(std::make_pair(to, from));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        graph->vertexWeights = std::vector<int>(numCells, 1);
+        graph->offsets = std::vector<int>(numCells + 1, 0);
+        graph->neighbors.clear();
+        graph->edgeWeights.clear();
+
+        // merge duplicates, they're counted as heavier edges:
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            if ((i > 0) && (edges[i] == edges[i - 1])) {
+                ++graph->edgeWeights.back();
+                continue;
+            }
+
+            graph->neighbors.push_back(edges[i].second);
+            graph->edgeWeights.push_back(1);
+            ++graph->offsets[edges[i].first + 1];
+        }
+
+        for (int i = 0; i < numCells; ++i) {
+            graph->offsets[i + 1] += graph->offsets[i];
+        }
+    }
+
+    /**
+     * Collapses pairs of vertices along their heaviest edges.
+     * Vertices are visited by increasing degree so that weakly
+     * connected vertices have a chance to find a partner, too.
+     */
+    void coarsen(const Graph& fine, Graph *coarse, std::vector<int> *coarseMap) const
+    {
+        int n = fine.size();
+        int maxVertexWeight = std::max(
+            2,
+            int(1.5 * sum(fine.vertexWeights) / std::max<std::size_t>(32, 16 * weights.size())));
+
+        std::vector<std::pair<int, int> > order(n);
+        for (int v = 0; v < n; ++v) {
+            order[v] = std::make_pair(fine.offsets[v + 1] - fine.offsets[v], v);
+        }
+        std::sort(order.begin(), order.end());
+
+        std::vector<int> match(n, -1);
+        for (int i = 0; i < n; ++i) {
+            int v = order[i].second;
+            if (match[v] != -1) {
+                continue;
+            }
+
+            int best = v;
+            int bestWeight = -1;
+            for (int e = fine.offsets[v]; e < fine.offsets[v + 1]; ++e) {
+                int u = fine.neighbors[e];
+                if ((match[u] == -1) &&
+                    (fine.edgeWeights[e] > bestWeight) &&
+                    ((fine.vertexWeights[v] + fine.vertexWeights[u]) <= maxVertexWeight)) {
+                    best = u;
+                    bestWeight = fine.edgeWeights[e];
+                }
+            }
+
+            match[v] = best;
+            match[best] = v;
+        }
+
+        coarseMap->assign(n, -1);
+        int coarseSize = 0;
+        for (int v = 0; v < n; ++v) {
+            if ((*coarseMap)[v] == -1) {
+                (*coarseMap)[v] = coarseSize;
+                (*coarseMap)[match[v]] = coarseSize;
+                ++coarseSize;
+            }
+        }
+
+        coarse->vertexWeights.assign(coarseSize, 0);
+        coarse->offsets.assign(coarseSize + 1, 0);
+        coarse->neighbors.clear();
+        coarse->edgeWeights.clear();
+
+        // slot[c] holds the index of the edge to coarse vertex c
+        // within the adjacency list currently being assembled:
+        std::vector<int> slot(coarseSize, -1);
+        int cursor = 0;
+        for (int v = 0; v < n; ++v) {
+            int c = (*coarseMap)[v];
+            if (c != cursor) {
+                continue;
+            }
+
+            int start = coarse->neighbors.size();
+            int members[] = { v, match[v] };
+            int numMembers = (match[v] == v) ? 1 : 2;
+
+            for (int m = 0; m < numMembers; ++m) {
+                int member = members[m];
+                coarse->vertexWeights[c] += fine.vertexWeights[member];
+
+                for (int e = fine.offsets[member]; e < fine.offsets[member + 1]; ++e) {
+                    int target = (*coarseMap)[fine.neighbors[e]];
+                    if (target == c) {
+                        continue;
+                    }
+
+                    if (slot[target] < start) {
+                        slot[target] = coarse->neighbors.size();
+                        coarse->neighbors.push_back(target);
+                        coarse->edgeWeights.push_back(fine.edgeWeights[e]);
+                    } else {
+                        coarse->edgeWeights[slot[target]] += fine.edgeWeights[e];
+                    }
+                }
+            }
+
+            coarse->offsets[c + 1] = coarse->neighbors.size();
+            ++cursor;
+        }
+    }
+
+    std::vector<double> targetWeights(int totalWeight) const
+    {
+        std::vector<double> ret(weights.size());
+        double weightSum = sum(weights);
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            ret[i] = (weightSum == 0) ? 0 : totalWeight * (weights[i] / weightSum);
+        }
+
+        return ret;
+    }
+
+    /**
+     * Grows one node's share after the other from a seed vertex,
+     * always adding the unassigned vertex with the strongest
+     * connection to the current node. Candidates are kept in a heap
+     * (stale entries are skipped when popped), new seeds are taken
+     * in ID order, so growing takes O(E log E) time. The last node
+     * with a non-zero weight receives all remaining vertices.
+     */
+    void initialPartition(const Graph& graph, const std::vector<double>& targets, std::vector<int> *parts) const
+    {
+        int n = graph.size();
+        parts->assign(n, -1);
+        int last = targets.size() - 1;
+        while ((last > 0) && (weights[last] == 0)) {
+            --last;
+        }
+
+        std::vector<int> gain(n, 0);
+        std::vector<int> touched;
+        int seedCursor = 0;
+        int assigned = 0;
+
+        for (int p = 0; p < last; ++p) {
+            // max-heap of (gain, -vertex), ties go to the lowest ID:
+            std::priority_queue<std::pair<int, int> > candidates;
+            double load = 0;
+
+            while ((assigned < n) && (load < targets[p])) {
+                while (!candidates.empty() &&
+                       (((*parts)[-candidates.top().second] != -1) ||
+                        (gain[-candidates.top().second] != candidates.top().first))) {
+                    candidates.pop();
+                }
+
+                int next;
+                if (candidates.empty()) {
+                    while ((*parts)[seedCursor] != -1) {
+                        ++seedCursor;
+                    }
+                    next = seedCursor;
+                } else {
+                    next = -candidates.top().second;
+                }
+
+                double overshoot = load + graph.vertexWeights[next] - targets[p];
+                if ((load > 0) && (overshoot > (targets[p] - load))) {
+                    break;
+                }
+
+                (*parts)[next] = p;
+                load += graph.vertexWeights[next];
+                ++assigned;
+                for (int e = graph.offsets[next]; e < graph.offsets[next + 1]; ++e) {
+                    int u = graph.neighbors[e];
+                    if ((*parts)[u] != -1) {
+                        continue;
+                    }
+
+                    if (gain[u] == 0) {
+                        touched.push_back(u);
+                    }
+                    gain[u] += graph.edgeWeights[e];
+                    candidates.push(std::make_pair(gain[u], -u));
+                }
+            }
+
+            for (std::vector<int>::iterator i = touched.begin(); i != touched.end(); ++i) {
+                gain[*i] = 0;
+            }
+            touched.clear();
+        }
+
+        for (int v = 0; v < n; ++v) {
+            if ((*parts)[v] == -1) {
+                (*parts)[v] = last;
+            }
+        }
+    }
+
+    /**
+     * Runs passes of k-way Fiduccia-Mattheyses refinement until a
+     * pass fails to improve the partition.
+     */
+    void refine(const Graph& graph, const std::vector<double>& targets, std::vector<int> *parts) const
+    {
+        int numParts = targets.size();
+        std::vector<double> loads(numParts, 0);
+        std::vector<double> limits(numParts);
+        for (int v = 0; v < graph.size(); ++v) {
+            loads[(*parts)[v]] += graph.vertexWeights[v];
+        }
+        for (int p = 0; p < numParts; ++p) {
+            limits[p] = (targets[p] == 0) ? 0 : std::max(targets[p] * (1 + maxImbalance), targets[p] + 1);
+        }
+
+        for (int pass = 0; pass < refinementPasses; ++pass) {
+            if (!refinementPass(graph, targets, limits, &loads, parts)) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * One FM pass: boundary vertices are moved one at a time to the
+     * adjacent node which yields the highest gain, even if that gain
+     * is negative (hill climbing), as long as the target stays below
+     * its load limit. Vertices of overloaded nodes go first. Each
+     * vertex moves at most once per pass. Finally all moves after the
+     * best prefix (lowest overload, then lowest edge cut) are rolled
+     * back. Returns true if the partition has been improved.
+     */
+    bool refinementPass(
+        const Graph& graph,
+        const std::vector<double>& targets,
+        const std::vector<double>& limits,
+        std::vector<double> *loads,
+        std::vector<int> *parts) const
+    {
+        typedef std::pair<std::pair<int, int>, int> Candidate;
+
+        int n = graph.size();
+        std::vector<char> locked(n, 0);
+        std::vector<int> connectivity(targets.size(), 0);
+        std::vector<int> touched;
+        std::priority_queue<Candidate> candidates;
+
+        for (int v = 0; v < n; ++v) {
+            Move move = bestMove(graph, targets, limits, *loads, *parts, v, &connectivity, &touched);
+            if (move.target != -1) {
+                candidates.push(Candidate(move.priority, v));
+            }
+        }
+
+        // (vertex, source node) for each move, needed for the rollback:
+        std::vector<std::pair<int, int> > moves;
+        double overload = totalOverload(limits, *loads);
+        double bestOverload = overload;
+        long cutDelta = 0;
+        long bestCutDelta = 0;
+        std::size_t bestPrefix = 0;
+        int maxFruitlessMoves = std::max(50, n / 50);
+        int fruitlessMoves = 0;
+
+        while (!candidates.empty() && (fruitlessMoves < maxFruitlessMoves)) {
+            Candidate candidate = candidates.top();
+            candidates.pop();
+            int v = candidate.second;
+            if (locked[v]) {
+                continue;
+            }
+
+            // neighbors may have moved since this entry was queued:
+            Move move = bestMove(graph, targets, limits, *loads, *parts, v, &connectivity, &touched);
+            if (move.target == -1) {
+                continue;
+            }
+            if (move.priority != candidate.first) {
+                candidates.push(Candidate(move.priority, v));
+                continue;
+            }
+
+            int from = (*parts)[v];
+            int to = move.target;
+            overload -= overloadOf(limits, *loads, from) + overloadOf(limits, *loads, to);
+            (*loads)[from] -= graph.vertexWeights[v];
+            (*loads)[to]   += graph.vertexWeights[v];
+            overload += overloadOf(limits, *loads, from) + overloadOf(limits, *loads, to);
+
+            (*parts)[v] = to;
+            locked[v] = 1;
+            cutDelta -= move.priority.second;
+            moves.push_back(std::make_pair(v, from));
+
+            for (int e = graph.offsets[v]; e < graph.offsets[v + 1]; ++e) {
+                int u = graph.neighbors[e];
+                if (locked[u]) {
+                    continue;
+                }
+
+                Move neighborMove = bestMove(graph, targets, limits, *loads, *parts, u, &connectivity, &touched);
+                if (neighborMove.target != -1) {
+                    candidates.push(Candidate(neighborMove.priority, u));
+                }
+            }
+
+            bool lessOverload = overload < (bestOverload - 1e-6);
+            bool sameOverload = overload < (bestOverload + 1e-6);
+            if (lessOverload || (sameOverload && (cutDelta < bestCutDelta))) {
+                bestOverload = overload;
+                bestCutDelta = cutDelta;
+                bestPrefix = moves.size();
+                fruitlessMoves = 0;
+            } else {
+                ++fruitlessMoves;
+            }
+        }
+
+        while (moves.size() > bestPrefix) {
+            int v = moves.back().first;
+            int from = moves.back().second;
+            (*loads)[(*parts)[v]] -= graph.vertexWeights[v];
+            (*loads)[from]        += graph.vertexWeights[v];
+            (*parts)[v] = from;
+            moves.pop_back();
+        }
+
+        return bestPrefix > 0;
+    }
+
+    /**
+     * Finds the adjacent node to which vertex v could be moved with
+     * the highest gain. Ties are broken in favor of the node with
+     * the lowest relative load.
+     */
+    Move bestMove(
+        const Graph& graph,
+        const std::vector<double>& targets,
+        const std::vector<double>& limits,
+        const std::vector<double>& loads,
+        const std::vector<int>& parts,
+        int v,
+        std::vector<int> *connectivity,
+        std::vector<int> *touched) const
+    {
+        int from = parts[v];
+        int vertexWeight = graph.vertexWeights[v];
+
+        touched->clear();
+        for (int e = graph.offsets[v]; e < graph.offsets[v + 1]; ++e) {
+            int p = parts[graph.neighbors[e]];
+            if ((*connectivity)[p] == 0) {
+                touched->push_back(p);
+            }
+            (*connectivity)[p] += graph.edgeWeights[e];
+        }
+
+        Move ret;
+        double bestSlack = 0;
+        for (std::vector<int>::iterator i = touched->begin(); i != touched->end(); ++i) {
+            int to = *i;
+            if ((to == from) || ((loads[to] + vertexWeight) > limits[to])) {
+                continue;
+            }
+
+            int gain = (*connectivity)[to] - (*connectivity)[from];
+            double slack = (loads[to] + vertexWeight) / targets[to];
+            if ((ret.target == -1) ||
+                (gain > ret.priority.second) ||
+                ((gain == ret.priority.second) && (slack < bestSlack))) {
+                ret.target = to;
+                ret.priority = std::make_pair(int(loads[from] > limits[from]), gain);
+                bestSlack = slack;
+            }
+        }
+
+        for (std::vector<int>::iterator i = touched->begin(); i != touched->end(); ++i) {
+            (*connectivity)[*i] = 0;
+        }
+
+        return ret;
+    }
+
+    static double overloadOf(const std::vector<double>& limits, const std::vector<double>& loads, int part)
+    {
+        return std::max(0.0, loads[part] - limits[part]);
+    }
+
+    static double totalOverload(const std::vector<double>& limits, const std::vector<double>& loads)
+    {
+        double ret = 0;
+        for (std::size_t p = 0; p < loads.size(); ++p) {
+            ret += overloadOf(limits, loads, p);
+        }
+
+        return ret;
+    }
+
+    void computeStatistics(const Graph& graph, const std::vector<double>& targets, const std::vector<int>& parts)
+    {
+        edgeCut = 0;
+        for (int v = 0; v < graph.size(); ++v) {
+            for (int e = graph.offsets[v]; e < graph.offsets[v + 1]; ++e) {
+                if (parts[v] != parts[graph.neighbors[e]]) {
+                    edgeCut += graph.edgeWeights[e];
+                }
+            }
+        }
+        // each undirected edge has been counted twice:
+        edgeCut /= 2;
+
+        std::vector<double> loads(targets.size(), 0);
+        for (int v = 0; v < graph.size(); ++v) {
+            loads[parts[v]] += graph.vertexWeights[v];
+        }
+
+        imbalance = 0;
+        for (std::size_t p = 0; p < targets.size(); ++p) {
+            if (targets[p] > 0) {
+                imbalance = std::max(imbalance, loads[p] / targets[p] - 1);
+            }
+        }
+    }
+
+    void createRegions(const std::vector<int>& parts)
+    {
+        int streakStart = 0;
+        for (int i = 1; i <= int(parts.size()); ++i) {
+            if ((i == int(parts.size())) || (parts[i] != parts[streakStart])) {
+                regions[parts[streakStart]] << Streak<1>(
+                    Coord<1>(origin.x() + streakStart),
+                    origin.x() + i);
+                streakStart = i;
+            }
+        }
+    }
+};
+
+}
+
+#endif
@@ -1,9 +1,12 @@
 #ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_PARTITION_H
 #define LIBGEODECOMP_GEOMETRY_PARTITIONS_PARTITION_H
 
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 
+#include <stdexcept>
+
 namespace LibGeoDecomp {
 
 template<int DIM>
@@ -48,6 +51,27 @@ public:
         return adjacency;
     }
 
+    /**
+     * Lets the partition cut the domain by cumulative cost (as given
+     * by costs) instead of by cell count. The weights then specify
+     * the share of the total cost each node should receive. costs
+     * needs to cover the whole domain of the partition.
+     */
+    virtual void setCostMap(const CostMap<DIM>& /* unused: costs */)
+    {
+        throw std::logic_error("this partition doesn't support cost maps");
+    }
+
+    /**
+     * true if setCostMap() is implemented. Callers with optional
+     * cost estimates can check this to fall back to cutting by cell
+     * count.
+     */
+    virtual bool supportsCostMaps() const
+    {
+        return false;
+    }
+
 protected:
     std::vector<std::size_t> weights;
     std::vector<std::size_t> startOffsets;
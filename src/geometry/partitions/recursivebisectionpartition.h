@@ -5,6 +5,8 @@
 #include <libgeodecomp/geometry/partitions/partition.h>
 #include <libgeodecomp/misc/math.h>
 
+#include <boost/shared_ptr.hpp>
+
 namespace LibGeoDecomp {
 
 template<int DIM>
@@ -43,12 +45,33 @@ public:
         return r;
     }
 
+    /**
+     * With a CostMap present, boxes will be bisected along the cost
+     * median instead of the geometric one.
+     */
+    void setCostMap(const CostMap<DIM>& newCosts)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        costs.reset(new CostMap<DIM>(newCosts));
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
 private:
     using Partition<DIM>::startOffsets;
 
     Coord<DIM> origin;
     Coord<DIM> dimensions;
     Coord<DIM> dimWeights;
+    boost::shared_ptr<CostMap<DIM> > costs;
 
     /**
      * returns the CoordBox which belongs to the node whose weight is
@@ -108,12 +131,44 @@ private:
             }
         }
 
-        int offset = round(ratio * dim[longestDim]);
+        int offset = costs ?
+            costSplit(costs->marginal(oldBox, longestDim), ratio) :
+            round(ratio * dim[longestDim]);
         int remainder = dim[longestDim] - offset;
         newBoxes[0].dimensions[longestDim] = offset;
         newBoxes[1].dimensions[longestDim] = remainder;
         newBoxes[1].origin[longestDim] += offset;
     }
+
+    /**
+     * returns the number of slices which, starting from the box's
+     * lower end, best match the given share of the total cost. If
+     * both halves carry weight (0 < ratio < 1), each receives at
+     * least one slice, even if the cost is concentrated at one end.
+     */
+    inline int costSplit(const std::vector<double>& sliceCosts, const double& ratio) const
+    {
+        double target = ratio * sum(sliceCosts);
+        double prefix = 0;
+        int ret = 0;
+        double bestDelta = target;
+
+        for (std::size_t i = 0; i < sliceCosts.size(); ++i) {
+            prefix += sliceCosts[i];
+            double delta = std::abs(prefix - target);
+            if (delta < bestDelta) {
+                bestDelta = delta;
+                ret = i + 1;
+            }
+        }
+
+        int numSlices = sliceCosts.size();
+        if ((ratio > 0) && (ratio < 1) && (numSlices > 1)) {
+            ret = (std::max)(1, (std::min)(ret, numSlices - 1));
+        }
+
+        return ret;
+    }
 };
 
 template<typename _CharT, typename _Traits, int _Dim>
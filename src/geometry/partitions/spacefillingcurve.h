@@ -62,6 +62,60 @@ public:
         const std::vector<std::size_t>& weights) :
         Partition<DIM>(offset, weights)
     {}
+
+protected:
+    using Partition<DIM>::startOffsets;
+    using Partition<DIM>::weights;
+
+    /**
+     * Moves the start offsets so that the curve section [begin, end)
+     * gets split along the prefix sums of the cells' costs (instead
+     * of cell counts), proportionally to the weights. If the section
+     * is free of cost, it's split by cell count instead.
+     */
+    template<typename ITERATOR>
+    void splitByCost(const ITERATOR& begin, const ITERATOR& end, const CostMap<DIM>& costs)
+    {
+        double totalCost = 0;
+        for (ITERATOR i = begin; i != end; ++i) {
+            totalCost += costs[*i];
+        }
+
+        if (totalCost <= 0) {
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                startOffsets[i + 1] = startOffsets[i] + weights[i];
+            }
+            return;
+        }
+
+        std::vector<double> boundaries(weights.size() + 1, 0);
+        double totalWeight = sum(weights);
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            boundaries[i + 1] = boundaries[i] + weights[i];
+        }
+        for (std::size_t i = 0; i < boundaries.size(); ++i) {
+            boundaries[i] = (totalWeight == 0) ? 0 : totalCost * (boundaries[i] / totalWeight);
+        }
+
+        std::size_t node = 1;
+        std::size_t index = startOffsets.front();
+        double cumulativeCost = 0;
+        for (ITERATOR i = begin; i != end; ++i) {
+            double cost = costs[*i];
+            // the cell belongs to the node which holds the larger
+            // part of its cost:
+            while ((node < (startOffsets.size() - 1)) && ((cumulativeCost + 0.5 * cost) >= boundaries[node])) {
+                startOffsets[node++] = index;
+            }
+
+            cumulativeCost += cost;
+            ++index;
+        }
+
+        for (; node < startOffsets.size(); ++node) {
+            startOffsets[node] = index;
+        }
+    }
 };
 
 }
@@ -53,6 +53,25 @@ public:
             (*this)[startOffsets[node + 1]]);
     }
 
+    void setCostMap(const CostMap<DIM>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        this->splitByCost(
+            (*this)[startOffsets.front()],
+            (*this)[startOffsets.back()],
+            costs);
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
     Iterator operator[](const unsigned& pos) const
     {
         Coord<DIM> cursor = dimensions.indexToCoord(pos) + origin;
@@ -130,6 +130,107 @@ public:
             }
         }
     }
+
+    void testCostMap()
+    {
+        // the left quarter is three times as expensive, hence the
+        // cost-balanced cut along the x-axis moves from 8 to 4:
+        Coord<2> origin(5, 10);
+        Coord<2> dimensions(16, 16);
+        CostMap<2> costs(CoordBox<2>(origin, dimensions));
+        for (int y = 10; y < 26; ++y) {
+            costs.set(Streak<2>(Coord<2>(5, y), 9), 3.0);
+        }
+
+        std::vector<std::size_t> weights;
+        weights << 1 << 1 << 1 << 1;
+        CheckerboardingPartition<2> p(origin, dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        Region<2> expected1;
+        Region<2> expected2;
+        Region<2> expected3;
+        expected0 << CoordBox<2>(Coord<2>( 5, 10), Coord<2>( 4, 8));
+        expected1 << CoordBox<2>(Coord<2>( 9, 10), Coord<2>(12, 8));
+        expected2 << CoordBox<2>(Coord<2>( 5, 18), Coord<2>( 4, 8));
+        expected3 << CoordBox<2>(Coord<2>( 9, 18), Coord<2>(12, 8));
+
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+        TS_ASSERT_EQUALS(expected2, p.getRegion(2));
+        TS_ASSERT_EQUALS(expected3, p.getRegion(3));
+    }
+
+    void testCostMapWithWeights()
+    {
+        // two nodes stacked along the y-axis, the second one should
+        // receive three quarters of the (uniform) cost:
+        Coord<2> dimensions(16, 16);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), dimensions));
+
+        std::vector<std::size_t> weights;
+        weights << 1 << 3;
+        CheckerboardingPartition<2> p(Coord<2>(), dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        Region<2> expected1;
+        expected0 << CoordBox<2>(Coord<2>(0, 0), Coord<2>(16,  4));
+        expected1 << CoordBox<2>(Coord<2>(0, 4), Coord<2>(16, 12));
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+    }
+
+    void testCostMapNestedCuts()
+    {
+        // the upper left quadrant is three times as expensive. The
+        // domain is first cut at y = 6, then each slab along the
+        // x-axis at its own cost median:
+        Coord<2> dimensions(16, 16);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), dimensions));
+        for (int y = 0; y < 8; ++y) {
+            costs.set(Streak<2>(Coord<2>(0, y), 8), 3.0);
+        }
+
+        std::vector<std::size_t> weights;
+        weights << 1 << 1 << 1 << 1;
+        CheckerboardingPartition<2> p(Coord<2>(), dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        Region<2> expected1;
+        Region<2> expected2;
+        Region<2> expected3;
+        expected0 << CoordBox<2>(Coord<2>(0, 0), Coord<2>( 5,  6));
+        expected1 << CoordBox<2>(Coord<2>(5, 0), Coord<2>(11,  6));
+        expected2 << CoordBox<2>(Coord<2>(0, 6), Coord<2>( 7, 10));
+        expected3 << CoordBox<2>(Coord<2>(7, 6), Coord<2>( 9, 10));
+
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+        TS_ASSERT_EQUALS(expected2, p.getRegion(2));
+        TS_ASSERT_EQUALS(expected3, p.getRegion(3));
+    }
+
+    void testCostConcentratedInCorner()
+    {
+        Coord<2> dimensions(16, 16);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), dimensions), Coord<2>::diagonal(1), 0.0);
+        costs.set(Coord<2>(15, 15), 100.0);
+
+        std::vector<std::size_t> weights;
+        weights << 1 << 1 << 1 << 1;
+        CheckerboardingPartition<2> p(Coord<2>(), dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> all;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            TS_ASSERT(!p.getRegion(i).empty());
+            all += p.getRegion(i);
+        }
+        TS_ASSERT_EQUALS(std::size_t(256), all.size());
+    }
 };
 
 }
@@ -0,0 +1,69 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HierarchicalPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/hierarchicalpartitiontest.h"
+
+static HierarchicalPartitionTest suite_HierarchicalPartitionTest;
+
+static CxxTest::List Tests_HierarchicalPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HierarchicalPartitionTest( "/root/repo/src/geometry/partitions/test/unit/hierarchicalpartitiontest.h", 16, "HierarchicalPartitionTest", suite_HierarchicalPartitionTest, Tests_HierarchicalPartitionTest );
+
+static class TestDescription_suite_HierarchicalPartitionTest_testFlatWithoutNodeIDs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testFlatWithoutNodeIDs() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 19, "testFlatWithoutNodeIDs" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testFlatWithoutNodeIDs(); }
+} testDescription_suite_HierarchicalPartitionTest_testFlatWithoutNodeIDs;
+
+static class TestDescription_suite_HierarchicalPartitionTest_testBoxesPerNode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testBoxesPerNode() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 32, "testBoxesPerNode" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testBoxesPerNode(); }
+} testDescription_suite_HierarchicalPartitionTest_testBoxesPerNode;
+
+static class TestDescription_suite_HierarchicalPartitionTest_testIrregularNodeRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testIrregularNodeRegions() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 56, "testIrregularNodeRegions" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testIrregularNodeRegions(); }
+} testDescription_suite_HierarchicalPartitionTest_testIrregularNodeRegions;
+
+static class TestDescription_suite_HierarchicalPartitionTest_testInterNodeSurfaceIsReduced : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testInterNodeSurfaceIsReduced() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 77, "testInterNodeSurfaceIsReduced" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testInterNodeSurfaceIsReduced(); }
+} testDescription_suite_HierarchicalPartitionTest_testInterNodeSurfaceIsReduced;
+
+static class TestDescription_suite_HierarchicalPartitionTest_testCostMap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testCostMap() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 101, "testCostMap" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testCostMap(); }
+} testDescription_suite_HierarchicalPartitionTest_testCostMap;
+
+static class TestDescription_suite_HierarchicalPartitionTest_testInvalidNodeIDs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HierarchicalPartitionTest_testInvalidNodeIDs() : CxxTest::RealTestDescription( Tests_HierarchicalPartitionTest, suiteDescription_HierarchicalPartitionTest, 132, "testInvalidNodeIDs" ) {}
+ void runTest() { suite_HierarchicalPartitionTest.testInvalidNodeIDs(); }
+} testDescription_suite_HierarchicalPartitionTest_testInvalidNodeIDs;
+
@@ -0,0 +1,186 @@
+#include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/hierarchicalpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition.h>
+#include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+
+#include <boost/assign/std/vector.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace boost::assign;
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class HierarchicalPartitionTest : public CxxTest::TestSuite
+{
+public:
+    void testFlatWithoutNodeIDs()
+    {
+        Coord<2> dimensions(64, 32);
+        std::vector<std::size_t> weights(4, 512);
+        HierarchicalPartition<2, StripingPartition<2> > partition(Coord<2>(), dimensions, 0, weights);
+        StripingPartition<2> flat(Coord<2>(), dimensions, 0, weights);
+
+        TS_ASSERT_EQUALS(std::size_t(4), partition.getNumNodes());
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            TS_ASSERT_EQUALS(flat.getRegion(i), partition.getRegion(i));
+        }
+    }
+
+    void testBoxesPerNode()
+    {
+        // 2 nodes with 4 ranks each, but the launcher has placed
+        // them round-robin:
+        Coord<2> origin(10, 20);
+        Coord<2> dimensions(64, 64);
+        std::vector<std::size_t> weights(8, 512);
+        std::vector<std::size_t> nodeIDs;
+        nodeIDs += 0, 1, 0, 1, 0, 1, 0, 1;
+
+        HierarchicalPartition<2, RecursiveBisectionPartition<2> > partition(
+            origin, dimensions, 0, weights, nodeIDs);
+        checkCoverage(partition, origin, dimensions, weights.size());
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<2> region = partition.getRegion(i);
+            TS_ASSERT_EQUALS(weights[i], region.size());
+            TS_ASSERT((region - partition.getNodeRegion(nodeIDs[i])).empty());
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(2048), partition.getNodeRegion(0).size());
+        TS_ASSERT_EQUALS(std::size_t(2048), partition.getNodeRegion(1).size());
+    }
+
+    void testIrregularNodeRegions()
+    {
+        // the Hilbert curve yields non-rectangular node subdomains,
+        // which then get split along a z-curve:
+        Coord<2> dimensions(60, 50);
+        std::vector<std::size_t> weights;
+        weights += 500, 400, 300, 200, 600, 1000;
+        std::vector<std::size_t> nodeIDs;
+        nodeIDs += 0, 1, 2, 0, 1, 2;
+
+        HierarchicalPartition<2, HilbertPartition, ZCurvePartition<2> > partition(
+            Coord<2>(), dimensions, 0, weights, nodeIDs);
+        checkCoverage(partition, Coord<2>(), dimensions, weights.size());
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<2> region = partition.getRegion(i);
+            TS_ASSERT((region - partition.getNodeRegion(nodeIDs[i])).empty());
+            TS_ASSERT_EQUALS(weights[i], region.size());
+        }
+    }
+
+    void testInterNodeSurfaceIsReduced()
+    {
+        // 4 nodes with 4 ranks each, placed so that a flat partition
+        // would scatter each node's ranks diagonally across the
+        // domain:
+        Coord<2> dimensions(256, 256);
+        std::vector<std::size_t> weights(16, 256 * 256 / 16);
+        std::vector<std::size_t> nodeIDs;
+        for (int i = 0; i < 16; ++i) {
+            nodeIDs << std::size_t((i % 4 + i / 4) % 4);
+        }
+
+        HierarchicalPartition<2, RecursiveBisectionPartition<2>, CheckerboardingPartition<2> > hierarchical(
+            Coord<2>(), dimensions, 0, weights, nodeIDs);
+        CheckerboardingPartition<2> flat(Coord<2>(), dimensions, 0, weights);
+        checkCoverage(hierarchical, Coord<2>(), dimensions, weights.size());
+
+        Region<2> domain;
+        domain << CoordBox<2>(Coord<2>(), dimensions);
+        std::size_t hierarchicalHalo = interNodeHalo(hierarchical, nodeIDs, domain);
+        std::size_t flatHalo = interNodeHalo(flat, nodeIDs, domain);
+        TS_ASSERT_LESS_THAN(2 * hierarchicalHalo, flatHalo);
+    }
+
+    void testCostMap()
+    {
+        Coord<2> dimensions(32, 32);
+        std::vector<std::size_t> weights(4, 256);
+        std::vector<std::size_t> nodeIDs;
+        nodeIDs += 0, 0, 1, 1;
+
+        // the left half of the domain is four times as expensive:
+        CoordBox<2> box(Coord<2>(), dimensions);
+        CostMap<2> costs(box);
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            costs.set(*i, (i->x() < 16) ? 4.0 : 1.0);
+        }
+
+        HierarchicalPartition<2, StripingPartition<2> > partition(
+            Coord<2>(), dimensions, 0, weights, nodeIDs);
+        TS_ASSERT(partition.supportsCostMaps());
+        partition.setCostMap(costs);
+        checkCoverage(partition, Coord<2>(), dimensions, weights.size());
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<2> region = partition.getRegion(i);
+            double cost = 0;
+            for (Region<2>::Iterator j = region.begin(); j != region.end(); ++j) {
+                cost += costs[*j];
+            }
+            // total cost is 2560, so each rank should get ~640:
+            TS_ASSERT_LESS_THAN(std::abs(cost - 640), 40);
+        }
+    }
+
+    void testInvalidNodeIDs()
+    {
+        std::vector<std::size_t> weights(4, 16);
+        std::vector<std::size_t> nodeIDs;
+        nodeIDs += 0, 1, 0;
+
+        TS_ASSERT_THROWS(
+            (HierarchicalPartition<2, StripingPartition<2> >(Coord<2>(), Coord<2>(8, 8), 0, weights, nodeIDs)),
+            std::invalid_argument&);
+    }
+
+private:
+    void checkCoverage(
+        const Partition<2>& partition,
+        const Coord<2>& origin,
+        const Coord<2>& dimensions,
+        std::size_t numRanks)
+    {
+        Region<2> whole;
+        for (std::size_t i = 0; i < numRanks; ++i) {
+            Region<2> region = partition.getRegion(i);
+            TS_ASSERT((whole & region).empty());
+            whole += region;
+        }
+
+        Region<2> expected;
+        expected << CoordBox<2>(origin, dimensions);
+        TS_ASSERT_EQUALS(expected, whole);
+    }
+
+    std::size_t interNodeHalo(
+        const Partition<2>& partition,
+        const std::vector<std::size_t>& nodeIDs,
+        const Region<2>& domain)
+    {
+        std::size_t numNodes = 0;
+        for (std::size_t i = 0; i < nodeIDs.size(); ++i) {
+            numNodes = (std::max)(numNodes, nodeIDs[i] + 1);
+        }
+
+        std::vector<Region<2> > nodeRegions(numNodes);
+        for (std::size_t i = 0; i < nodeIDs.size(); ++i) {
+            nodeRegions[nodeIDs[i]] += partition.getRegion(i);
+        }
+
+        std::size_t ret = 0;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            ret += ((nodeRegions[i].expand(1) & domain) - nodeRegions[i]).size();
+        }
+
+        return ret;
+    }
+};
+
+}
@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HilbertPartition3DTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/hilbertpartition3dtest.h"
+
+static HilbertPartition3DTest suite_HilbertPartition3DTest;
+
+static CxxTest::List Tests_HilbertPartition3DTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HilbertPartition3DTest( "/root/repo/src/geometry/partitions/test/unit/hilbertpartition3dtest.h", 11, "HilbertPartition3DTest", suite_HilbertPartition3DTest, Tests_HilbertPartition3DTest );
+
+static class TestDescription_suite_HilbertPartition3DTest_testCubeIsTraversedContinuously : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testCubeIsTraversedContinuously() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 16, "testCubeIsTraversedContinuously" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testCubeIsTraversedContinuously(); }
+} testDescription_suite_HilbertPartition3DTest_testCubeIsTraversedContinuously;
+
+static class TestDescription_suite_HilbertPartition3DTest_testFirstOctantIsCompletedFirst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testFirstOctantIsCompletedFirst() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 27, "testFirstOctantIsCompletedFirst" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testFirstOctantIsCompletedFirst(); }
+} testDescription_suite_HilbertPartition3DTest_testFirstOctantIsCompletedFirst;
+
+static class TestDescription_suite_HilbertPartition3DTest_testArbitraryDimensions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testArbitraryDimensions() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 36, "testArbitraryDimensions" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testArbitraryDimensions(); }
+} testDescription_suite_HilbertPartition3DTest_testArbitraryDimensions;
+
+static class TestDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 46, "testSquareBracketsOperatorVersusIteration" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testSquareBracketsOperatorVersusIteration(); }
+} testDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration;
+
+static class TestDescription_suite_HilbertPartition3DTest_testGetRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testGetRegion() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 66, "testGetRegion" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testGetRegion(); }
+} testDescription_suite_HilbertPartition3DTest_testGetRegion;
+
+static class TestDescription_suite_HilbertPartition3DTest_testRegionsAreCompact : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testRegionsAreCompact() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 87, "testRegionsAreCompact" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testRegionsAreCompact(); }
+} testDescription_suite_HilbertPartition3DTest_testRegionsAreCompact;
+
@@ -0,0 +1,140 @@
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+
+#include <boost/assign/std/vector.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace boost::assign;
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class HilbertPartition3DTest : public CxxTest::TestSuite
+{
+public:
+    typedef std::vector<Coord<3> > CoordVector;
+
+    void testCubeIsTraversedContinuously()
+    {
+        // for cubes with power-of-two dimensions successive cells
+        // need to be direct neighbors, in all orientations:
+        for (int form = 0; form < HilbertPartition3D::NUM_FORMS; ++form) {
+            checkContinuity(Coord<3>(10, 20, 30), Coord<3>(2, 2, 2), form);
+            checkContinuity(Coord<3>(10, 20, 30), Coord<3>(8, 8, 8), form);
+        }
+        checkContinuity(Coord<3>(0, 0, 0), Coord<3>(32, 32, 32), 0);
+    }
+
+    void testFirstOctantIsCompletedFirst()
+    {
+        HilbertPartition3D partition(Coord<3>(), Coord<3>(16, 16, 16));
+        HilbertPartition3D::Iterator i = partition.begin();
+        for (int counter = 0; counter < 8 * 8 * 8; ++counter, ++i) {
+            TS_ASSERT_EQUALS((*i) / 8, (*partition.begin()) / 8);
+        }
+    }
+
+    void testArbitraryDimensions()
+    {
+        checkCoverage(Coord<3>(10, 20, 30), Coord<3>(5, 3, 7));
+        checkCoverage(Coord<3>(10, 20, 30), Coord<3>(1, 6, 9));
+        checkCoverage(Coord<3>(10, 20, 30), Coord<3>(13, 1, 2));
+        checkCoverage(Coord<3>(10, 20, 30), Coord<3>(1, 1, 17));
+        checkCoverage(Coord<3>(-5, -5, -5), Coord<3>(64, 10, 3));
+        checkCoverage(Coord<3>(0, 0, 0), Coord<3>(33, 31, 29));
+    }
+
+    void testSquareBracketsOperatorVersusIteration()
+    {
+        Coord<3> offset(10, 20, 30);
+        Coord<3> dimensions(6, 35, 11);
+        HilbertPartition3D partition(offset, dimensions);
+
+        CoordVector expected;
+        for (int i = 0; i < dimensions.prod(); ++i) {
+            expected << *partition[i];
+        }
+
+        CoordVector actual;
+        for (HilbertPartition3D::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            actual << *i;
+        }
+
+        TS_ASSERT_EQUALS(expected, actual);
+        TS_ASSERT(partition[dimensions.prod()] == partition.end());
+    }
+
+    void testGetRegion()
+    {
+        Coord<3> origin(10, 20, 30);
+        Coord<3> dimensions(40, 30, 20);
+        std::vector<std::size_t> weights;
+        weights += 5000, 9000, 1000, 9000;
+        HilbertPartition3D partition(origin, dimensions, 0, weights);
+
+        Region<3> whole;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<3> region = partition.getRegion(i);
+            TS_ASSERT_EQUALS(weights[i], region.size());
+            TS_ASSERT((whole & region).empty());
+            whole += region;
+        }
+
+        Region<3> expected;
+        expected << CoordBox<3>(origin, dimensions);
+        TS_ASSERT_EQUALS(expected, whole);
+    }
+
+    void testRegionsAreCompact()
+    {
+        // the Hilbert curve should yield compact regions, even if
+        // the number of nodes isn't a power of two:
+        Coord<3> dimensions(64, 64, 64);
+        std::vector<std::size_t> weights(7, dimensions.prod() / 7);
+        weights.back() += dimensions.prod() - sum(weights);
+        HilbertPartition3D partition(Coord<3>(), dimensions, 0, weights);
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<3> region = partition.getRegion(i);
+            std::size_t surface = region.expand(1).size() - region.size();
+            // a cube of equal volume would have a surface of ~ 7500 cells:
+            TS_ASSERT_LESS_THAN(surface, std::size_t(16000));
+        }
+    }
+
+private:
+    void checkContinuity(const Coord<3>& origin, const Coord<3>& dimensions, int form)
+    {
+        HilbertPartition3D::Iterator end(origin);
+        HilbertPartition3D::Iterator i(origin, dimensions, 0, form);
+        Coord<3> last = *i;
+        int counter = 1;
+
+        for (++i; i != end; ++i) {
+            Coord<3> delta = *i - last;
+            TS_ASSERT_EQUALS(1, std::abs(delta.x()) + std::abs(delta.y()) + std::abs(delta.z()));
+            last = *i;
+            ++counter;
+        }
+
+        TS_ASSERT_EQUALS(dimensions.prod(), counter);
+    }
+
+    void checkCoverage(const Coord<3>& origin, const Coord<3>& dimensions)
+    {
+        HilbertPartition3D partition(origin, dimensions);
+        CoordBox<3> box(origin, dimensions);
+        std::set<Coord<3> > visited;
+        int counter = 0;
+
+        for (HilbertPartition3D::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            TS_ASSERT(box.inBounds(*i));
+            visited.insert(*i);
+            ++counter;
+        }
+
+        TS_ASSERT_EQUALS(dimensions.prod(), counter);
+        TS_ASSERT_EQUALS(std::size_t(dimensions.prod()), visited.size());
+    }
+};
+
+}
@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MultilevelUnstructuredPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/multilevelunstructuredpartitiontest.h"
+
+static MultilevelUnstructuredPartitionTest suite_MultilevelUnstructuredPartitionTest;
+
+static CxxTest::List Tests_MultilevelUnstructuredPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MultilevelUnstructuredPartitionTest( "/root/repo/src/geometry/partitions/test/unit/multilevelunstructuredpartitiontest.h", 12, "MultilevelUnstructuredPartitionTest", suite_MultilevelUnstructuredPartitionTest, Tests_MultilevelUnstructuredPartitionTest );
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testEmpty() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 15, "testEmpty" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testEmpty(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testEmpty;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testSingleDomain : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testSingleDomain() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 27, "testSingleDomain" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testSingleDomain(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testSingleDomain;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testRing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testRing() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 42, "testRing" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testRing(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testRing;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testScrambledMesh : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testScrambledMesh() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 56, "testScrambledMesh" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testScrambledMesh(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testScrambledMesh;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testZeroWeights : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testZeroWeights() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 101, "testZeroWeights" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testZeroWeights(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testZeroWeights;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testGraphWithoutEdges : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testGraphWithoutEdges() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 113, "testGraphWithoutEdges" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testGraphWithoutEdges(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testGraphWithoutEdges;
+
+static class TestDescription_suite_MultilevelUnstructuredPartitionTest_testStar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultilevelUnstructuredPartitionTest_testStar() : CxxTest::RealTestDescription( Tests_MultilevelUnstructuredPartitionTest, suiteDescription_MultilevelUnstructuredPartitionTest, 128, "testStar" ) {}
+ void runTest() { suite_MultilevelUnstructuredPartitionTest.testStar(); }
+} testDescription_suite_MultilevelUnstructuredPartitionTest_testStar;
+
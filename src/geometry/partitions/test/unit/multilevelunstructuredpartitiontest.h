@@ -0,0 +1,197 @@
+#include <libgeodecomp/geometry/partitions/multilevelunstructuredpartition.h>
+#include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
+
+#include <boost/assign/std/vector.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+using namespace boost::assign;
+
+namespace LibGeoDecomp {
+
+class MultilevelUnstructuredPartitionTest : public CxxTest::TestSuite
+{
+public:
+    void testEmpty()
+    {
+        std::vector<std::size_t> weights;
+        weights += 0, 0;
+        Adjacency adjacency;
+
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(0), 0, weights, adjacency);
+        TS_ASSERT(partition.getRegion(0).empty());
+        TS_ASSERT(partition.getRegion(1).empty());
+        TS_ASSERT_EQUALS(std::size_t(0), partition.getEdgeCut());
+    }
+
+    void testSingleDomain()
+    {
+        std::vector<std::size_t> weights;
+        weights += 100;
+        Adjacency adjacency = ringAdjacency(50, 100);
+
+        MultilevelUnstructuredPartition partition(Coord<1>(50), Coord<1>(100), 0, weights, adjacency);
+        Region<1> expected;
+        expected << Streak<1>(Coord<1>(50), 150);
+
+        TS_ASSERT_EQUALS(expected, partition.getRegion(0));
+        TS_ASSERT_EQUALS(std::size_t(0), partition.getEdgeCut());
+        TS_ASSERT_EQUALS(0.0, partition.getImbalance());
+    }
+
+    void testRing()
+    {
+        std::vector<std::size_t> weights;
+        weights += 250, 250, 500;
+        Adjacency adjacency = ringAdjacency(0, 1000);
+
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(1000), 0, weights, adjacency);
+        checkCoverage(partition, weights, 1000);
+
+        // optimum would be 3 cut edges, give the heuristic some slack:
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getEdgeCut(), std::size_t(12));
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getImbalance(), 0.05);
+    }
+
+    void testScrambledMesh()
+    {
+        // a 64x64 mesh whose cell IDs are shuffled by a fixed
+        // permutation, this is the worst case for striping:
+        int width = 64;
+        int numCells = width * width;
+        std::vector<int> ids(numCells);
+        for (int i = 0; i < numCells; ++i) {
+            ids[i] = (i * 1021) % numCells;
+        }
+
+        Adjacency adjacency;
+        for (int y = 0; y < width; ++y) {
+            for (int x = 0; x < width; ++x) {
+                std::vector<int>& neighbors = adjacency[ids[y * width + x]];
+                if (x > 0) {
+                    neighbors << ids[y * width + x - 1];
+                }
+                if (x < (width - 1)) {
+                    neighbors << ids[y * width + x + 1];
+                }
+                if (y > 0) {
+                    neighbors << ids[(y - 1) * width + x];
+                }
+                if (y < (width - 1)) {
+                    neighbors << ids[(y + 1) * width + x];
+                }
+            }
+        }
+
+        std::vector<std::size_t> weights(8, numCells / 8);
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(numCells), 0, weights, adjacency);
+        checkCoverage(partition, weights, numCells);
+
+        UnstructuredStripingPartition striping(Coord<1>(0), Coord<1>(numCells), 0, weights);
+        std::size_t stripingCut = edgeCut(striping, adjacency, weights.size());
+        TS_ASSERT_EQUALS(partition.getEdgeCut(), edgeCut(partition, adjacency, weights.size()));
+
+        // 4x2 rectangular blocks would cut 256 edges, each of which
+        // is listed twice in the adjacency:
+        TS_ASSERT_LESS_THAN(partition.getEdgeCut(), std::size_t(2 * 600));
+        TS_ASSERT_LESS_THAN(5 * partition.getEdgeCut(), stripingCut);
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getImbalance(), 0.05);
+    }
+
+    void testZeroWeights()
+    {
+        std::vector<std::size_t> weights;
+        weights += 300, 0, 200, 0;
+        Adjacency adjacency = ringAdjacency(0, 500);
+
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(500), 0, weights, adjacency);
+        checkCoverage(partition, weights, 500);
+        TS_ASSERT(partition.getRegion(1).empty());
+        TS_ASSERT(partition.getRegion(3).empty());
+    }
+
+    void testGraphWithoutEdges()
+    {
+        // coarsening can't do anything here, so the whole graph gets
+        // partitioned directly:
+        int numCells = 200000;
+        std::vector<std::size_t> weights(7, numCells / 7);
+        weights[6] += numCells % 7;
+        Adjacency adjacency;
+
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(numCells), 0, weights, adjacency);
+        checkCoverage(partition, weights, numCells);
+        TS_ASSERT_EQUALS(std::size_t(0), partition.getEdgeCut());
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getImbalance(), 0.05);
+    }
+
+    void testStar()
+    {
+        int numCells = 100000;
+        Adjacency adjacency;
+        for (int i = 1; i < numCells; ++i) {
+            adjacency[0] << i;
+        }
+
+        std::vector<std::size_t> weights(4, numCells / 4);
+        MultilevelUnstructuredPartition partition(Coord<1>(0), Coord<1>(numCells), 0, weights, adjacency);
+        checkCoverage(partition, weights, numCells);
+
+        // the center's node keeps its share of the spokes, all
+        // others are cut off:
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getEdgeCut(), std::size_t(numCells * 3 / 4 + 10));
+        TS_ASSERT_LESS_THAN_EQUALS(partition.getImbalance(), 0.05);
+    }
+
+private:
+    Adjacency ringAdjacency(int origin, int size)
+    {
+        Adjacency adjacency;
+        for (int i = 0; i < size; ++i) {
+            adjacency[origin + i] << origin + (i + 1) % size;
+        }
+
+        return adjacency;
+    }
+
+    void checkCoverage(const Partition<1>& partition, const std::vector<std::size_t>& weights, int numCells)
+    {
+        Region<1> all;
+        std::size_t totalSize = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<1> region = partition.getRegion(i);
+            TS_ASSERT((all & region).empty());
+            all += region;
+            totalSize += region.size();
+        }
+
+        Region<1> expected;
+        expected << Streak<1>(Coord<1>(0), numCells);
+        TS_ASSERT_EQUALS(expected, all);
+        TS_ASSERT_EQUALS(std::size_t(numCells), totalSize);
+    }
+
+    std::size_t edgeCut(const Partition<1>& partition, const Adjacency& adjacency, std::size_t numNodes)
+    {
+        std::map<int, std::size_t> owners;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            Region<1> region = partition.getRegion(i);
+            for (Region<1>::Iterator j = region.begin(); j != region.end(); ++j) {
+                owners[j->x()] = i;
+            }
+        }
+
+        std::size_t ret = 0;
+        for (Adjacency::const_iterator i = adjacency.begin(); i != adjacency.end(); ++i) {
+            for (std::vector<int>::const_iterator j = i->second.begin(); j != i->second.end(); ++j) {
+                if (owners[i->first] != owners[*j]) {
+                    ++ret;
+                }
+            }
+        }
+
+        return ret;
+    }
+};
+
+}
@@ -99,6 +99,53 @@ public:
             std::invalid_argument);
     }
 
+    void testCostMap()
+    {
+        // cells with x < 10 cost three times as much as the rest, so
+        // the cost median lies at x = 10:
+        Coord<2> dimensions(40, 10);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), dimensions), Coord<2>(10, 10), 1.0);
+        costs.set(Coord<2>(0, 0), 3.0);
+
+        std::vector<std::size_t> weights;
+        weights += 1, 1;
+        RecursiveBisectionPartition<2> p(Coord<2>(), dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        TS_ASSERT_EQUALS(genRegion2D( 0, 0, 10, 10), p.getRegion(0));
+        TS_ASSERT_EQUALS(genRegion2D(10, 0, 30, 10), p.getRegion(1));
+    }
+
+    void testCostConcentratedInCorner()
+    {
+        // all cost lies in one cell, but every node has a non-zero
+        // weight and hence needs to receive some cells:
+        Coord<2> dimensions(16, 16);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), dimensions), Coord<2>::diagonal(1), 0.0);
+        costs.set(Coord<2>(0, 0), 100.0);
+
+        std::vector<std::size_t> weights;
+        weights += 1, 1, 1, 1;
+        RecursiveBisectionPartition<2> p(Coord<2>(), dimensions, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> all;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<2> region = p.getRegion(i);
+            TS_ASSERT(!region.empty());
+            TS_ASSERT((all & region).empty());
+            all += region;
+        }
+        TS_ASSERT_EQUALS(genRegion2D(0, 0, 16, 16), all);
+    }
+
+    Region<2> genRegion2D(int o1, int o2, int d1, int d2)
+    {
+        Region<2> r;
+        r << CoordBox<2>(Coord<2>(o1, o2), Coord<2>(d1, d2));
+        return r;
+    }
+
     void checkCuboid(std::vector<std::size_t> weights, long node, Coord<2> expectedOffset, Coord<2> expectedDim, Coord<2> dimensions=Coord<2>(30, 20), Coord<2> dimWeights=Coord<2>::diagonal(1))
     {
         Coord<2> origin(0, 0);
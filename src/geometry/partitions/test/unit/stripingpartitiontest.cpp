@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StripingPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/stripingpartitiontest.h"
+
+static StripingPartitionTest suite_StripingPartitionTest;
+
+static CxxTest::List Tests_StripingPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StripingPartitionTest( "/root/repo/src/geometry/partitions/test/unit/stripingpartitiontest.h", 12, "StripingPartitionTest", suite_StripingPartitionTest, Tests_StripingPartitionTest );
+
+static class TestDescription_suite_StripingPartitionTest_testSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testSimple() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 34, "testSimple" ) {}
+ void runTest() { suite_StripingPartitionTest.testSimple(); }
+} testDescription_suite_StripingPartitionTest_testSimple;
+
+static class TestDescription_suite_StripingPartitionTest_testVertical : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testVertical() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 40, "testVertical" ) {}
+ void runTest() { suite_StripingPartitionTest.testVertical(); }
+} testDescription_suite_StripingPartitionTest_testVertical;
+
+static class TestDescription_suite_StripingPartitionTest_testHorizontal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testHorizontal() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 46, "testHorizontal" ) {}
+ void runTest() { suite_StripingPartitionTest.testHorizontal(); }
+} testDescription_suite_StripingPartitionTest_testHorizontal;
+
+static class TestDescription_suite_StripingPartitionTest_testNormal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testNormal() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 52, "testNormal" ) {}
+ void runTest() { suite_StripingPartitionTest.testNormal(); }
+} testDescription_suite_StripingPartitionTest_testNormal;
+
+static class TestDescription_suite_StripingPartitionTest_testOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testOffset() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 62, "testOffset" ) {}
+ void runTest() { suite_StripingPartitionTest.testOffset(); }
+} testDescription_suite_StripingPartitionTest_testOffset;
+
+static class TestDescription_suite_StripingPartitionTest_testSquareBracketsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testSquareBracketsOperator() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 68, "testSquareBracketsOperator" ) {}
+ void runTest() { suite_StripingPartitionTest.testSquareBracketsOperator(); }
+} testDescription_suite_StripingPartitionTest_testSquareBracketsOperator;
+
+static class TestDescription_suite_StripingPartitionTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_test3D() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 81, "test3D" ) {}
+ void runTest() { suite_StripingPartitionTest.test3D(); }
+} testDescription_suite_StripingPartitionTest_test3D;
+
+static class TestDescription_suite_StripingPartitionTest_testCostMap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testCostMap() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 103, "testCostMap" ) {}
+ void runTest() { suite_StripingPartitionTest.testCostMap(); }
+} testDescription_suite_StripingPartitionTest_testCostMap;
+
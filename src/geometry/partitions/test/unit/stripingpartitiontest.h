@@ -100,6 +100,33 @@ public:
         TS_ASSERT_EQUALS(expected, actual);
     }
 
+    void testCostMap()
+    {
+        // the left half of the domain is free, so the cut moves from
+        // the middle of the domain to the end of the second row:
+        Coord<2> origin(10, 20);
+        Coord<2> dim(8, 4);
+        CostMap<2> costs(CoordBox<2>(origin, dim));
+        for (int y = 0; y < 4; ++y) {
+            costs.set(Streak<2>(Coord<2>(10, 20 + y), 14), 0.0);
+        }
+
+        std::vector<std::size_t> weights;
+        weights += 16, 16;
+        StripingPartition<2> p(origin, dim, 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        expected0 << Streak<2>(Coord<2>(10, 20), 18)
+                  << Streak<2>(Coord<2>(10, 21), 18);
+        Region<2> expected1;
+        expected1 << Streak<2>(Coord<2>(10, 22), 18)
+                  << Streak<2>(Coord<2>(10, 23), 18);
+
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+    }
+
 private:
     CoordVector  expected;
 };
@@ -172,6 +172,53 @@ public:
     }
 
 
+    void testCostMap()
+    {
+        // cells on the upper half of the 4x4 square are free, so the
+        // first node gets three quadrants instead of two:
+        CostMap<2> costs(CoordBox<2>(Coord<2>(10, 20), Coord<2>(4, 4)));
+        for (int y = 20; y < 22; ++y) {
+            costs.set(Streak<2>(Coord<2>(10, y), 14), 0.0);
+        }
+
+        std::vector<std::size_t> weights;
+        weights += 8, 8;
+        ZCurvePartition<2> p(Coord<2>(10, 20), Coord<2>(4, 4), 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        expected0 << CoordBox<2>(Coord<2>(10, 20), Coord<2>(4, 2))
+                  << CoordBox<2>(Coord<2>(10, 22), Coord<2>(2, 2));
+        Region<2> expected1;
+        expected1 << CoordBox<2>(Coord<2>(12, 22), Coord<2>(2, 2));
+
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+    }
+
+    void testCostMapWithoutCosts()
+    {
+        // without any cost the cells are distributed by count:
+        CostMap<2> costs(CoordBox<2>(Coord<2>(10, 20), Coord<2>(4, 4)), Coord<2>(1, 1), 0.0);
+
+        std::vector<std::size_t> weights;
+        weights += 4, 8, 4;
+        ZCurvePartition<2> p(Coord<2>(10, 20), Coord<2>(4, 4), 0, weights);
+        p.setCostMap(costs);
+
+        Region<2> expected0;
+        expected0 << CoordBox<2>(Coord<2>(10, 20), Coord<2>(2, 2));
+        Region<2> expected1;
+        expected1 << CoordBox<2>(Coord<2>(12, 20), Coord<2>(2, 2))
+                  << CoordBox<2>(Coord<2>(10, 22), Coord<2>(2, 2));
+        Region<2> expected2;
+        expected2 << CoordBox<2>(Coord<2>(12, 22), Coord<2>(2, 2));
+
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+        TS_ASSERT_EQUALS(expected2, p.getRegion(2));
+    }
+
 private:
     ZCurvePartition<2> partition;
     CoordVector expected, actual;
@@ -302,6 +302,25 @@ public:
             (*this)[startOffsets[node + 1]]);
     }
 
+    void setCostMap(const CostMap<DIM>& costs)
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        this->splitByCost(
+            (*this)[startOffsets.front()],
+            (*this)[startOffsets.back()],
+            costs);
+    }
+
+    bool supportsCostMaps() const
+#ifdef LIBGEODECOMP_WITH_CPP14
+        override
+#endif
+    {
+        return true;
+    }
+
     static inline bool fillCaches()
     {
         // store squares of at most maxDim in size. the division by
@@ -0,0 +1,127 @@
+#ifndef LIBGEODECOMP_GEOMETRY_REGIONTILER_H
+#define LIBGEODECOMP_GEOMETRY_REGIONTILER_H
+
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Chops a Region into tiles for spatial cache blocking. Tiles always
+ * span the whole extent of the Region along the x-axis (so streaks
+ * are never split and vectorized line updates stay intact) and are
+ * blocked along the y- and z-axes. Updating a 3D region tile by tile
+ * means that only the three planes of a tile (plus stencil radius)
+ * need to stay in cache, instead of three full planes of the grid.
+ *
+ * Since the tiles are assembled from the Region's streaks, this
+ * works for arbitrary (e.g. irregular, or rim-shaped) regions, too.
+ * Empty tiles are omitted.
+ */
+template<int DIM>
+class RegionTiler
+{
+public:
+    /**
+     * The L2 cache size assumed by autoTileDimensions() if none is
+     * given. Conservative for current x86 cores.
+     */
+    static const std::size_t DEFAULT_CACHE_SIZE = 256 * 1024;
+
+    /**
+     * Tiles will be at most tileDimensions in size along the y- and
+     * z-axes. The x component is ignored.
+     */
+    static std::vector<Region<DIM> > tile(const Region<DIM>& region, const Coord<DIM>& tileDimensions)
+    {
+        std::vector<Region<DIM> > ret;
+        if (region.empty()) {
+            return ret;
+        }
+        if (DIM == 1) {
+            ret << region;
+            return ret;
+        }
+
+        for (int i = 1; i < DIM; ++i) {
+            if (tileDimensions[i] <= 0) {
+                throw std::invalid_argument("RegionTiler needs positive tile dimensions");
+            }
+        }
+
+        CoordBox<DIM> box = region.boundingBox();
+        Coord<DIM> tiles = Coord<DIM>::diagonal(1);
+        for (int i = 1; i < DIM; ++i) {
+            tiles[i] = (box.dimensions[i] + tileDimensions[i] - 1) / tileDimensions[i];
+        }
+        ret.resize(tiles.prod());
+
+        // each streak belongs to exactly one tile and the region's
+        // streaks are sorted, so appending keeps each tile sorted,
+        // too:
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Streak<DIM> streak = *i;
+            std::size_t index = 0;
+            for (int d = DIM - 1; d > 0; --d) {
+                index *= tiles[d];
+                index += (streak.origin[d] - box.origin[d]) / tileDimensions[d];
+            }
+            ret[index] << streak;
+        }
+
+        ret.erase(std::remove_if(ret.begin(), ret.end(), isEmpty), ret.end());
+        return ret;
+    }
+
+    /**
+     * Suggests tile dimensions for a grid of the given dimensions:
+     * tiles are made as large as possible along the y-axis, so that
+     * three planes of a tile (plus one row above and below) still
+     * fit into the cache. Returns a zero Coord if no tiling is
+     * required, i.e. if three full planes of the grid fit into the
+     * cache anyway (which is always the case in 1D and 2D).
+     */
+    static Coord<DIM> autoTileDimensions(
+        const Coord<DIM>& dimensions,
+        const std::size_t cellSize,
+        const std::size_t cacheSize = DEFAULT_CACHE_SIZE)
+    {
+        if (DIM < 3) {
+            return Coord<DIM>();
+        }
+
+        std::size_t rowSize = (std::max)(1, dimensions[0]) * cellSize;
+        std::size_t planeSize = rowSize * (std::max)(1, dimensions[1]);
+        if ((3 * planeSize) <= cacheSize) {
+            return Coord<DIM>();
+        }
+
+        Coord<DIM> ret = Coord<DIM>::diagonal(1);
+        ret[0] = dimensions[0];
+        ret[1] = (std::max)(1, static_cast<int>(cacheSize / (3 * rowSize)) - 2);
+        // tiles should be deep enough to amortize the reload of the
+        // first two planes, but shallow enough to give all threads
+        // something to do:
+        for (int i = 2; i < DIM; ++i) {
+            ret[i] = (std::min)(dimensions[i], int(MAX_TILE_DEPTH));
+        }
+
+        return ret;
+    }
+
+private:
+    static const int MAX_TILE_DEPTH = 32;
+
+    static bool isEmpty(const Region<DIM>& region)
+    {
+        return region.empty();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CostMapTest_init = false;
+#include "/root/repo/src/geometry/test/unit/costmaptest.h"
+
+static CostMapTest suite_CostMapTest;
+
+static CxxTest::List Tests_CostMapTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CostMapTest( "/root/repo/src/geometry/test/unit/costmaptest.h", 10, "CostMapTest", suite_CostMapTest, Tests_CostMapTest );
+
+static class TestDescription_suite_CostMapTest_testDefaultCost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testDefaultCost() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 13, "testDefaultCost" ) {}
+ void runTest() { suite_CostMapTest.testDefaultCost(); }
+} testDescription_suite_CostMapTest_testDefaultCost;
+
+static class TestDescription_suite_CostMapTest_testBlocks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testBlocks() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 23, "testBlocks" ) {}
+ void runTest() { suite_CostMapTest.testBlocks(); }
+} testDescription_suite_CostMapTest_testBlocks;
+
+static class TestDescription_suite_CostMapTest_testStreak : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testStreak() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 38, "testStreak" ) {}
+ void runTest() { suite_CostMapTest.testStreak(); }
+} testDescription_suite_CostMapTest_testStreak;
+
+static class TestDescription_suite_CostMapTest_testMarginal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testMarginal() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 49, "testMarginal" ) {}
+ void runTest() { suite_CostMapTest.testMarginal(); }
+} testDescription_suite_CostMapTest_testMarginal;
+
+static class TestDescription_suite_CostMapTest_testSample : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testSample() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 64, "testSample" ) {}
+ void runTest() { suite_CostMapTest.testSample(); }
+} testDescription_suite_CostMapTest_testSample;
+
+static class TestDescription_suite_CostMapTest_testAccumulate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testAccumulate() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 79, "testAccumulate" ) {}
+ void runTest() { suite_CostMapTest.testAccumulate(); }
+} testDescription_suite_CostMapTest_testAccumulate;
+
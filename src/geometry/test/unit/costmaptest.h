@@ -0,0 +1,124 @@
+#include <libgeodecomp/geometry/costmap.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CostMapTest : public CxxTest::TestSuite
+{
+public:
+    void testDefaultCost()
+    {
+        CostMap<2> costs(CoordBox<2>(Coord<2>(10, 20), Coord<2>(30, 40)), Coord<2>::diagonal(1), 2.5);
+        TS_ASSERT_EQUALS(2.5, costs[Coord<2>(10, 20)]);
+        TS_ASSERT_EQUALS(2.5, costs[Coord<2>(39, 59)]);
+        TS_ASSERT_EQUALS(2.5 * 30 * 40, costs.sum(CoordBox<2>(Coord<2>(10, 20), Coord<2>(30, 40))));
+        // cells outside of the map are ignored:
+        TS_ASSERT_EQUALS(2.5 * 10 * 5, costs.sum(CoordBox<2>(Coord<2>(0, 0), Coord<2>(20, 25))));
+    }
+
+    void testBlocks()
+    {
+        CostMap<3> costs(CoordBox<3>(Coord<3>(), Coord<3>(10, 10, 10)), Coord<3>(4, 4, 4));
+        costs.set(Coord<3>(5, 6, 7), 3.0);
+
+        TS_ASSERT_EQUALS(3.0, costs[Coord<3>(4, 4, 4)]);
+        TS_ASSERT_EQUALS(3.0, costs[Coord<3>(7, 7, 7)]);
+        TS_ASSERT_EQUALS(1.0, costs[Coord<3>(8, 7, 7)]);
+        TS_ASSERT_EQUALS(1.0, costs[Coord<3>(3, 4, 4)]);
+
+        // incomplete blocks at the upper boundary:
+        costs.set(Coord<3>(9, 9, 9), 0.0);
+        TS_ASSERT_EQUALS(0.0, costs[Coord<3>(8, 8, 8)]);
+    }
+
+    void testStreak()
+    {
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), Coord<2>(20, 10)), Coord<2>(4, 1));
+        costs.set(Streak<2>(Coord<2>(2, 5), 9), 0.5);
+
+        TS_ASSERT_EQUALS(1.0, costs[Coord<2>(2, 4)]);
+        TS_ASSERT_EQUALS(0.5, costs[Coord<2>(0, 5)]);
+        TS_ASSERT_EQUALS(0.5, costs[Coord<2>(11, 5)]);
+        TS_ASSERT_EQUALS(1.0, costs[Coord<2>(12, 5)]);
+    }
+
+    void testMarginal()
+    {
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), Coord<2>(4, 3)));
+        costs.set(Coord<2>(1, 0), 5.0);
+        costs.set(Coord<2>(3, 2), 0.0);
+
+        std::vector<double> expectedX;
+        expectedX << 3.0 << 7.0 << 3.0 << 2.0;
+        TS_ASSERT_EQUALS(expectedX, costs.marginal(CoordBox<2>(Coord<2>(), Coord<2>(4, 3)), 0));
+
+        std::vector<double> expectedY;
+        expectedY << 3.0 << 2.0;
+        TS_ASSERT_EQUALS(expectedY, costs.marginal(CoordBox<2>(Coord<2>(1, 1), Coord<2>(3, 2)), 1));
+    }
+
+    void testSample()
+    {
+        Grid<int> grid(Coord<2>(4, 4), 1);
+        grid[Coord<2>(0, 0)] = 4;
+        grid[Coord<2>(3, 3)] = 0;
+
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), Coord<2>(4, 4)), Coord<2>(2, 2));
+        costs.sample(grid, CellCost());
+
+        TS_ASSERT_EQUALS(3.5, costs[Coord<2>(0, 0)]);
+        TS_ASSERT_EQUALS(2.0, costs[Coord<2>(2, 0)]);
+        TS_ASSERT_EQUALS(2.0, costs[Coord<2>(0, 2)]);
+        TS_ASSERT_EQUALS(1.5, costs[Coord<2>(2, 2)]);
+    }
+
+    void testAccumulate()
+    {
+        Grid<int> grid(Coord<2>(4, 4), 1);
+        grid[Coord<2>(0, 0)] = 4;
+        grid[Coord<2>(3, 3)] = 0;
+
+        // two disjoint parts, as owned by two processes:
+        Region<2> left;
+        Region<2> right;
+        left  << CoordBox<2>(Coord<2>(0, 0), Coord<2>(1, 4));
+        right << CoordBox<2>(Coord<2>(1, 0), Coord<2>(3, 4));
+
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), Coord<2>(4, 4)), Coord<2>(2, 2));
+        TS_ASSERT_EQUALS(Coord<2>(2, 2), costs.getNumBlocks());
+        std::vector<double> sums(4, 0);
+        std::vector<double> counts(4, 0);
+        costs.accumulate(grid, left,  CellCost(), &sums, &counts);
+        costs.accumulate(grid, right, CellCost(), &sums, &counts);
+        costs.setAverages(sums, counts);
+
+        TS_ASSERT_EQUALS(3.5, costs[Coord<2>(0, 0)]);
+        TS_ASSERT_EQUALS(2.0, costs[Coord<2>(2, 0)]);
+        TS_ASSERT_EQUALS(1.5, costs[Coord<2>(2, 2)]);
+
+        // blocks without samples keep their cost:
+        CostMap<2> partial(CoordBox<2>(Coord<2>(), Coord<2>(4, 4)), Coord<2>(2, 2), 7.0);
+        std::fill(sums.begin(), sums.end(), 0);
+        std::fill(counts.begin(), counts.end(), 0);
+        partial.accumulate(grid, left, CellCost(), &sums, &counts);
+        partial.setAverages(sums, counts);
+        TS_ASSERT_EQUALS(5.0, partial[Coord<2>(0, 0)]);
+        TS_ASSERT_EQUALS(7.0, partial[Coord<2>(2, 0)]);
+    }
+
+private:
+    class CellCost
+    {
+    public:
+        double operator()(int cell) const
+        {
+            return 2 * cell;
+        }
+    };
+};
+
+}
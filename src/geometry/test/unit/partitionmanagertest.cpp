@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PartitionManagerTest_init = false;
+#include "/root/repo/src/geometry/test/unit/partitionmanagertest.h"
+
+static PartitionManagerTest suite_PartitionManagerTest;
+
+static CxxTest::List Tests_PartitionManagerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PartitionManagerTest( "/root/repo/src/geometry/test/unit/partitionmanagertest.h", 12, "PartitionManagerTest", suite_PartitionManagerTest, Tests_PartitionManagerTest );
+
+static class TestDescription_suite_PartitionManagerTest_testResetRegionsAndGhostRegionFragments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testResetRegionsAndGhostRegionFragments() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 79, "testResetRegionsAndGhostRegionFragments" ) {}
+ void runTest() { suite_PartitionManagerTest.testResetRegionsAndGhostRegionFragments(); }
+} testDescription_suite_PartitionManagerTest_testResetRegionsAndGhostRegionFragments;
+
+static class TestDescription_suite_PartitionManagerTest_testResetRegionsAndExtendedRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testResetRegionsAndExtendedRegions() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 98, "testResetRegionsAndExtendedRegions" ) {}
+ void runTest() { suite_PartitionManagerTest.testResetRegionsAndExtendedRegions(); }
+} testDescription_suite_PartitionManagerTest_testResetRegionsAndExtendedRegions;
+
+static class TestDescription_suite_PartitionManagerTest_testResetRegionsAndOuterAndInnerRims : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testResetRegionsAndOuterAndInnerRims() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 116, "testResetRegionsAndOuterAndInnerRims" ) {}
+ void runTest() { suite_PartitionManagerTest.testResetRegionsAndOuterAndInnerRims(); }
+} testDescription_suite_PartitionManagerTest_testResetRegionsAndOuterAndInnerRims;
+
+static class TestDescription_suite_PartitionManagerTest_testResetRegionsAndInnerSets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testResetRegionsAndInnerSets() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 125, "testResetRegionsAndInnerSets" ) {}
+ void runTest() { suite_PartitionManagerTest.testResetRegionsAndInnerSets(); }
+} testDescription_suite_PartitionManagerTest_testResetRegionsAndInnerSets;
+
+static class TestDescription_suite_PartitionManagerTest_testGetOuterRim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testGetOuterRim() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 133, "testGetOuterRim" ) {}
+ void runTest() { suite_PartitionManagerTest.testGetOuterRim(); }
+} testDescription_suite_PartitionManagerTest_testGetOuterRim;
+
+static class TestDescription_suite_PartitionManagerTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_test3D() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 140, "test3D" ) {}
+ void runTest() { suite_PartitionManagerTest.test3D(); }
+} testDescription_suite_PartitionManagerTest_test3D;
+
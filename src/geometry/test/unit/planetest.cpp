@@ -0,0 +1,103 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PlaneTest_init = false;
+#include "/root/repo/src/geometry/test/unit/planetest.h"
+
+static PlaneTest suite_PlaneTest;
+
+static CxxTest::List Tests_PlaneTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PlaneTest( "/root/repo/src/geometry/test/unit/planetest.h", 9, "PlaneTest", suite_PlaneTest, Tests_PlaneTest );
+
+static class TestDescription_suite_PlaneTest_testIsOnTop2DSpaceA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop2DSpaceA() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 12, "testIsOnTop2DSpaceA" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop2DSpaceA(); }
+} testDescription_suite_PlaneTest_testIsOnTop2DSpaceA;
+
+static class TestDescription_suite_PlaneTest_testIsOnTop2DSpaceB : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop2DSpaceB() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 29, "testIsOnTop2DSpaceB" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop2DSpaceB(); }
+} testDescription_suite_PlaneTest_testIsOnTop2DSpaceB;
+
+static class TestDescription_suite_PlaneTest_testIsOnTop2DSpaceC : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop2DSpaceC() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 46, "testIsOnTop2DSpaceC" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop2DSpaceC(); }
+} testDescription_suite_PlaneTest_testIsOnTop2DSpaceC;
+
+static class TestDescription_suite_PlaneTest_testIsOnTop2DSpaceD : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop2DSpaceD() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 63, "testIsOnTop2DSpaceD" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop2DSpaceD(); }
+} testDescription_suite_PlaneTest_testIsOnTop2DSpaceD;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceA() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 80, "testIsOnTopWithFloatCoordAnd2DSpaceA" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd2DSpaceA(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceA;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceB : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceB() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 97, "testIsOnTopWithFloatCoordAnd2DSpaceB" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd2DSpaceB(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceB;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceC : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceC() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 114, "testIsOnTopWithFloatCoordAnd2DSpaceC" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd2DSpaceC(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceC;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceD : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceD() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 131, "testIsOnTopWithFloatCoordAnd2DSpaceD" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd2DSpaceD(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd2DSpaceD;
+
+static class TestDescription_suite_PlaneTest_testIsOnTop3DSpaceA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop3DSpaceA() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 148, "testIsOnTop3DSpaceA" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop3DSpaceA(); }
+} testDescription_suite_PlaneTest_testIsOnTop3DSpaceA;
+
+static class TestDescription_suite_PlaneTest_testIsOnTop3DSpaceB : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTop3DSpaceB() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 167, "testIsOnTop3DSpaceB" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTop3DSpaceB(); }
+} testDescription_suite_PlaneTest_testIsOnTop3DSpaceB;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceA() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 186, "testIsOnTopWithFloatCoordAnd3DSpaceA" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd3DSpaceA(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceA;
+
+static class TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceB : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceB() : CxxTest::RealTestDescription( Tests_PlaneTest, suiteDescription_PlaneTest, 205, "testIsOnTopWithFloatCoordAnd3DSpaceB" ) {}
+ void runTest() { suite_PlaneTest.testIsOnTopWithFloatCoordAnd3DSpaceB(); }
+} testDescription_suite_PlaneTest_testIsOnTopWithFloatCoordAnd3DSpaceB;
+
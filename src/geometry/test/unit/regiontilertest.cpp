@@ -0,0 +1,69 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionTilerTest_init = false;
+#include "/root/repo/src/geometry/test/unit/regiontilertest.h"
+
+static RegionTilerTest suite_RegionTilerTest;
+
+static CxxTest::List Tests_RegionTilerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionTilerTest( "/root/repo/src/geometry/test/unit/regiontilertest.h", 9, "RegionTilerTest", suite_RegionTilerTest, Tests_RegionTilerTest );
+
+static class TestDescription_suite_RegionTilerTest_testBox3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testBox3D() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 12, "testBox3D" ) {}
+ void runTest() { suite_RegionTilerTest.testBox3D(); }
+} testDescription_suite_RegionTilerTest_testBox3D;
+
+static class TestDescription_suite_RegionTilerTest_testIrregular2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testIrregular2D() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 30, "testIrregular2D" ) {}
+ void runTest() { suite_RegionTilerTest.testIrregular2D(); }
+} testDescription_suite_RegionTilerTest_testIrregular2D;
+
+static class TestDescription_suite_RegionTilerTest_testRim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testRim() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 47, "testRim" ) {}
+ void runTest() { suite_RegionTilerTest.testRim(); }
+} testDescription_suite_RegionTilerTest_testRim;
+
+static class TestDescription_suite_RegionTilerTest_testEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testEmpty() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 58, "testEmpty" ) {}
+ void runTest() { suite_RegionTilerTest.testEmpty(); }
+} testDescription_suite_RegionTilerTest_testEmpty;
+
+static class TestDescription_suite_RegionTilerTest_testInvalidTileDimensions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testInvalidTileDimensions() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 63, "testInvalidTileDimensions" ) {}
+ void runTest() { suite_RegionTilerTest.testInvalidTileDimensions(); }
+} testDescription_suite_RegionTilerTest_testInvalidTileDimensions;
+
+static class TestDescription_suite_RegionTilerTest_testAutoTileDimensions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTilerTest_testAutoTileDimensions() : CxxTest::RealTestDescription( Tests_RegionTilerTest, suiteDescription_RegionTilerTest, 70, "testAutoTileDimensions" ) {}
+ void runTest() { suite_RegionTilerTest.testAutoTileDimensions(); }
+} testDescription_suite_RegionTilerTest_testAutoTileDimensions;
+
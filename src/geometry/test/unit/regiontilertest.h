@@ -0,0 +1,105 @@
+#include <libgeodecomp/geometry/regiontiler.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class RegionTilerTest : public CxxTest::TestSuite
+{
+public:
+    void testBox3D()
+    {
+        Region<3> region;
+        region << CoordBox<3>(Coord<3>(10, 20, 30), Coord<3>(50, 23, 10));
+        std::vector<Region<3> > tiles = RegionTiler<3>::tile(region, Coord<3>(1, 8, 4));
+
+        // 3 tiles along the y-axis, 3 along the z-axis:
+        TS_ASSERT_EQUALS(std::size_t(9), tiles.size());
+        checkCover(region, tiles, Coord<3>(50, 8, 4));
+
+        TS_ASSERT_EQUALS(
+            CoordBox<3>(Coord<3>(10, 20, 30), Coord<3>(50, 8, 4)),
+            tiles[0].boundingBox());
+        TS_ASSERT_EQUALS(
+            CoordBox<3>(Coord<3>(10, 36, 38), Coord<3>(50, 7, 2)),
+            tiles[8].boundingBox());
+    }
+
+    void testIrregular2D()
+    {
+        Region<2> region;
+        region << Streak<2>(Coord<2>(0,  0), 10)
+               << Streak<2>(Coord<2>(5,  1), 20)
+               << Streak<2>(Coord<2>(30, 1), 40)
+               << Streak<2>(Coord<2>(0, 11), 10)
+               << Streak<2>(Coord<2>(0, 12), 10);
+        std::vector<Region<2> > tiles = RegionTiler<2>::tile(region, Coord<2>(0, 5));
+
+        // rows 5 to 9 are empty, so the second tile is omitted:
+        TS_ASSERT_EQUALS(std::size_t(2), tiles.size());
+        checkCover(region, tiles, Coord<2>(40, 5));
+        TS_ASSERT_EQUALS(std::size_t(3), tiles[0].numStreaks());
+        TS_ASSERT_EQUALS(std::size_t(2), tiles[1].numStreaks());
+    }
+
+    void testRim()
+    {
+        Region<3> box;
+        box << CoordBox<3>(Coord<3>(), Coord<3>(40, 40, 40));
+        Region<3> rim = box - box.expand(-2);
+        std::vector<Region<3> > tiles = RegionTiler<3>::tile(rim, Coord<3>(0, 16, 16));
+
+        TS_ASSERT_EQUALS(std::size_t(9), tiles.size());
+        checkCover(rim, tiles, Coord<3>(40, 16, 16));
+    }
+
+    void testEmpty()
+    {
+        TS_ASSERT(RegionTiler<3>::tile(Region<3>(), Coord<3>(1, 1, 1)).empty());
+    }
+
+    void testInvalidTileDimensions()
+    {
+        Region<3> region;
+        region << Coord<3>(1, 2, 3);
+        TS_ASSERT_THROWS(RegionTiler<3>::tile(region, Coord<3>(1, 0, 1)), std::invalid_argument&);
+    }
+
+    void testAutoTileDimensions()
+    {
+        // three planes fit into the cache, no need for blocking:
+        TS_ASSERT_EQUALS(Coord<3>(), RegionTiler<3>::autoTileDimensions(Coord<3>(64, 64, 64), 8));
+        TS_ASSERT_EQUALS(Coord<2>(), RegionTiler<2>::autoTileDimensions(Coord<2>(8000, 8000), 8));
+
+        // rows of 4 kB, 3 * (19 + 2) rows fit into 256 kB:
+        Coord<3> dim = RegionTiler<3>::autoTileDimensions(Coord<3>(512, 512, 512), 8);
+        TS_ASSERT_EQUALS(Coord<3>(512, 19, 32), dim);
+
+        // extremely long rows still yield valid tiles:
+        dim = RegionTiler<3>::autoTileDimensions(Coord<3>(100000, 10, 5), 8, 1024);
+        TS_ASSERT_EQUALS(Coord<3>(100000, 1, 5), dim);
+    }
+
+private:
+    template<int DIM>
+    void checkCover(const Region<DIM>& region, const std::vector<Region<DIM> >& tiles, const Coord<DIM>& maxDim)
+    {
+        Region<DIM> sum;
+        for (std::size_t i = 0; i < tiles.size(); ++i) {
+            TS_ASSERT(!tiles[i].empty());
+            TS_ASSERT((sum & tiles[i]).empty());
+            sum += tiles[i];
+
+            Coord<DIM> dim = tiles[i].boundingBox().dimensions;
+            for (int d = 0; d < DIM; ++d) {
+                TS_ASSERT(dim[d] <= maxDim[d]);
+            }
+        }
+
+        TS_ASSERT_EQUALS(region, sum);
+    }
+};
+
+}
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredGridMesherTest_init = false;
+#include "/root/repo/src/geometry/test/unit/unstructuredgridmeshertest.h"
+
+static UnstructuredGridMesherTest suite_UnstructuredGridMesherTest;
+
+static CxxTest::List Tests_UnstructuredGridMesherTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredGridMesherTest( "/root/repo/src/geometry/test/unit/unstructuredgridmeshertest.h", 10, "UnstructuredGridMesherTest", suite_UnstructuredGridMesherTest, Tests_UnstructuredGridMesherTest );
+
+static class TestDescription_suite_UnstructuredGridMesherTest_testWithFloatCoord2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridMesherTest_testWithFloatCoord2D() : CxxTest::RealTestDescription( Tests_UnstructuredGridMesherTest, suiteDescription_UnstructuredGridMesherTest, 13, "testWithFloatCoord2D" ) {}
+ void runTest() { suite_UnstructuredGridMesherTest.testWithFloatCoord2D(); }
+} testDescription_suite_UnstructuredGridMesherTest_testWithFloatCoord2D;
+
+static class TestDescription_suite_UnstructuredGridMesherTest_testIfNodesSitDirectlyOnBoundaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridMesherTest_testIfNodesSitDirectlyOnBoundaries() : CxxTest::RealTestDescription( Tests_UnstructuredGridMesherTest, suiteDescription_UnstructuredGridMesherTest, 89, "testIfNodesSitDirectlyOnBoundaries" ) {}
+ void runTest() { suite_UnstructuredGridMesherTest.testIfNodesSitDirectlyOnBoundaries(); }
+} testDescription_suite_UnstructuredGridMesherTest_testIfNodesSitDirectlyOnBoundaries;
+
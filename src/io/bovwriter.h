@@ -139,34 +139,48 @@ private:
     {
         MPI_File file = mpiio.openFileForWrite(
             filename(step, "data"), comm);
-        MPI_Aint varLength = mpiio.getLength(datatype);
-        std::vector<char> buffer;
-
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = Topology::normalize(i->origin, dimensions);
-            int dataComponents = selector.arity();
-            MPI_Offset index = coord.toIndex(dimensions) * varLength * dataComponents;
-            MPI_File_seek(file, index, MPI_SEEK_SET);
-            int length = i->endX - i->origin.x();
-            std::size_t byteSize = length * selector.sizeOfExternal();
-
-            if (buffer.size() != byteSize) {
-                buffer.resize(byteSize);
+
+        // each cell contributes selector.arity() values:
+        MPI_Datatype cellType;
+        MPI_Type_contiguous(selector.arity(), datatype, &cellType);
+        MPI_Type_commit(&cellType);
+
+        std::vector<Streak<DIM> > streaks = mpiio.setView(file, 0, region, dimensions, cellType);
+        std::vector<char> buffer(region.size() * selector.sizeOfExternal());
+        char *data = buffer.empty() ? 0 : &buffer[0];
+
+        if (inRegionOrder(streaks, region)) {
+            grid.saveMemberUnchecked(data, MemoryLocation::HOST, selector, region);
+        } else {
+            for (typename std::vector<Streak<DIM> >::iterator i = streaks.begin(); i != streaks.end(); ++i) {
+                Region<DIM> tempRegion;
+                tempRegion << *i;
+                grid.saveMemberUnchecked(data, MemoryLocation::HOST, selector, tempRegion);
+                data += i->length() * selector.sizeOfExternal();
             }
+            data = &buffer[0];
+        }
 
-            Region<DIM> tempRegion;
-            tempRegion << *i;
-            grid.saveMemberUnchecked(&buffer[0], MemoryLocation::HOST, selector, tempRegion);
+        MPI_File_write_all(file, data, region.size(), cellType, MPI_STATUS_IGNORE);
+        MPI_Type_free(&cellType);
+        MPI_File_close(&file);
+    }
 
-            MPI_File_write(file, &buffer[0], length, datatype, MPI_STATUS_IGNORE);
+    /**
+     * Checks whether the file view doesn't need to reorder the
+     * region's streaks, so that it can be packed in one go.
+     */
+    static bool inRegionOrder(const std::vector<Streak<DIM> >& streaks, const Region<DIM>& region)
+    {
+        typename std::vector<Streak<DIM> >::const_iterator iter = streaks.begin();
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            if (*i != *iter) {
+                return false;
+            }
+            ++iter;
         }
 
-        MPI_File_close(&file);
+        return true;
     }
 };
 
@@ -0,0 +1,106 @@
+#ifndef LIBGEODECOMP_IO_CHECKPOINTINITIALIZER_H
+#define LIBGEODECOMP_IO_CHECKPOINTINITIALIZER_H
+
+#include <libgeodecomp/io/checkpointmanifest.h>
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/io/timeseriesreader.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <boost/shared_ptr.hpp>
+
+namespace LibGeoDecomp {
+
+/**
+ * Restarts a simulation from a checkpoint written by
+ * CheckpointWriter, either the latest one listed in the manifest or
+ * the one for a given step. Each process reads only the chunks which
+ * intersect its own part of the grid: first from the full checkpoint,
+ * then, if the requested checkpoint is differential, the changed
+ * bricks on top. There is no need for a root process to read the
+ * whole grid.
+ */
+template<typename CELL_TYPE>
+class CheckpointInitializer : public Initializer<CELL_TYPE>
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+
+    explicit CheckpointInitializer(const std::string& prefix)
+    {
+        init(CheckpointManifest(prefix), CheckpointManifest(prefix).latest());
+    }
+
+    CheckpointInitializer(const std::string& prefix, unsigned step)
+    {
+        init(CheckpointManifest(prefix), CheckpointManifest(prefix).find(step));
+    }
+
+    virtual void grid(GridBase<CELL_TYPE, DIM> *target)
+    {
+        initEdge(target);
+        Region<DIM> region;
+        region << target->boundingBox();
+        initRegion(target, region);
+    }
+
+    virtual bool supportsParallelInit() const
+    {
+        return true;
+    }
+
+    virtual void initRegion(GridBase<CELL_TYPE, DIM> *target, const Region<DIM>& region)
+    {
+        fullReader->readCells(target, "cells", entry.baseStep, region);
+        if (diffReader) {
+            diffReader->readCells(target, "cells", entry.step, region);
+        }
+    }
+
+    virtual void initEdge(GridBase<CELL_TYPE, DIM> *target)
+    {
+        target->setEdge(edgeCell);
+    }
+
+    virtual Coord<DIM> gridDimensions() const
+    {
+        return fullReader->gridDimensions();
+    }
+
+    virtual unsigned startStep() const
+    {
+        return entry.step;
+    }
+
+    virtual unsigned maxSteps() const
+    {
+        return entry.maxSteps;
+    }
+
+private:
+    CheckpointManifest::Entry entry;
+    boost::shared_ptr<TimeSeriesReader<DIM> > fullReader;
+    boost::shared_ptr<TimeSeriesReader<DIM> > diffReader;
+    CELL_TYPE edgeCell;
+
+    void init(const CheckpointManifest& manifest, const CheckpointManifest::Entry& newEntry)
+    {
+        entry = newEntry;
+        fullReader.reset(new TimeSeriesReader<DIM>(manifest.fullFilename(entry.baseStep)));
+        if (!entry.isFull()) {
+            diffReader.reset(new TimeSeriesReader<DIM>(manifest.diffFilename(entry.step)));
+        }
+
+        // CheckpointWriter stores the edge cell as a single cell at the origin:
+        Region<DIM> edgeRegion;
+        edgeRegion << Streak<DIM>(Coord<DIM>(), 1);
+        DisplacedGrid<CELL_TYPE, Topology> edgeGrid(CoordBox<DIM>(Coord<DIM>(), Coord<DIM>::diagonal(1)));
+        TimeSeriesReader<DIM>& edgeReader = diffReader ? *diffReader : *fullReader;
+        edgeReader.readCells(&edgeGrid, "edge", entry.step, edgeRegion);
+        edgeCell = edgeGrid.get(Coord<DIM>());
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef LIBGEODECOMP_IO_CHECKPOINTMANIFEST_H
+#define LIBGEODECOMP_IO_CHECKPOINTMANIFEST_H
+
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Keeps track of the checkpoints written by CheckpointWriter: each
+ * completed checkpoint is recorded as one line in PREFIX.checkpoints.
+ * A checkpoint is either full or differential. The latter only holds
+ * the bricks which changed since its base, i.e. the last full
+ * checkpoint. As lines are appended only after a checkpoint's files
+ * have been closed, an aborted run will never list an incomplete
+ * checkpoint.
+ */
+class CheckpointManifest
+{
+public:
+    class Entry
+    {
+    public:
+        Entry(unsigned step = 0, unsigned baseStep = 0, unsigned maxSteps = 0) :
+            step(step),
+            baseStep(baseStep),
+            maxSteps(maxSteps)
+        {}
+
+        bool isFull() const
+        {
+            return step == baseStep;
+        }
+
+        unsigned step;
+        unsigned baseStep;
+        unsigned maxSteps;
+    };
+
+    explicit CheckpointManifest(const std::string& prefix = "") :
+        prefix(prefix)
+    {}
+
+    std::string filename() const
+    {
+        return prefix + ".checkpoints";
+    }
+
+    std::string fullFilename(unsigned step) const
+    {
+        return checkpointFilename(step, "full");
+    }
+
+    std::string diffFilename(unsigned step) const
+    {
+        return checkpointFilename(step, "diff");
+    }
+
+    void append(const Entry& entry) const
+    {
+        std::ofstream file(filename().c_str(), std::ios::app);
+        if (!file) {
+            throw FileOpenException(filename());
+        }
+
+        file << entry.step << " " << entry.baseStep << " " << entry.maxSteps << "\n";
+        if (!file) {
+            throw FileWriteException(filename());
+        }
+    }
+
+    std::vector<Entry> entries() const
+    {
+        std::ifstream file(filename().c_str());
+        if (!file) {
+            throw FileOpenException(filename());
+        }
+
+        std::vector<Entry> ret;
+        Entry entry;
+        while (file >> entry.step >> entry.baseStep >> entry.maxSteps) {
+            ret << entry;
+        }
+        if (!file.eof()) {
+            throw FileReadException(filename());
+        }
+
+        return ret;
+    }
+
+    Entry latest() const
+    {
+        std::vector<Entry> all = entries();
+        if (all.empty()) {
+            throw std::invalid_argument("no checkpoints listed in " + filename());
+        }
+
+        return all.back();
+    }
+
+    Entry find(unsigned step) const
+    {
+        std::vector<Entry> all = entries();
+        for (std::vector<Entry>::reverse_iterator i = all.rbegin(); i != all.rend(); ++i) {
+            if (i->step == step) {
+                return *i;
+            }
+        }
+
+        throw std::invalid_argument("no checkpoint for requested step listed in " + filename());
+    }
+
+private:
+    std::string prefix;
+
+    std::string checkpointFilename(unsigned step, const std::string& suffix) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "." << std::setfill('0') << std::setw(5) << step << "." << suffix;
+        return buf.str();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,287 @@
+#ifndef LIBGEODECOMP_IO_CHECKPOINTWRITER_H
+#define LIBGEODECOMP_IO_CHECKPOINTWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/io/checkpointmanifest.h>
+#include <libgeodecomp/io/timeserieswriter.h>
+
+#include <map>
+
+namespace LibGeoDecomp {
+
+namespace CheckpointWriterHelpers {
+
+/**
+ * 64 bit FNV-1a, good enough to detect modified bricks.
+ */
+inline boost::uint64_t hash(const std::vector<char>& data)
+{
+    boost::uint64_t ret = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        ret ^= static_cast<unsigned char>(data[i]);
+        ret *= 1099511628211ULL;
+    }
+
+    return ret;
+}
+
+}
+
+/**
+ * Writes checkpoints for restarts via CheckpointInitializer. Unlike
+ * ParallelMPIIOWriter, which always dumps the whole grid, only every
+ * fullPeriod-th checkpoint is complete. The others are differential:
+ * they hold just the bricks whose contents changed since the last
+ * full checkpoint (as detected by a hash of each rank's part of a
+ * brick). Thus a restart needs to read at most two checkpoints, and
+ * only those chunks which intersect its part of the grid. Files are
+ * in TimeSeriesFormat, CheckpointManifest lists completed
+ * checkpoints.
+ *
+ * Cells are stored as raw bytes and hence need to be trivially
+ * copyable. To keep checkpointing off the critical path, add this
+ * writer via HiParSimulator::addAsyncWriter(), which hands it a copy
+ * of the grid on a separate thread.
+ */
+template<typename CELL_TYPE>
+class CheckpointWriter : public Clonable<ParallelWriter<CELL_TYPE>, CheckpointWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef TimeSeriesFormat::IndexEntry IndexEntry;
+
+    using ParallelWriter<CELL_TYPE>::period;
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * maxSteps will be handed on to CheckpointInitializer. Smaller
+     * brickDimensions make differential checkpoints more selective,
+     * an empty brickDimensions selects one brick for the whole grid.
+     */
+    CheckpointWriter(
+        const std::string& prefix,
+        const unsigned period,
+        const unsigned maxSteps,
+        const unsigned fullPeriod = 1,
+        const Coord<DIM>& brickDimensions = Coord<DIM>(),
+        const bool compress = true,
+        const MPI_Comm& communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL_TYPE>, CheckpointWriter<CELL_TYPE> >(prefix, period),
+        manifest(prefix),
+        maxSteps(maxSteps),
+        fullPeriod(fullPeriod),
+        brickDimensions(brickDimensions),
+        compress(compress),
+        comm(communicator),
+        checkpointCount(0),
+        baseStep(0),
+        forceFull(true),
+        currentIsFull(true),
+        lastStep(0),
+        haveLastStep(false),
+        stepBoundary(true),
+        skipStep(false),
+        callIndex(0)
+    {
+        if (fullPeriod == 0) {
+            throw std::invalid_argument("fullPeriod must be positive");
+        }
+    }
+
+    /**
+     * Hashes are only comparable if each rank still owns the same
+     * region, so repartitioning triggers a full checkpoint.
+     */
+    virtual void setRegion(const Region<DIM>& newRegion)
+    {
+        ParallelWriter<CELL_TYPE>::setRegion(newRegion);
+        forceFull = true;
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        if (stepBoundary) {
+            stepBoundary = false;
+            callIndex = 0;
+            // Simulators report the final step twice (STEP_FINISHED
+            // and ALL_DONE), but it needs to be stored only once:
+            skipStep = haveLastStep && (step == lastStep);
+            if (!skipStep) {
+                openCheckpoint(grid, step, globalDimensions);
+            }
+        }
+
+        if (!skipStep) {
+            encode(grid, validRegion, step);
+        }
+        ++callIndex;
+
+        if (!lastCall) {
+            return;
+        }
+
+        stepBoundary = true;
+        if (skipStep) {
+            return;
+        }
+
+        file.append(&pending, &pendingEntries);
+        file.close();
+        if (MPILayer(comm).rank() == 0) {
+            manifest.append(CheckpointManifest::Entry(step, baseStep, maxSteps));
+        }
+
+        lastStep = step;
+        haveLastStep = true;
+        ++checkpointCount;
+    }
+
+private:
+    CheckpointManifest manifest;
+    unsigned maxSteps;
+    unsigned fullPeriod;
+    Coord<DIM> brickDimensions;
+    bool compress;
+    MPI_Comm comm;
+    TimeSeriesWriterHelpers::ChunkFile file;
+    unsigned checkpointCount;
+    unsigned baseStep;
+    bool forceFull;
+    bool currentIsFull;
+    unsigned lastStep;
+    bool haveLastStep;
+    bool stepBoundary;
+    bool skipStep;
+    std::size_t callIndex;
+    boost::shared_ptr<TimeSeriesFormat::Bricks<DIM> > bricks;
+    // hashes of the last full checkpoint, by brick and call within a step:
+    std::map<std::pair<boost::uint64_t, std::size_t>, boost::uint64_t> baseHashes;
+    std::vector<char> pending;
+    std::vector<IndexEntry> pendingEntries;
+
+    void openCheckpoint(const GridType& grid, unsigned step, const Coord<DIM>& globalDimensions)
+    {
+        // setRegion() might have been called on some ranks only:
+        int localForceFull = forceFull;
+        int globalForceFull = 0;
+        MPI_Allreduce(&localForceFull, &globalForceFull, 1, MPI_INT, MPI_LOR, comm);
+
+        currentIsFull = globalForceFull || (checkpointCount % fullPeriod == 0);
+        if (currentIsFull) {
+            baseStep = step;
+            baseHashes.clear();
+            forceFull = false;
+        }
+
+        TimeSeriesFormat::Header<DIM> header;
+        header.gridDimensions = globalDimensions;
+        header.brickDimensions = brickDimensions;
+        for (int d = 0; d < DIM; ++d) {
+            if (header.brickDimensions[d] == 0) {
+                header.brickDimensions[d] = globalDimensions[d];
+            }
+        }
+        header.compressed = compress;
+        header.names << "cells" << "edge";
+        header.elementSizes << sizeof(CELL_TYPE) << sizeof(CELL_TYPE);
+        bricks.reset(new TimeSeriesFormat::Bricks<DIM>(globalDimensions, header.brickDimensions));
+
+        std::vector<char> buffer;
+        header.serialize(&buffer);
+        file.open(currentIsFull ? manifest.fullFilename(step) : manifest.diffFilename(step), buffer, comm);
+
+        // the edge cell is stored as a single cell at the origin:
+        if (MPILayer(comm).rank() == 0) {
+            Region<DIM> edgeRegion;
+            edgeRegion << Streak<DIM>(Coord<DIM>(), 1);
+            CELL_TYPE edge = grid.getEdge();
+            std::vector<char> data(
+                reinterpret_cast<char*>(&edge),
+                reinterpret_cast<char*>(&edge) + sizeof(CELL_TYPE));
+            addChunk(edgeRegion, data, step, 1, 0);
+        }
+    }
+
+    void encode(const GridType& grid, const Region<DIM>& validRegion, unsigned step)
+    {
+        if (validRegion.empty()) {
+            return;
+        }
+
+        std::vector<boost::uint64_t> brickIDs;
+        std::vector<CoordBox<DIM> > brickBoxes;
+        bricks->intersecting(validRegion.boundingBox(), &brickIDs, &brickBoxes);
+
+        std::vector<CELL_TYPE> cells;
+        std::vector<char> data;
+
+        for (std::size_t i = 0; i < brickIDs.size(); ++i) {
+            Region<DIM> brickRegion;
+            brickRegion << brickBoxes[i];
+            Region<DIM> piece = validRegion & brickRegion;
+            if (piece.empty()) {
+                continue;
+            }
+
+            cells.resize(piece.size());
+            CELL_TYPE *cursor = &cells[0];
+            for (typename Region<DIM>::StreakIterator j = piece.beginStreak(); j != piece.endStreak(); ++j) {
+                grid.get(*j, cursor);
+                cursor += j->length();
+            }
+            data.assign(
+                reinterpret_cast<char*>(&cells[0]),
+                reinterpret_cast<char*>(&cells[0]) + cells.size() * sizeof(CELL_TYPE));
+
+            std::pair<boost::uint64_t, std::size_t> key(brickIDs[i], callIndex);
+            boost::uint64_t hash = CheckpointWriterHelpers::hash(data);
+            if (currentIsFull) {
+                baseHashes[key] = hash;
+            } else {
+                typename std::map<std::pair<boost::uint64_t, std::size_t>, boost::uint64_t>::iterator iter =
+                    baseHashes.find(key);
+                if ((iter != baseHashes.end()) && (iter->second == hash)) {
+                    continue;
+                }
+            }
+
+            addChunk(piece, data, step, 0, brickIDs[i]);
+        }
+    }
+
+    void addChunk(
+        const Region<DIM>& region,
+        const std::vector<char>& data,
+        unsigned step,
+        std::size_t member,
+        boost::uint64_t brick)
+    {
+        std::vector<char> raw;
+        std::vector<char> encoded;
+        TimeSeriesFormat::encodeChunk(region, data, sizeof(CELL_TYPE), compress, &raw, &encoded);
+
+        pendingEntries << IndexEntry(step, member, brick, pending.size(), encoded.size(), raw.size());
+        pending.insert(pending.end(), encoded.begin(), encoded.end());
+    }
+};
+
+}
+
+#endif
+#endif
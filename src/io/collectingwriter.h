@@ -8,6 +8,9 @@
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/misc/clonable.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace LibGeoDecomp {
 
 /**
@@ -15,6 +18,15 @@ namespace LibGeoDecomp {
  * together with a DistributedSimulator. Good for testing, but doesn't
  * scale, as all memory is concentrated on one node and IO is
  * serialized to that node. Use with care!
+ *
+ * By default all ranks send their streaks directly to the root, which
+ * receives them in rank order. If fanOut is positive, the ranks form
+ * a fanOut-ary tree instead: each rank merges the packed data of its
+ * children with its own and forwards the result in one message to its
+ * parent. This way the root only talks to fanOut peers and the number
+ * of messages it needs to handle doesn't grow with the number of
+ * ranks. The root still has to hold the whole grid, as legacy Writers
+ * expect it.
  */
 template<typename CELL_TYPE>
 class CollectingWriter : public Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >
@@ -32,12 +44,14 @@ public:
         Writer<CELL_TYPE> *writer,
         int root = 0,
         MPI_Comm communicator = MPI_COMM_WORLD,
-        MPI_Datatype mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value()) :
+        MPI_Datatype mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value(),
+        unsigned fanOut = 0) :
         Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >("",  1),
         writer(writer),
         mpiLayer(communicator),
         root(root),
-        datatype(mpiDatatype)
+        datatype(mpiDatatype),
+        fanOut(fanOut)
     {
         if ((mpiLayer.rank() != root) && (writer != 0)) {
             throw std::invalid_argument("can't call back a writer on a node other than the root");
@@ -63,11 +77,60 @@ public:
         std::size_t rank,
         bool lastCall)
     {
-        if (mpiLayer.rank() == root) {
-            if (globalGrid.boundingBox().dimensions != globalDimensions) {
-                globalGrid.resize(CoordBox<DIM>(Coord<DIM>(), globalDimensions));
+        if (fanOut > 0) {
+            gatherTree(grid, validRegion, globalDimensions);
+        } else {
+            gatherDirect(grid, validRegion, globalDimensions);
+        }
+
+        if (lastCall && (mpiLayer.rank() == root)) {
+            writer->stepFinished(*globalGrid.vanillaGrid(), step, event);
+        }
+    }
+
+private:
+    boost::shared_ptr<Writer<CELL_TYPE> > writer;
+    MPILayer mpiLayer;
+    int root;
+    StorageGridType globalGrid;
+    MPI_Datatype datatype;
+    unsigned fanOut;
+
+    /**
+     * Orders streaks in the same way as Region's StreakIterator does,
+     * so that concatenating the data of disjoint regions in this order
+     * yields the data of their union in its streak order.
+     */
+    class StreakLess
+    {
+    public:
+        bool operator()(const std::pair<Streak<DIM>, const CELL_TYPE*>& a,
+                        const std::pair<Streak<DIM>, const CELL_TYPE*>& b) const
+        {
+            for (int d = DIM - 1; d >= 0; --d) {
+                if (a.first.origin[d] != b.first.origin[d]) {
+                    return a.first.origin[d] < b.first.origin[d];
+                }
             }
 
+            return false;
+        }
+    };
+
+    void resizeGlobalGrid(const Coord<DIM>& globalDimensions)
+    {
+        if (globalGrid.boundingBox().dimensions != globalDimensions) {
+            globalGrid.resize(CoordBox<DIM>(Coord<DIM>(), globalDimensions));
+        }
+    }
+
+    void gatherDirect(
+        const SimulatorGridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions)
+    {
+        if (mpiLayer.rank() == root) {
+            resizeGlobalGrid(globalDimensions);
             globalGrid.paste(grid, validRegion);
             globalGrid.setEdge(grid.getEdge());
         }
@@ -105,18 +168,112 @@ public:
         }
 
         mpiLayer.waitAll();
+    }
 
-        if (lastCall && (mpiLayer.rank() == root)) {
-            writer->stepFinished(*globalGrid.vanillaGrid(), step, event);
+    void gatherTree(
+        const SimulatorGridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions)
+    {
+        // ranks are renumbered so that the root becomes 0:
+        int size = mpiLayer.size();
+        int virtualRank = (mpiLayer.rank() - root + size) % size;
+
+        std::vector<int> children;
+        for (int i = 1; i <= int(fanOut); ++i) {
+            int child = virtualRank * fanOut + i;
+            if (child < size) {
+                children << (child + root) % size;
+            }
         }
+
+        std::vector<Region<DIM> > childRegions(children.size());
+        std::vector<std::vector<CELL_TYPE> > childBuffers(children.size());
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            mpiLayer.recvRegion(&childRegions[i], children[i]);
+            childBuffers[i].resize(childRegions[i].size());
+            if (!childBuffers[i].empty()) {
+                mpiLayer.recv(
+                    &childBuffers[i][0],
+                    children[i],
+                    childBuffers[i].size(),
+                    MPILayer::COLLECTING_WRITER,
+                    datatype);
+            }
+        }
+        mpiLayer.wait(MPILayer::COLLECTING_WRITER);
+
+        if (virtualRank == 0) {
+            resizeGlobalGrid(globalDimensions);
+            globalGrid.paste(grid, validRegion);
+            globalGrid.setEdge(grid.getEdge());
+
+            for (std::size_t i = 0; i < children.size(); ++i) {
+                unpack(childRegions[i], childBuffers[i]);
+            }
+            return;
+        }
+
+        std::vector<CELL_TYPE> ownBuffer(validRegion.size());
+        std::size_t offset = 0;
+        for (typename Region<DIM>::StreakIterator i = validRegion.beginStreak();
+             i != validRegion.endStreak();
+             ++i) {
+            grid.get(*i, &ownBuffer[offset]);
+            offset += i->length();
+        }
+
+        Region<DIM> subtreeRegion = validRegion;
+        std::vector<std::pair<Streak<DIM>, const CELL_TYPE*> > streaks;
+        collectStreaks(validRegion, ownBuffer, &streaks);
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            subtreeRegion += childRegions[i];
+            collectStreaks(childRegions[i], childBuffers[i], &streaks);
+        }
+        std::stable_sort(streaks.begin(), streaks.end(), StreakLess());
+
+        std::vector<CELL_TYPE> subtreeBuffer(subtreeRegion.size());
+        offset = 0;
+        for (typename std::vector<std::pair<Streak<DIM>, const CELL_TYPE*> >::iterator i = streaks.begin();
+             i != streaks.end();
+             ++i) {
+            std::copy(i->second, i->second + i->first.length(), &subtreeBuffer[offset]);
+            offset += i->first.length();
+        }
+
+        int parent = ((virtualRank - 1) / fanOut + root) % size;
+        mpiLayer.sendRegion(subtreeRegion, parent);
+        if (!subtreeBuffer.empty()) {
+            mpiLayer.send(
+                &subtreeBuffer[0],
+                parent,
+                subtreeBuffer.size(),
+                MPILayer::COLLECTING_WRITER,
+                datatype);
+        }
+        mpiLayer.wait(MPILayer::COLLECTING_WRITER);
     }
 
-private:
-    boost::shared_ptr<Writer<CELL_TYPE> > writer;
-    MPILayer mpiLayer;
-    int root;
-    StorageGridType globalGrid;
-    MPI_Datatype datatype;
+    void collectStreaks(
+        const Region<DIM>& region,
+        const std::vector<CELL_TYPE>& buffer,
+        std::vector<std::pair<Streak<DIM>, const CELL_TYPE*> > *streaks)
+    {
+        std::size_t offset = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            streaks->push_back(std::make_pair(*i, &buffer[offset]));
+            offset += i->length();
+        }
+    }
+
+    void unpack(const Region<DIM>& region, const std::vector<CELL_TYPE>& buffer)
+    {
+        std::size_t offset = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            globalGrid.set(*i, &buffer[offset]);
+            offset += i->length();
+        }
+    }
 };
 
 }
@@ -0,0 +1,214 @@
+#ifndef LIBGEODECOMP_IO_DOWNSAMPLINGWRITER_H
+#define LIBGEODECOMP_IO_DOWNSAMPLINGWRITER_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace DownsamplingWriterHelpers {
+
+/**
+ * Maps a fine grid to a coarse one which consists of every stride-th
+ * cell within the region of interest (ROI). An empty ROI selects the
+ * whole grid. Coarse coordinate c corresponds to the fine coordinate
+ * roi.origin + c * stride.
+ */
+template<int DIM>
+class Sampler
+{
+public:
+    explicit Sampler(
+        const Coord<DIM>& stride = Coord<DIM>::diagonal(1),
+        const CoordBox<DIM>& regionOfInterest = CoordBox<DIM>()) :
+        stride(stride),
+        roi(regionOfInterest)
+    {
+        for (int d = 0; d < DIM; ++d) {
+            if (stride[d] < 1) {
+                throw std::invalid_argument("stride must be positive in all dimensions");
+            }
+        }
+    }
+
+    CoordBox<DIM> regionOfInterest(const Coord<DIM>& globalDimensions) const
+    {
+        if (roi.dimensions.prod() == 0) {
+            return CoordBox<DIM>(Coord<DIM>(), globalDimensions);
+        }
+
+        return roi;
+    }
+
+    Coord<DIM> coarseDimensions(const Coord<DIM>& globalDimensions) const
+    {
+        Coord<DIM> dimensions = regionOfInterest(globalDimensions).dimensions;
+        for (int d = 0; d < DIM; ++d) {
+            dimensions[d] = ceilDiv(dimensions[d], stride[d]);
+        }
+
+        return dimensions;
+    }
+
+    Coord<DIM> fineCoord(const Coord<DIM>& coarseCoord, const Coord<DIM>& globalDimensions) const
+    {
+        return regionOfInterest(globalDimensions).origin + coarseCoord.scale(stride);
+    }
+
+    /**
+     * Yields all coarse coordinates whose fine counterparts lie
+     * within fineRegion. This way each coarse cell is owned by
+     * exactly one rank if the fine regions are disjoint.
+     */
+    Region<DIM> coarsen(const Region<DIM>& fineRegion, const Coord<DIM>& globalDimensions) const
+    {
+        CoordBox<DIM> box = regionOfInterest(globalDimensions);
+        Region<DIM> roiRegion;
+        roiRegion << box;
+        Region<DIM> clipped = fineRegion & roiRegion;
+        Region<DIM> ret;
+
+        for (typename Region<DIM>::StreakIterator i = clipped.beginStreak(); i != clipped.endStreak(); ++i) {
+            Coord<DIM> relativeOrigin = i->origin - box.origin;
+
+            bool onGrid = true;
+            for (int d = 1; d < DIM; ++d) {
+                onGrid &= ((relativeOrigin[d] % stride[d]) == 0);
+            }
+            if (!onGrid) {
+                continue;
+            }
+
+            int startX = ceilDiv(relativeOrigin.x(),          stride.x());
+            int endX   = ceilDiv(i->endX - box.origin.x(),    stride.x());
+            if (startX >= endX) {
+                continue;
+            }
+
+            Coord<DIM> coarseOrigin;
+            coarseOrigin.x() = startX;
+            for (int d = 1; d < DIM; ++d) {
+                coarseOrigin[d] = relativeOrigin[d] / stride[d];
+            }
+            ret << Streak<DIM>(coarseOrigin, endX);
+        }
+
+        return ret;
+    }
+
+    /**
+     * Copies the sampled cells of coarseRegion from the fine grid
+     * source to target.
+     */
+    template<typename CELL>
+    void copy(
+        const GridBase<CELL, DIM>& source,
+        GridBase<CELL, DIM> *target,
+        const Region<DIM>& coarseRegion,
+        const Coord<DIM>& globalDimensions) const
+    {
+        std::vector<CELL> buffer;
+
+        for (typename Region<DIM>::StreakIterator i = coarseRegion.beginStreak();
+             i != coarseRegion.endStreak();
+             ++i) {
+            Coord<DIM> fineOrigin = fineCoord(i->origin, globalDimensions);
+
+            if (stride.x() == 1) {
+                buffer.resize(i->length());
+                source.get(Streak<DIM>(fineOrigin, fineOrigin.x() + i->length()), &buffer[0]);
+                target->set(*i, &buffer[0]);
+                continue;
+            }
+
+            Coord<DIM> coarse = i->origin;
+            Coord<DIM> fine = fineOrigin;
+            for (; coarse.x() < i->endX; ++coarse.x(), fine.x() += stride.x()) {
+                target->set(coarse, source.get(fine));
+            }
+        }
+
+        target->setEdge(source.getEdge());
+    }
+
+private:
+    Coord<DIM> stride;
+    CoordBox<DIM> roi;
+
+    static int ceilDiv(int a, int b)
+    {
+        return (a + b - 1) / b;
+    }
+};
+
+}
+
+/**
+ * Adapter which feeds a coarse version of the grid to the delegate
+ * Writer: only every stride-th cell of the region of interest is
+ * retained. This way the output volume scales with the monitoring
+ * resolution instead of the simulation resolution. See
+ * ParallelDownsamplingWriter for the equivalent ParallelWriter, which
+ * samples locally before any I/O or gathering takes place.
+ */
+template<typename CELL_TYPE>
+class DownsamplingWriter : public Clonable<Writer<CELL_TYPE>, DownsamplingWriter<CELL_TYPE> >
+{
+public:
+    typedef typename Writer<CELL_TYPE>::GridType GridType;
+    typedef typename Writer<CELL_TYPE>::Topology Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> StorageGridType;
+
+    using Writer<CELL_TYPE>::period;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * Samples every stride-th cell of regionOfInterest (or the
+     * whole grid, if left empty). Takes ownership of writer.
+     */
+    DownsamplingWriter(
+        Writer<CELL_TYPE> *writer,
+        const Coord<DIM>& stride,
+        const CoordBox<DIM>& regionOfInterest = CoordBox<DIM>()) :
+        Clonable<Writer<CELL_TYPE>, DownsamplingWriter<CELL_TYPE> >(
+            writer->getPrefix(),
+            writer->getPeriod()),
+        writer(writer),
+        sampler(stride, regionOfInterest)
+    {}
+
+    virtual void stepFinished(const GridType& grid, unsigned step, WriterEvent event)
+    {
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        Coord<DIM> globalDimensions = grid.boundingBox().dimensions;
+        CoordBox<DIM> coarseBox(Coord<DIM>(), sampler.coarseDimensions(globalDimensions));
+        if (!(coarseGrid.boundingBox() == coarseBox)) {
+            coarseGrid.resize(coarseBox);
+        }
+
+        Region<DIM> coarseRegion;
+        coarseRegion << coarseBox;
+        sampler.copy(grid, &coarseGrid, coarseRegion, globalDimensions);
+
+        writer->stepFinished(*coarseGrid.vanillaGrid(), step, event);
+    }
+
+private:
+    boost::shared_ptr<Writer<CELL_TYPE> > writer;
+    DownsamplingWriterHelpers::Sampler<DIM> sampler;
+    StorageGridType coarseGrid;
+};
+
+}
+
+#endif
@@ -6,6 +6,9 @@
 #include <libgeodecomp/misc/random.h>
 #include <libgeodecomp/storage/gridbase.h>
 #include <libgeodecomp/geometry/adjacency.h>
+#include <libgeodecomp/geometry/costmap.h>
+
+#include <stdexcept>
 
 #ifdef LIBGEODECOMP_WITH_HPX
 #include <hpx/runtime/serialization/serialize.hpp>
@@ -42,6 +45,38 @@ public:
      */
     virtual void grid(GridBase<CELL, DIM> *target) = 0;
 
+    /**
+     * Initializers which can set up any subset of cells independently
+     * may return true here. Multi-threaded Simulators will then
+     * initialize grids via initEdge() and concurrent calls to
+     * initRegion() instead of grid(). Apart from being faster, this
+     * makes the threads which will later update the cells write them
+     * first.
+     */
+    virtual bool supportsParallelInit() const
+    {
+        return false;
+    }
+
+    /**
+     * Initializes the cells of target within region, which lies
+     * within target's bounding box. Unlike grid(), this may be called
+     * concurrently from multiple threads for disjoint regions of the
+     * same grid. Hence it must not modify grid-wide state (e.g. the
+     * edge cell), which is the job of initEdge().
+     */
+    virtual void initRegion(GridBase<CELL, DIM> * /* target */, const Region<DIM>& /* region */)
+    {
+        throw std::logic_error("Initializer doesn't support parallel initialization");
+    }
+
+    /**
+     * Sets up grid-wide state, e.g. the edge cell. Called once per
+     * grid before any calls to initRegion().
+     */
+    virtual void initEdge(GridBase<CELL, DIM> * /* target */)
+    {}
+
     /**
      * Allows a Simulator to discover the extent of the whole
      * simulation. Usually Simulations will use 0 as the origin, but
@@ -106,6 +141,17 @@ public:
     {
         return Adjacency();
     }
+
+    /**
+     * Initializers may provide an estimate of the cells' costs, which
+     * Simulators can use for the initial domain decomposition (see
+     * Partition::setCostMap()), e.g. when restarting from a snapshot.
+     * An empty CostMap means that no estimate is available.
+     */
+    virtual CostMap<DIM> getCostMap() const
+    {
+        return CostMap<DIM>();
+    }
 };
 
 }
@@ -0,0 +1,90 @@
+#ifndef LIBGEODECOMP_IO_MAPPEDFILE_H
+#define LIBGEODECOMP_IO_MAPPEDFILE_H
+
+#ifndef __WIN32__
+
+#include <libgeodecomp/io/ioexception.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Maps a file read-only into memory. Pages are only read once they
+ * are touched, so processes which need just a part of a large file
+ * won't read the remainder. The mapping may be read concurrently from
+ * multiple threads.
+ */
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename) :
+        filename(filename),
+        mapping(0),
+        length(0)
+    {
+        int descriptor = open(filename.c_str(), O_RDONLY);
+        if (descriptor == -1) {
+            throw FileOpenException(filename);
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) == -1) {
+            close(descriptor);
+            throw FileReadException(filename);
+        }
+        length = status.st_size;
+
+        // mmap() rejects empty mappings:
+        if (length > 0) {
+            void *ret = mmap(0, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (ret == MAP_FAILED) {
+                close(descriptor);
+                throw FileReadException(filename);
+            }
+            mapping = static_cast<const char*>(ret);
+        }
+
+        // the mapping stays valid after the file has been closed:
+        close(descriptor);
+    }
+
+    ~MappedFile()
+    {
+        if (mapping) {
+            munmap(const_cast<char*>(mapping), length);
+        }
+    }
+
+    const char *data() const
+    {
+        return mapping;
+    }
+
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    const std::string& name() const
+    {
+        return filename;
+    }
+
+private:
+    std::string filename;
+    const char *mapping;
+    std::size_t length;
+
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef LIBGEODECOMP_IO_MMAPINITIALIZER_H
+#define LIBGEODECOMP_IO_MMAPINITIALIZER_H
+
+#ifndef __WIN32__
+
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/io/mappedfile.h>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Sets up a simulation from a snapshot written by
+ * MPIIOWriter/ParallelMPIIOWriter, but without MPI: the file is
+ * mapped into memory and only the streaks of the regions passed to
+ * initRegion() are copied into the grid. As this Initializer
+ * supports parallel initialization, Simulators will have each thread
+ * copy (and thereby read from disk) just the cells it is going to
+ * update, and each process just its own part of the grid (see
+ * CommonStepper). Thus startup I/O scales with the size of the local
+ * partition.
+ *
+ * Snapshots consist of a header (the grid's dimensions, the time
+ * step, maxSteps and the edge cell) followed by all cells in
+ * row-major order. Cells are copied as raw bytes, which is only
+ * compatible with MPIIO if the cell's MPI datatype spans
+ * sizeof(CELL_TYPE) bytes (which is true for the Typemaps generated
+ * for plain structs). MPIIO stores the edge cell in the header
+ * packed though, i.e. without any padding bytes. For cells with
+ * padding the edge cell can't be restored from the file and needs
+ * to be passed to the constructor instead.
+ */
+template<typename CELL_TYPE>
+class MMapInitializer : public Initializer<CELL_TYPE>
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+    static const std::size_t HEADER_LENGTH =
+        sizeof(Coord<DIM>) + 2 * sizeof(unsigned) + sizeof(CELL_TYPE);
+
+    explicit MMapInitializer(const std::string& filename) :
+        file(new MappedFile(filename))
+    {
+        readHeader();
+    }
+
+    MMapInitializer(const std::string& filename, const CELL_TYPE& edgeCell) :
+        file(new MappedFile(filename))
+    {
+        readHeader();
+        this->edgeCell = edgeCell;
+    }
+
+    virtual void grid(GridBase<CELL_TYPE, DIM> *target)
+    {
+        initEdge(target);
+        Region<DIM> region;
+        region << target->boundingBox();
+        initRegion(target, region);
+    }
+
+    virtual bool supportsParallelInit() const
+    {
+        return true;
+    }
+
+    virtual void initRegion(GridBase<CELL_TYPE, DIM> *target, const Region<DIM>& region)
+    {
+        const char *cells = file->data() + HEADER_LENGTH;
+        // mmap() yields page-aligned memory, but the header may offset
+        // the cells, in which case we copy via a buffer:
+        bool aligned = (HEADER_LENGTH % boost::alignment_of<CELL_TYPE>::value) == 0;
+        std::vector<CELL_TYPE> buffer;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> cursor = i->origin;
+
+            // on periodic topologies streaks may wrap around the grid:
+            while (cursor.x() < i->endX) {
+                Coord<DIM> normalized = Topology::normalize(cursor, dimensions);
+                if (Topology::isOutOfBounds(normalized, dimensions)) {
+                    cursor.x() += 1;
+                    continue;
+                }
+
+                int length = (std::min)(i->endX - cursor.x(), dimensions.x() - normalized.x());
+                Streak<DIM> streak(cursor, cursor.x() + length);
+                const char *source = cells + normalized.toIndex(dimensions) * sizeof(CELL_TYPE);
+
+                if (aligned) {
+                    target->set(streak, reinterpret_cast<const CELL_TYPE*>(source));
+                } else {
+                    buffer.resize(length);
+                    std::memcpy(&buffer[0], source, length * sizeof(CELL_TYPE));
+                    target->set(streak, &buffer[0]);
+                }
+
+                cursor.x() += length;
+            }
+        }
+    }
+
+    virtual void initEdge(GridBase<CELL_TYPE, DIM> *target)
+    {
+        target->setEdge(edgeCell);
+    }
+
+    virtual Coord<DIM> gridDimensions() const
+    {
+        return dimensions;
+    }
+
+    virtual unsigned startStep() const
+    {
+        return currentStep;
+    }
+
+    virtual unsigned maxSteps() const
+    {
+        return maximumSteps;
+    }
+
+private:
+    boost::shared_ptr<MappedFile> file;
+    Coord<DIM> dimensions;
+    unsigned currentStep;
+    unsigned maximumSteps;
+    CELL_TYPE edgeCell;
+
+    void readHeader()
+    {
+        if (file->size() < HEADER_LENGTH) {
+            throw FileReadException(file->name());
+        }
+
+        const char *cursor = file->data();
+        extract(&cursor, &dimensions);
+        extract(&cursor, &currentStep);
+        extract(&cursor, &maximumSteps);
+        extract(&cursor, &edgeCell);
+
+        if (file->size() < HEADER_LENGTH + dimensions.prod() * sizeof(CELL_TYPE)) {
+            throw FileReadException(file->name());
+        }
+    }
+
+    template<typename T>
+    static void extract(const char **cursor, T *value)
+    {
+        std::memcpy(value, *cursor, sizeof(T));
+        *cursor += sizeof(T);
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -7,9 +7,17 @@
 
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/communication/typemaps.h>
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/ioexception.h>
 #include <libgeodecomp/loadbalancer/randombalancer.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <utility>
+#include <vector>
+
 namespace LibGeoDecomp {
 
 template<
@@ -19,6 +27,17 @@ template<
 class MPIIO
 {
 public:
+    explicit MPIIO(std::size_t readChunkSize = 1 << 18) :
+        readChunkSize(readChunkSize)
+    {}
+
+    /**
+     * Reads a snapshot written by writeRegion(). The cells of
+     * region are read in chunks of about readChunkSize cells, each
+     * via a collective file view, so the file's layout doesn't need
+     * to match the current decomposition. Chunks are read with split
+     * collectives while the previous chunk is being unpacked.
+     */
     template<typename GRID_TYPE, int DIM>
     void readRegion(
         GRID_TYPE *grid,
@@ -39,22 +58,42 @@ public:
         MPI_File_read(file, &cell, 1, mpiDatatype, MPI_STATUS_IGNORE);
         grid->setEdge(cell);
 
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
+        // split collectives may hang on reads beyond the end of the
+        // file, so truncated snapshots are rejected upfront:
+        MPI_Offset fileSize;
+        MPI_File_get_size(file, &fileSize);
+        int localTruncated = regionEnd(region, dimensions, headerLength, cellLength) > fileSize;
+        int truncated = 0;
+        MPI_Allreduce(&localTruncated, &truncated, 1, MPI_INT, MPI_LOR, comm);
+        if (truncated) {
+            MPI_File_close(&file);
+            throw FileReadException(filename);
+        }
+
+        // all ranks need to participate in each collective read:
+        std::vector<Region<DIM> > chunks = splitRegion(region);
+        int localChunks = chunks.size();
+        int numChunks = 0;
+        MPI_Allreduce(&localChunks, &numChunks, 1, MPI_INT, MPI_MAX, comm);
+        chunks.resize(numChunks);
 
-            MPI_File_read(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
-            grid->set(*i, &vec[0]);
+        std::vector<CELL_TYPE> buffers[2];
+        std::vector<Streak<DIM> > streaks[2];
+        for (int i = 0; i < numChunks; ++i) {
+            int current = i % 2;
+            streaks[current] = setView(file, headerLength, chunks[i], dimensions, mpiDatatype);
+            buffers[current].resize(chunks[i].size());
+            CELL_TYPE *data = buffers[current].empty() ? 0 : &buffers[current][0];
+
+            MPI_File_read_all_begin(file, data, buffers[current].size(), mpiDatatype);
+            if (i > 0) {
+                unpack(grid, streaks[1 - current], buffers[1 - current]);
+            }
+            MPI_File_read_all_end(file, data, MPI_STATUS_IGNORE);
+        }
+        if (numChunks > 0) {
+            int last = (numChunks - 1) % 2;
+            unpack(grid, streaks[last], buffers[last]);
         }
 
         MPI_File_close(&file);
@@ -108,25 +147,18 @@ public:
                            1, mpiDatatype,  MPI_STATUS_IGNORE);
         }
 
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
-
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
-            grid.get(*i, &vec[0]);
+        std::vector<Streak<DIM> > streaks = setView(file, headerLength, region, dimensions, mpiDatatype);
+        std::vector<CELL_TYPE> buffer(region.size());
+        CELL_TYPE *data = buffer.empty() ? 0 : &buffer[0];
 
-            MPI_File_write(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
+        for (typename std::vector<Streak<DIM> >::iterator i = streaks.begin(); i != streaks.end(); ++i) {
+            grid.get(*i, data);
+            data += i->length();
         }
 
+        data = buffer.empty() ? 0 : &buffer[0];
+        MPI_File_write_all(file, data, buffer.size(), mpiDatatype, MPI_STATUS_IGNORE);
+
         MPI_File_close(&file);
     }
 
@@ -157,6 +189,81 @@ public:
         return file;
     }
 
+    /**
+     * Restricts the file's view to the cells of the given region
+     * (behind a header of headerLength bytes, cells are expected in
+     * row-major order). This is a collective operation. The
+     * region's streaks are returned in the order in which they
+     * appear in the file, which is also the order in which buffers
+     * for MPI_File_write_all() and MPI_File_read_all() need to be
+     * packed.
+     */
+    template<int DIM>
+    std::vector<Streak<DIM> > setView(
+        MPI_File file,
+        const MPI_Offset& headerLength,
+        const Region<DIM>& region,
+        const Coord<DIM>& dimensions,
+        const MPI_Datatype& cellType)
+    {
+        MPI_Aint cellLength = getLength(cellType);
+        std::vector<std::pair<MPI_Aint, Streak<DIM> > > offsets;
+        offsets.reserve(region.numStreaks());
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            // the coords need to be normalized because on torus
+            // topologies the coordnates may exceed the bounding box
+            // (especially negative coordnates may occurr).
+            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
+            offsets.push_back(std::make_pair(
+                                  offset(0, coord, dimensions, cellLength),
+                                  *i));
+        }
+
+        // file views need non-decreasing offsets, which normalized
+        // streaks may violate:
+        std::stable_sort(offsets.begin(), offsets.end(), OffsetLess<DIM>());
+
+        std::vector<Streak<DIM> > streaks;
+        std::vector<int> blockLengths;
+        std::vector<MPI_Aint> displacements;
+        streaks.reserve(offsets.size());
+
+        for (std::size_t i = 0; i < offsets.size(); ++i) {
+            streaks.push_back(offsets[i].second);
+            int length = offsets[i].second.length();
+
+            // adjacent streaks (e.g. rows of a box which spans the
+            // whole x-axis) are merged into a single block:
+            if (!displacements.empty() &&
+                (displacements.back() + blockLengths.back() * cellLength == offsets[i].first)) {
+                blockLengths.back() += length;
+                continue;
+            }
+
+            blockLengths.push_back(length);
+            displacements.push_back(offsets[i].first);
+        }
+
+        // MPI doesn't accept null pointers, even for empty views:
+        int dummyLength = 0;
+        MPI_Aint dummyDisplacement = 0;
+        MPI_Datatype fileType;
+        MPI_Type_create_hindexed(
+            blockLengths.size(),
+            blockLengths.empty() ? &dummyLength : &blockLengths[0],
+            displacements.empty() ? &dummyDisplacement : &displacements[0],
+            cellType,
+            &fileType);
+        MPI_Type_commit(&fileType);
+        MPI_File_set_view(file, headerLength, cellType, fileType, const_cast<char*>("native"), MPI_INFO_NULL);
+        MPI_Type_free(&fileType);
+
+        return streaks;
+    }
+
     MPI_Aint getLength(const MPI_Datatype& datatype)
     {
         MPI_Aint length;
@@ -165,9 +272,150 @@ public:
         return length;
     }
 
+    /**
+     * Stores costs in a small text file alongside a snapshot, see
+     * ParallelMPIIOWriter::setCostFunction().
+     */
+    template<int DIM>
+    void writeCostMap(const CostMap<DIM>& costs, const std::string& filename)
+    {
+        std::ofstream file(filename.c_str());
+        if (!file) {
+            throw FileOpenException(filename);
+        }
+
+        file << DIM << "\n";
+        for (int d = 0; d < DIM; ++d) {
+            file << costs.boundingBox().origin[d] << " "
+                 << costs.boundingBox().dimensions[d] << " "
+                 << costs.getBlockDim()[d] << "\n";
+        }
+
+        file << std::setprecision(17);
+        CoordBox<DIM> blocks(Coord<DIM>(), costs.getNumBlocks());
+        for (typename CoordBox<DIM>::Iterator i = blocks.begin(); i != blocks.end(); ++i) {
+            file << costs[blockOrigin(costs, *i)] << "\n";
+        }
+
+        if (!file) {
+            throw FileWriteException(filename);
+        }
+    }
+
+    template<int DIM>
+    CostMap<DIM> readCostMap(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        if (!file) {
+            throw FileOpenException(filename);
+        }
+
+        int dim = 0;
+        file >> dim;
+        if (dim != DIM) {
+            throw FileReadException(filename);
+        }
+
+        CoordBox<DIM> box;
+        Coord<DIM> blockDim;
+        for (int d = 0; d < DIM; ++d) {
+            file >> box.origin[d] >> box.dimensions[d] >> blockDim[d];
+        }
+        if (!file) {
+            throw FileReadException(filename);
+        }
+
+        CostMap<DIM> costs(box, blockDim);
+        CoordBox<DIM> blocks(Coord<DIM>(), costs.getNumBlocks());
+        for (typename CoordBox<DIM>::Iterator i = blocks.begin(); i != blocks.end(); ++i) {
+            double cost;
+            if (!(file >> cost)) {
+                throw FileReadException(filename);
+            }
+            costs.set(blockOrigin(costs, *i), cost);
+        }
+
+        return costs;
+    }
+
 private:
     // fixme: use MPILayer for MPI-IO
     MPILayer mpiLayer;
+    std::size_t readChunkSize;
+
+    template<int DIM>
+    static Coord<DIM> blockOrigin(const CostMap<DIM>& costs, const Coord<DIM>& block)
+    {
+        return costs.boundingBox().origin + block.scale(costs.getBlockDim());
+    }
+
+    /**
+     * Cuts region into chunks of whole streaks with about
+     * readChunkSize cells each.
+     */
+    template<int DIM>
+    std::vector<Region<DIM> > splitRegion(const Region<DIM>& region) const
+    {
+        std::vector<Region<DIM> > ret;
+        Region<DIM> chunk;
+        std::size_t chunkCells = 0;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            chunk << *i;
+            chunkCells += i->length();
+            if (chunkCells >= readChunkSize) {
+                ret << chunk;
+                chunk.clear();
+                chunkCells = 0;
+            }
+        }
+        if (chunkCells > 0) {
+            ret << chunk;
+        }
+
+        return ret;
+    }
+
+    template<int DIM>
+    MPI_Offset regionEnd(
+        const Region<DIM>& region,
+        const Coord<DIM>& dimensions,
+        const MPI_Offset& headerLength,
+        const MPI_Aint& cellLength)
+    {
+        MPI_Offset ret = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
+            ret = (std::max)(ret, offset(headerLength, coord, dimensions, cellLength) + i->length() * cellLength);
+        }
+
+        return ret;
+    }
+
+    template<typename GRID_TYPE, int DIM>
+    static void unpack(
+        GRID_TYPE *grid,
+        const std::vector<Streak<DIM> >& streaks,
+        const std::vector<CELL_TYPE>& buffer)
+    {
+        const CELL_TYPE *data = buffer.empty() ? 0 : &buffer[0];
+        for (typename std::vector<Streak<DIM> >::const_iterator i = streaks.begin(); i != streaks.end(); ++i) {
+            grid->set(*i, data);
+            data += i->length();
+        }
+    }
+
+    template<int DIM>
+    class OffsetLess
+    {
+    public:
+        inline bool operator()(
+            const std::pair<MPI_Aint, Streak<DIM> >& a,
+            const std::pair<MPI_Aint, Streak<DIM> >& b) const
+        {
+            return a.first < b.first;
+        }
+    };
 
     template<int DIM>
     MPI_Offset offset(
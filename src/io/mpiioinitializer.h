@@ -8,6 +8,8 @@
 #include <libgeodecomp/io/initializer.h>
 #include <libgeodecomp/io/mpiio.h>
 
+#include <fstream>
+
 namespace LibGeoDecomp {
 
 /**
@@ -16,6 +18,11 @@ namespace LibGeoDecomp {
  * long-running jobs which might either be shot down because of wall
  * clock limitations or node failures: here checkpoints can save
  * captital amounts of compute time.
+ *
+ * Each rank reads only its own part of the grid, so the run may be
+ * restarted on any number of ranks. If the snapshot comes with a
+ * CostMap (see ParallelMPIIOWriter::setCostFunction()), it will be
+ * used for the initial domain decomposition.
  */
 template<typename CELL_TYPE>
 class MPIIOInitializer : public Initializer<CELL_TYPE>
@@ -34,6 +41,11 @@ public:
     {
         mpiio.readMetadata(
             &dimensions, &currentStep, &maximumSteps, file, communicator);
+
+        std::string costMapFile = filename + ".costs";
+        if (std::ifstream(costMapFile.c_str())) {
+            costs = mpiio.template readCostMap<DIM>(costMapFile);
+        }
     }
 
     virtual void grid(GridBase<CELL_TYPE, DIM> *target)
@@ -43,6 +55,11 @@ public:
         mpiio.readRegion(target, file, region, communicator, datatype);
     }
 
+    virtual CostMap<DIM> getCostMap() const
+    {
+        return costs;
+    }
+
     virtual Coord<DIM> gridDimensions() const
     {
         return dimensions;
@@ -66,6 +83,7 @@ private:
     unsigned currentStep;
     unsigned maximumSteps;
     Coord<DIM> dimensions;
+    CostMap<DIM> costs;
 };
 
 }
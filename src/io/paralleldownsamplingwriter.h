@@ -0,0 +1,92 @@
+#ifndef LIBGEODECOMP_IO_PARALLELDOWNSAMPLINGWRITER_H
+#define LIBGEODECOMP_IO_PARALLELDOWNSAMPLINGWRITER_H
+
+#include <libgeodecomp/io/downsamplingwriter.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * ParallelWriter counterpart of DownsamplingWriter: each rank
+ * samples its part of the grid locally, so that the delegate (e.g. a
+ * BOVWriter or a CollectingWriter) only ever sees the coarse grid.
+ * Thus both file size and gather traffic scale with the monitoring
+ * resolution. Coarse cells are owned by the rank which owns the fine
+ * cell they were sampled from.
+ */
+template<typename CELL_TYPE>
+class ParallelDownsamplingWriter : public Clonable<ParallelWriter<CELL_TYPE>, ParallelDownsamplingWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> StorageGridType;
+
+    using ParallelWriter<CELL_TYPE>::region;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * Samples every stride-th cell of regionOfInterest (or the
+     * whole grid, if left empty). Takes ownership of writer.
+     */
+    ParallelDownsamplingWriter(
+        ParallelWriter<CELL_TYPE> *writer,
+        const Coord<DIM>& stride,
+        const CoordBox<DIM>& regionOfInterest = CoordBox<DIM>()) :
+        Clonable<ParallelWriter<CELL_TYPE>, ParallelDownsamplingWriter<CELL_TYPE> >(
+            writer->getPrefix(),
+            writer->getPeriod()),
+        writer(writer),
+        sampler(stride, regionOfInterest)
+    {}
+
+    virtual void setRegion(const Region<DIM>& newRegion)
+    {
+        ParallelWriter<CELL_TYPE>::setRegion(newRegion);
+        // the coarse region depends on the global dimensions, which
+        // we'll only learn in stepFinished():
+        lastGlobalDimensions = Coord<DIM>();
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if (globalDimensions != lastGlobalDimensions) {
+            lastGlobalDimensions = globalDimensions;
+            Region<DIM> coarseRegion = sampler.coarsen(region, globalDimensions);
+            coarseGrid.resize(coarseRegion.boundingBox());
+            writer->setRegion(coarseRegion);
+        }
+
+        Region<DIM> coarseValidRegion = sampler.coarsen(validRegion, globalDimensions);
+        sampler.copy(grid, &coarseGrid, coarseValidRegion, globalDimensions);
+
+        writer->stepFinished(
+            coarseGrid,
+            coarseValidRegion,
+            sampler.coarseDimensions(globalDimensions),
+            step,
+            event,
+            rank,
+            lastCall);
+    }
+
+private:
+    boost::shared_ptr<ParallelWriter<CELL_TYPE> > writer;
+    DownsamplingWriterHelpers::Sampler<DIM> sampler;
+    StorageGridType coarseGrid;
+    Coord<DIM> lastGlobalDimensions;
+};
+
+}
+
+#endif
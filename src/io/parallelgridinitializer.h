@@ -0,0 +1,136 @@
+#ifndef LIBGEODECOMP_IO_PARALLELGRIDINITIALIZER_H
+#define LIBGEODECOMP_IO_PARALLELGRIDINITIALIZER_H
+
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/storage/copyregion.h>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace LibGeoDecomp {
+
+/**
+ * Sets up grids for multi-threaded Simulators and Steppers: if the
+ * Initializer supports it, the grid's planes are initialized from
+ * multiple OpenMP threads, using the same static schedule as the
+ * UpdateFunctor. Together with the FirstTouchAllocator this ensures
+ * that the data each thread updates resides in its NUMA domain.
+ *
+ * The second grid of a Simulator is then set up by copying the first
+ * one (again plane-wise in parallel), instead of invoking the
+ * Initializer a second time.
+ */
+template<typename CELL>
+class ParallelGridInitializer
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    static const int DIM = Topology::DIM;
+
+    explicit ParallelGridInitializer(bool enableOpenMP = true) :
+        enableOpenMP(enableOpenMP)
+    {}
+
+    /**
+     * Initializes all cells of target.
+     */
+    void operator()(Initializer<CELL> *initializer, GridBase<CELL, DIM> *target) const
+    {
+        if (!enableOpenMP || !initializer->supportsParallelInit()) {
+            initializer->grid(target);
+            return;
+        }
+
+        Region<DIM> region;
+        region << target->boundingBox();
+        (*this)(initializer, target, region);
+    }
+
+    /**
+     * Initializes only the cells of target within region (e.g. a
+     * process' own region plus its ghost zone), which is useful if
+     * the grid's bounding box is much larger than the region, or if
+     * the Initializer reads from a file. Initializers which don't
+     * support parallel initialization will set up the whole grid.
+     */
+    void operator()(
+        Initializer<CELL> *initializer,
+        GridBase<CELL, DIM> *target,
+        const Region<DIM>& region) const
+    {
+        if (!initializer->supportsParallelInit()) {
+            initializer->grid(target);
+            return;
+        }
+
+        initializer->initEdge(target);
+        long numPlanes = region.numPlanes();
+
+#pragma omp parallel for schedule(static) if(enableOpenMP)
+        for (long i = 0; i < numPlanes; ++i) {
+            initializer->initRegion(target, plane(region, i));
+        }
+    }
+
+    /**
+     * Sets up target as a copy of source (which has already been set
+     * up by the Initializer). Both grids need to have the same
+     * bounding box. Unstructured grids carry state beyond their cells
+     * (e.g. adjacency weights) which can't be copied via GridBase, so
+     * these are set up by the Initializer instead.
+     */
+    void replicate(
+        Initializer<CELL> *initializer,
+        const GridBase<CELL, DIM>& source,
+        GridBase<CELL, DIM> *target) const
+    {
+        if (boost::is_same<Topology, TopologiesHelpers::UnstructuredTopology>::value) {
+            (*this)(initializer, target);
+            return;
+        }
+
+        Region<DIM> region;
+        region << source.boundingBox();
+        replicate(initializer, source, target, region);
+    }
+
+    /**
+     * Same as above, but copies only the cells within region.
+     */
+    void replicate(
+        Initializer<CELL> *initializer,
+        const GridBase<CELL, DIM>& source,
+        GridBase<CELL, DIM> *target,
+        const Region<DIM>& region) const
+    {
+        if (boost::is_same<Topology, TopologiesHelpers::UnstructuredTopology>::value) {
+            (*this)(initializer, target, region);
+            return;
+        }
+
+        target->setEdge(source.getEdge());
+        long numPlanes = region.numPlanes();
+
+#pragma omp parallel for schedule(static) if(enableOpenMP)
+        for (long i = 0; i < numPlanes; ++i) {
+            copyRegion(source, target, plane(region, i));
+        }
+    }
+
+private:
+    bool enableOpenMP;
+
+    static Region<DIM> plane(const Region<DIM>& region, const long index)
+    {
+        Region<DIM> ret;
+        typename Region<DIM>::StreakIterator end = region.planeStreakIterator(index + 1);
+        for (typename Region<DIM>::StreakIterator i = region.planeStreakIterator(index); i != end; ++i) {
+            ret << *i;
+        }
+
+        return ret;
+    }
+};
+
+}
+
+#endif
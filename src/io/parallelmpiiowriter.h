@@ -5,17 +5,81 @@
 #ifdef LIBGEODECOMP_WITH_MPI
 
 #include <libgeodecomp/communication/typemaps.h>
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/io/mpiio.h>
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <map>
+#include <numeric>
 
 namespace LibGeoDecomp {
 
+namespace ParallelMPIIOWriterHelpers {
+
+/**
+ * Type erasure for the cost functions passed to
+ * ParallelMPIIOWriter::setCostFunction().
+ */
+template<typename CELL, int DIM>
+class CostSamplerBase
+{
+public:
+    virtual ~CostSamplerBase()
+    {}
+
+    virtual void accumulate(
+        const GridBase<CELL, DIM>& grid,
+        const Region<DIM>& region,
+        const CostMap<DIM>& costs,
+        std::vector<double> *sums,
+        std::vector<double> *counts) const = 0;
+
+    virtual const Coord<DIM>& blockDim() const = 0;
+};
+
+template<typename CELL, int DIM, typename COST_FUNCTION>
+class CostSampler : public CostSamplerBase<CELL, DIM>
+{
+public:
+    CostSampler(const COST_FUNCTION& function, const Coord<DIM>& blockDim) :
+        function(function),
+        myBlockDim(blockDim)
+    {}
+
+    void accumulate(
+        const GridBase<CELL, DIM>& grid,
+        const Region<DIM>& region,
+        const CostMap<DIM>& costs,
+        std::vector<double> *sums,
+        std::vector<double> *counts) const
+    {
+        costs.accumulate(grid, region, function, sums, counts);
+    }
+
+    const Coord<DIM>& blockDim() const
+    {
+        return myBlockDim;
+    }
+
+private:
+    COST_FUNCTION function;
+    Coord<DIM> myBlockDim;
+};
+
+}
+
 /**
  * Just like MPIIOWriter, this class will generate snapshots of the
  * simulation for checkpoint/restart capabilities. Use this class for
  * parallel runs. Consider MPIIOInitializer for restarting from a
  * snapshot.
+ *
+ * Snapshots may be used to restart on a different number of ranks.
+ * To let the restarted run start out balanced, setCostFunction() will
+ * store a CostMap, sampled from the snapshot's cells, next to each
+ * snapshot. MPIIOInitializer hands it on to the Simulator.
  */
 template<typename CELL_TYPE>
 class ParallelMPIIOWriter : public Clonable<ParallelWriter<CELL_TYPE>, ParallelMPIIOWriter<CELL_TYPE> >
@@ -38,6 +102,21 @@ public:
         comm(communicator)
     {}
 
+    /**
+     * Sets up the CostMap which will be stored along with each
+     * snapshot. function maps cells to their (estimated)
+     * computational cost, the costs of each block of blockDim cells
+     * are averaged. There is deliberately no default for blockDim:
+     * rank 0 holds one entry per block, so blocks should be
+     * considerably larger than a single cell.
+     */
+    template<typename COST_FUNCTION>
+    void setCostFunction(const COST_FUNCTION& function, const Coord<DIM>& blockDim)
+    {
+        costSampler.reset(
+            new ParallelMPIIOWriterHelpers::CostSampler<CELL_TYPE, DIM, COST_FUNCTION>(function, blockDim));
+    }
+
     virtual void stepFinished(
         const GridType& grid,
         const Region<Topology::DIM>& validRegion,
@@ -60,12 +139,24 @@ public:
             validRegion,
             APITraits::SelectMPIDataType<CELL_TYPE>::value(),
             comm);
+
+        if (costSampler) {
+            sampleCosts(grid, validRegion, globalDimensions, step, lastCall);
+        }
+    }
+
+    std::string costMapFilename(unsigned step) const
+    {
+        return filename(step) + ".costs";
     }
 
 private:
     MPIIO<CELL_TYPE> mpiio;
     unsigned maxSteps;
     MPI_Comm comm;
+    boost::shared_ptr<ParallelMPIIOWriterHelpers::CostSamplerBase<CELL_TYPE, DIM> > costSampler;
+    std::map<std::size_t, double> costSums;
+    std::map<std::size_t, double> costCounts;
 
     std::string filename(unsigned step) const
     {
@@ -73,6 +164,105 @@ private:
         buf << prefix << std::setfill('0') << std::setw(5) << step << ".mpiio";
         return buf.str();
     }
+
+    /**
+     * Costs are accumulated over all calls for a step. Each rank
+     * only keeps the blocks its regions touch, these are gathered
+     * on rank 0 and written once the step is complete.
+     */
+    void sampleCosts(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        bool lastCall)
+    {
+        accumulateCosts(grid, validRegion, globalDimensions);
+
+        if (!lastCall) {
+            return;
+        }
+
+        std::vector<std::size_t> blocks;
+        std::vector<double> sums;
+        std::vector<double> counts;
+        for (std::map<std::size_t, double>::iterator i = costSums.begin(); i != costSums.end(); ++i) {
+            blocks << i->first;
+            sums << i->second;
+            counts << costCounts[i->first];
+        }
+        costSums.clear();
+        costCounts.clear();
+
+        MPILayer mpiLayer(comm);
+        std::vector<int> lengths = mpiLayer.gather(int(blocks.size()), 0);
+        int total = std::accumulate(lengths.begin(), lengths.end(), 0);
+        std::vector<std::size_t> allBlocks(total);
+        std::vector<double> allSums(total);
+        std::vector<double> allCounts(total);
+        mpiLayer.gatherV(blocks, lengths, 0, allBlocks);
+        mpiLayer.gatherV(sums,   lengths, 0, allSums);
+        mpiLayer.gatherV(counts, lengths, 0, allCounts);
+
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        CostMap<DIM> costs(CoordBox<DIM>(Coord<DIM>(), globalDimensions), costSampler->blockDim());
+        std::size_t numBlocks = costs.getNumBlocks().prod();
+        std::vector<double> globalSums(numBlocks, 0);
+        std::vector<double> globalCounts(numBlocks, 0);
+        for (int i = 0; i < total; ++i) {
+            globalSums[allBlocks[i]]   += allSums[i];
+            globalCounts[allBlocks[i]] += allCounts[i];
+        }
+
+        costs.setAverages(globalSums, globalCounts);
+        mpiio.writeCostMap(costs, costMapFilename(step));
+    }
+
+    /**
+     * Samples validRegion into a CostMap which only spans the blocks
+     * of its bounding box and adds the results to costSums and
+     * costCounts, indexed by the global block number.
+     */
+    void accumulateCosts(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions)
+    {
+        if (validRegion.empty()) {
+            return;
+        }
+
+        const Coord<DIM>& blockDim = costSampler->blockDim();
+        Coord<DIM> globalBlocks;
+        CoordBox<DIM> boundingBox = validRegion.boundingBox();
+        Coord<DIM> firstBlock;
+        Coord<DIM> endBlock;
+        for (int d = 0; d < DIM; ++d) {
+            firstBlock[d] = boundingBox.origin[d] / blockDim[d];
+            endBlock[d] = (boundingBox.origin[d] + boundingBox.dimensions[d] + blockDim[d] - 1) / blockDim[d];
+            globalBlocks[d] = (globalDimensions[d] + blockDim[d] - 1) / blockDim[d];
+        }
+
+        CostMap<DIM> localCosts(
+            CoordBox<DIM>(firstBlock.scale(blockDim), (endBlock - firstBlock).scale(blockDim)),
+            blockDim);
+        std::size_t numBlocks = localCosts.getNumBlocks().prod();
+        std::vector<double> sums(numBlocks, 0);
+        std::vector<double> counts(numBlocks, 0);
+        costSampler->accumulate(grid, validRegion, localCosts, &sums, &counts);
+
+        for (std::size_t i = 0; i < numBlocks; ++i) {
+            if (counts[i] > 0) {
+                Coord<DIM> block = firstBlock + localCosts.getNumBlocks().indexToCoord(i);
+                std::size_t index = block.toIndex(globalBlocks);
+                costSums[index]   += sums[i];
+                costCounts[index] += counts[i];
+            }
+        }
+    }
 };
 
 }
@@ -0,0 +1,333 @@
+#ifndef LIBGEODECOMP_IO_PARALLELSILOWRITER_H
+#define LIBGEODECOMP_IO_PARALLELSILOWRITER_H
+
+#include <libgeodecomp/config.h>
+#if defined(LIBGEODECOMP_WITH_SILO) && defined(LIBGEODECOMP_WITH_MPI)
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/io/silowriter.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <iomanip>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+/**
+ * Parallel counterpart of the SiloWriter: instead of gathering the
+ * grid on one node (as CollectingWriter would), each rank writes its
+ * own part of the grid as a separate domain. Ranks are split into
+ * numFiles groups of consecutive ranks, each of which shares one
+ * domain file ("prefix.NNNNN.domains.FFFFF.silo"), ranks of a group
+ * take turns (baton passing, see Silo's PMPIO). Thus numFiles can be tuned to
+ * the file system: one file per rank maximizes concurrency, fewer
+ * files reduce the metadata load. Rank 0 additionally writes
+ * "prefix.NNNNN.silo" which contains multi-block meshes and variables
+ * referencing all domains, so visualization tools (VisIt) can open
+ * the time step just like SiloWriter's output.
+ *
+ * Meshes, variables and labels are taken from the SiloWriter passed
+ * to the c-tor. Domains without any particles or shapes are listed
+ * as "EMPTY" blocks of the corresponding meshes.
+ */
+template<typename CELL>
+class ParallelSiloWriter : public Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >
+{
+public:
+    typedef typename ParallelWriter<CELL>::GridType GridType;
+    typedef typename ParallelWriter<CELL>::Topology Topology;
+    typedef DisplacedGrid<CELL, Topology> BufferType;
+
+    using ParallelWriter<CELL>::period;
+    using ParallelWriter<CELL>::prefix;
+    using ParallelWriter<CELL>::region;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * Writes the same meshes and variables as prototype, to
+     * numFiles domain files per time step. numFiles == 0 yields one
+     * file per rank.
+     */
+    explicit ParallelSiloWriter(
+        const SiloWriter<CELL>& prototype,
+        unsigned numFiles = 0,
+        const MPI_Comm& communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >(prototype.getPrefix(), prototype.getPeriod()),
+        siloWriter(prototype),
+        comm(communicator),
+        lastStep(0),
+        haveLastStep(false),
+        stepBoundary(true),
+        skipStep(false)
+    {
+        MPILayer mpiLayer(comm);
+        unsigned size = mpiLayer.size();
+        if ((numFiles == 0) || (numFiles > size)) {
+            numFiles = size;
+        }
+
+        this->numFiles = numFiles;
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        if (stepBoundary) {
+            stepBoundary = false;
+            // Simulators report the final step twice (STEP_FINISHED
+            // and ALL_DONE), but it needs to be written only once:
+            skipStep = haveLastStep && (step == lastStep);
+            if (!skipStep) {
+                CoordBox<DIM> box = region.empty() ? grid.boundingBox() : region.boundingBox();
+                if (!buffer || (buffer->boundingBox() != box)) {
+                    buffer.reset(new BufferType(box));
+                }
+                domain.clear();
+            }
+        }
+
+        // the ghost zone is only valid during its own call, so we
+        // need to copy each chunk right away:
+        if (!skipStep) {
+            copyRegion(grid, validRegion);
+            domain += validRegion;
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        stepBoundary = true;
+        if (skipStep) {
+            return;
+        }
+
+        writeDomain(step);
+        writeMasterFile(step);
+
+        lastStep = step;
+        haveLastStep = true;
+    }
+
+    std::string domainFilename(unsigned step, unsigned fileIndex) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "." << std::setfill('0') << std::setw(5) << step
+            << ".domains." << std::setw(5) << fileIndex << ".silo";
+        return buf.str();
+    }
+
+    std::string masterFilename(unsigned step) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "." << std::setfill('0') << std::setw(5) << step << ".silo";
+        return buf.str();
+    }
+
+private:
+    SiloWriter<CELL> siloWriter;
+    MPI_Comm comm;
+    unsigned numFiles;
+    boost::shared_ptr<BufferType> buffer;
+    Region<DIM> domain;
+    unsigned lastStep;
+    bool haveLastStep;
+    bool stepBoundary;
+    bool skipStep;
+
+    static std::string directoryName(int rank)
+    {
+        std::ostringstream buf;
+        buf << "domain_" << std::setfill('0') << std::setw(5) << rank;
+        return buf.str();
+    }
+
+    void copyRegion(const GridType& grid, const Region<DIM>& validRegion)
+    {
+        std::vector<CELL> cells;
+        for (typename Region<DIM>::StreakIterator i = validRegion.beginStreak();
+             i != validRegion.endStreak();
+             ++i) {
+            cells.resize(i->length());
+            grid.get(*i, &cells[0]);
+            buffer->set(*i, &cells[0]);
+        }
+    }
+
+    /**
+     * Maps ranks to domain files. Group sizes differ by at most one,
+     * and each of the numFiles files gets at least one rank.
+     */
+    unsigned fileIndex(int rank, int size) const
+    {
+        return std::size_t(rank) * numFiles / size;
+    }
+
+    /**
+     * The first rank of each group creates the domain file, the
+     * others wait for their predecessor to hand over the baton before
+     * appending their domain.
+     */
+    void writeDomain(unsigned step)
+    {
+        MPILayer mpiLayer(comm);
+        int rank = mpiLayer.rank();
+        int size = mpiLayer.size();
+        unsigned file = fileIndex(rank, size);
+        std::string filename = domainFilename(step, file);
+        int baton = 0;
+
+        DBfile *dbfile;
+        if ((rank == 0) || (fileIndex(rank - 1, size) != file)) {
+            dbfile = DBCreate(filename.c_str(), DB_CLOBBER, DB_LOCAL,
+                              "simulation time step", siloWriter.databaseType);
+        } else {
+            mpiLayer.recv(&baton, rank - 1, 1, MPILayer::PARALLEL_SILO_WRITER);
+            mpiLayer.wait(MPILayer::PARALLEL_SILO_WRITER);
+            dbfile = DBOpen(filename.c_str(), DB_UNKNOWN, DB_APPEND);
+        }
+
+        std::string directory = directoryName(rank);
+        DBMkDir(dbfile, directory.c_str());
+        DBSetDir(dbfile, directory.c_str());
+        siloWriter.writeDomain(dbfile, *buffer, domain);
+        DBClose(dbfile);
+
+        if ((rank + 1 < size) && (fileIndex(rank + 1, size) == file)) {
+            mpiLayer.send(&baton, rank + 1, 1, MPILayer::PARALLEL_SILO_WRITER);
+            mpiLayer.wait(MPILayer::PARALLEL_SILO_WRITER);
+        }
+    }
+
+    void writeMasterFile(unsigned step)
+    {
+        MPILayer mpiLayer(comm);
+        int size = mpiLayer.size();
+        int wroteMeshes[] = {
+            siloWriter.wroteRegularGrid,
+            siloWriter.wroteUnstructuredMesh,
+            siloWriter.wrotePointMesh
+        };
+        std::vector<int> allMeshes(3 * size);
+        mpiLayer.gatherV(wroteMeshes, 3, std::vector<int>(size, 3), 0, &allMeshes[0]);
+
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        DBfile *dbfile = DBCreate(masterFilename(step).c_str(), DB_CLOBBER, DB_LOCAL,
+                                  "simulation time step", siloWriter.databaseType);
+
+        std::vector<std::string> cellNames;
+        for (typename SiloWriter<CELL>::CellSelectorVec::iterator i = siloWriter.cellSelectors.begin();
+             i != siloWriter.cellSelectors.end();
+             ++i) {
+            cellNames << i->name();
+        }
+
+        writeMultiBlock(dbfile, step, allMeshes, 0, siloWriter.regularGridLabel,
+                        DB_QUADMESH, DB_QUADVAR, cellNames);
+        writeMultiBlock(dbfile, step, allMeshes, 1, siloWriter.unstructuredMeshLabel,
+                        DB_UCDMESH, DB_UCDVAR, siloWriter.unstructuredGridSelectors->names());
+        writeMultiBlock(dbfile, step, allMeshes, 2, siloWriter.pointMeshLabel,
+                        DB_POINTMESH, DB_POINTVAR, siloWriter.pointMeshSelectors->names());
+
+        DBClose(dbfile);
+    }
+
+    /**
+     * Adds a multi-block mesh and its variables to the master file,
+     * unless none of the ranks has written the mesh.
+     */
+    void writeMultiBlock(
+        DBfile *dbfile,
+        unsigned step,
+        const std::vector<int>& allMeshes,
+        int meshIndex,
+        const std::string& meshLabel,
+        int meshType,
+        int varType,
+        const std::vector<std::string>& varNames)
+    {
+        int size = allMeshes.size() / 3;
+        bool anyMesh = false;
+        for (int rank = 0; rank < size; ++rank) {
+            anyMesh = anyMesh || allMeshes[3 * rank + meshIndex];
+        }
+        if (!anyMesh) {
+            return;
+        }
+
+        putMulti(dbfile, step, allMeshes, meshIndex, meshLabel, meshLabel, meshType, true);
+        for (std::vector<std::string>::const_iterator i = varNames.begin(); i != varNames.end(); ++i) {
+            putMulti(dbfile, step, allMeshes, meshIndex, *i, meshLabel, varType, false);
+        }
+    }
+
+    void putMulti(
+        DBfile *dbfile,
+        unsigned step,
+        const std::vector<int>& allMeshes,
+        int meshIndex,
+        const std::string& name,
+        const std::string& meshLabel,
+        int type,
+        bool isMesh)
+    {
+        int size = allMeshes.size() / 3;
+        std::vector<std::string> blockNames;
+        for (int rank = 0; rank < size; ++rank) {
+            if (!allMeshes[3 * rank + meshIndex]) {
+                blockNames << "EMPTY";
+                continue;
+            }
+
+            // domain files reside next to the master file:
+            std::string filename = domainFilename(step, fileIndex(rank, size));
+            std::size_t slash = filename.find_last_of('/');
+            if (slash != std::string::npos) {
+                filename = filename.substr(slash + 1);
+            }
+            blockNames << filename + ":/" + directoryName(rank) + "/" + name;
+        }
+
+        std::vector<char*> names;
+        for (std::vector<std::string>::iterator i = blockNames.begin(); i != blockNames.end(); ++i) {
+            names << const_cast<char*>(i->c_str());
+        }
+        std::vector<int> types(size, type);
+
+        if (isMesh) {
+            DBPutMultimesh(dbfile, name.c_str(), size, &names[0], &types[0], NULL);
+            return;
+        }
+
+        DBoptlist *options = NULL;
+#ifdef DBOPT_MMESH_NAME
+        options = DBMakeOptlist(1);
+        DBAddOption(options, DBOPT_MMESH_NAME, const_cast<char*>(meshLabel.c_str()));
+#endif
+        DBPutMultivar(dbfile, name.c_str(), size, &names[0], &types[0], options);
+        if (options) {
+            DBFreeOptlist(options);
+        }
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HandlerTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/handlertest.h"
+
+static HandlerTest suite_HandlerTest;
+
+static CxxTest::List Tests_HandlerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HandlerTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/handlertest.h", 12, "HandlerTest", suite_HandlerTest, Tests_HandlerTest );
+
+static class TestDescription_suite_HandlerTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HandlerTest_testBasic() : CxxTest::RealTestDescription( Tests_HandlerTest, suiteDescription_HandlerTest, 34, "testBasic" ) {}
+ void runTest() { suite_HandlerTest.testBasic(); }
+} testDescription_suite_HandlerTest_testBasic;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PipeTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_4/pipetest.h"
+
+static PipeTest suite_PipeTest;
+
+static CxxTest::List Tests_PipeTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PipeTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_4/pipetest.h", 19, "PipeTest", suite_PipeTest, Tests_PipeTest );
+
+static class TestDescription_suite_PipeTest_testSyncSteeringRequests : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PipeTest_testSyncSteeringRequests() : CxxTest::RealTestDescription( Tests_PipeTest, suiteDescription_PipeTest, 22, "testSyncSteeringRequests" ) {}
+ void runTest() { suite_PipeTest.testSyncSteeringRequests(); }
+} testDescription_suite_PipeTest_testSyncSteeringRequests;
+
+static class TestDescription_suite_PipeTest_testSyncSteeringFeedback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PipeTest_testSyncSteeringFeedback() : CxxTest::RealTestDescription( Tests_PipeTest, suiteDescription_PipeTest, 44, "testSyncSteeringFeedback" ) {}
+ void runTest() { suite_PipeTest.testSyncSteeringFeedback(); }
+} testDescription_suite_PipeTest_testSyncSteeringFeedback;
+
+static class TestDescription_suite_PipeTest_testWaitForFeedback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PipeTest_testWaitForFeedback() : CxxTest::RealTestDescription( Tests_PipeTest, suiteDescription_PipeTest, 81, "testWaitForFeedback" ) {}
+ void runTest() { suite_PipeTest.testWaitForFeedback(); }
+} testDescription_suite_PipeTest_testWaitForFeedback;
+
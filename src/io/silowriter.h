@@ -12,6 +12,9 @@ namespace LibGeoDecomp {
 template<typename CELL>
 class SiloWriter;
 
+template<typename CELL>
+class ParallelSiloWriter;
+
 }
 
 #ifdef LIBGEODECOMP_WITH_SILO
@@ -126,6 +129,9 @@ public:
     virtual
     void callbackHandleVariableForPointMesh(SILO_WRITER *writer, DBfile *dbfile, const GridType& grid) = 0;
 
+    virtual
+    std::vector<std::string> names() = 0;
+
 protected:
     int typeId;
     SelectorVecBase *selectors;
@@ -180,6 +186,17 @@ public:
         }
     }
 
+    std::vector<std::string> names()
+    {
+        std::vector<std::string> ret;
+        SelectorVec<Cargo> *mySelectors = static_cast<SelectorVec<Cargo>*>(selectors);
+        for (typename SelectorVec<Cargo>::iterator i = mySelectors->begin(); i != mySelectors->end(); ++i) {
+            ret << i->name();
+        }
+
+        return ret;
+    }
+
 private:
     COLLECTION_INTERFACE collectionInterface;
 };
@@ -194,6 +211,9 @@ private:
  *
  * Per default, all variables are scalar. If you need to write vectorial
  * data, add a selector for each vector component.
+ *
+ * For distributed runs wrap a SiloWriter in a ParallelSiloWriter
+ * instead of a CollectingWriter.
  */
 template<typename CELL>
 class SiloWriter : public Clonable<Writer<CELL>, SiloWriter<CELL> >
@@ -201,6 +221,7 @@ class SiloWriter : public Clonable<Writer<CELL>, SiloWriter<CELL> >
 public:
     friend class Serialization;
     friend class boost::serialization::access;
+    friend class ParallelSiloWriter<CELL>;
 
     template<typename SILO_WRITER, typename COLLECTION_INTERFACE>
     friend class SiloWriterHelpers::SelectorContainerImplementation;
@@ -387,16 +408,9 @@ public:
         DBfile *dbfile = DBCreate(filename.str().c_str(), DB_CLOBBER, DB_LOCAL,
                                   "simulation time step", databaseType);
 
-        handleUnstructuredGrid(dbfile, grid, typename APITraits::SelectUnstructuredGrid<Cell>::Value());
-        handlePointMesh(       dbfile, grid, typename APITraits::SelectPointMesh<       Cell>::Value());
-        handleRegularGrid(     dbfile, grid, typename APITraits::SelectRegularGrid<     Cell>::Value());
-
-        for (typename CellSelectorVec::iterator i = cellSelectors.begin(); i != cellSelectors.end(); ++i) {
-            handleVariable(dbfile, grid, *i);
-        }
-
-        unstructuredGridSelectors->callbackHandleVariableForUnstructuredGrid(this, dbfile, grid);
-        pointMeshSelectors->callbackHandleVariableForPointMesh(this, dbfile, grid);
+        Region<DIM> gridRegion;
+        gridRegion << grid.boundingBox();
+        writeDomain(dbfile, grid, gridRegion);
 
         DBClose(dbfile);
     }
@@ -413,10 +427,46 @@ private:
     boost::shared_ptr<SiloWriterHelpers::SelectorContainer<SiloWriter<CELL> > > unstructuredGridSelectors;
     CellSelectorVec cellSelectors;
     Region<DIM> region;
+    Region<DIM> domain;
+    bool wroteRegularGrid;
+    bool wroteUnstructuredMesh;
+    bool wrotePointMesh;
     std::string regularGridLabel;
     std::string unstructuredMeshLabel;
     std::string pointMeshLabel;
 
+    /**
+     * Writes the meshes and variables of the cells within
+     * domainRegion to the current directory of dbfile. Empty meshes
+     * are skipped, along with their variables. The regular grid spans
+     * the domain's bounding box, cells outside of the domain are
+     * labeled as ghost zones.
+     */
+    void writeDomain(DBfile *dbfile, const GridType& grid, const Region<DIM>& domainRegion)
+    {
+        domain = domainRegion;
+        wroteRegularGrid = false;
+        wroteUnstructuredMesh = false;
+        wrotePointMesh = false;
+
+        handleUnstructuredGrid(dbfile, grid, typename APITraits::SelectUnstructuredGrid<Cell>::Value());
+        handlePointMesh(       dbfile, grid, typename APITraits::SelectPointMesh<       Cell>::Value());
+        handleRegularGrid(     dbfile, grid, typename APITraits::SelectRegularGrid<     Cell>::Value());
+
+        if (wroteRegularGrid) {
+            for (typename CellSelectorVec::iterator i = cellSelectors.begin(); i != cellSelectors.end(); ++i) {
+                handleVariable(dbfile, grid, *i);
+            }
+        }
+
+        if (wroteUnstructuredMesh) {
+            unstructuredGridSelectors->callbackHandleVariableForUnstructuredGrid(this, dbfile, grid);
+        }
+        if (wrotePointMesh) {
+            pointMeshSelectors->callbackHandleVariableForPointMesh(this, dbfile, grid);
+        }
+    }
+
     void addSelector(const Selector<Cell>& selector)
     {
         cellSelectors << selector;
@@ -454,7 +504,12 @@ private:
     {
         flushDataStores();
         collectShapes(grid);
+        if (shapeCounts.empty()) {
+            return;
+        }
+
         outputUnstructuredMesh(dbfile);
+        wroteUnstructuredMesh = true;
     }
 
     void handleUnstructuredGrid(DBfile *dbfile, const GridType& grid, APITraits::FalseType)
@@ -466,7 +521,12 @@ private:
     {
         flushDataStores();
         collectPoints(grid);
+        if (coords[0].empty()) {
+            return;
+        }
+
         outputPointMesh(dbfile);
+        wrotePointMesh = true;
     }
 
     void handlePointMesh(DBfile *dbfile, const GridType& grid, APITraits::FalseType)
@@ -476,9 +536,14 @@ private:
 
     void handleRegularGrid(DBfile *dbfile, const GridType& grid, APITraits::TrueType)
     {
+        if (domain.empty()) {
+            return;
+        }
+
         flushDataStores();
-        collectRegularGridGeometry(grid);
+        collectRegularGridGeometry(domain.boundingBox());
         outputRegularGrid(dbfile);
+        wroteRegularGrid = true;
     }
 
     void handleRegularGrid(DBfile *dbfile, const GridType& grid, APITraits::FalseType)
@@ -490,8 +555,8 @@ private:
     void handleVariable(DBfile *dbfile, const GridType& grid, const Selector<CARGO>& selector)
     {
         flushDataStores();
-        collectVariable(grid, selector);
-        outputVariable(dbfile, selector, grid.boundingBox());
+        collectVariable(grid, selector, domain.boundingBox());
+        outputVariable(dbfile, selector, domain.boundingBox());
     }
 
     template<typename CARGO, typename COLLECTION_INTERFACE>
@@ -525,9 +590,8 @@ private:
 
     void collectPoints(const GridType& grid)
     {
-        CoordBox<DIM> box = grid.boundingBox();
-        for (typename CoordBox<DIM>::Iterator i = box.begin();
-             i != box.end();
+        for (typename Region<DIM>::Iterator i = domain.begin();
+             i != domain.end();
              ++i) {
 
             Cell cell = grid.get(*i);
@@ -537,9 +601,8 @@ private:
 
     void collectShapes(const GridType& grid)
     {
-        CoordBox<DIM> box = grid.boundingBox();
-        for (typename CoordBox<DIM>::Iterator i = box.begin();
-             i != box.end();
+        for (typename Region<DIM>::Iterator i = domain.begin();
+             i != domain.end();
              ++i) {
 
             Cell cell = grid.get(*i);
@@ -547,11 +610,11 @@ private:
         }
     }
 
-    void collectVariable(const GridType& grid, const Selector<Cell>& selector)
+    void collectVariable(const GridType& grid, const Selector<Cell>& selector, const CoordBox<DIM>& box)
     {
-        if (region.boundingBox() != grid.boundingBox()) {
+        if (region.boundingBox() != box) {
             region.clear();
-            region << grid.boundingBox();
+            region << box;
         }
 
         std::size_t newSize = region.size() * selector.sizeOfExternal();
@@ -562,9 +625,8 @@ private:
     template<typename CARGO, typename COLLECTION_INTERFACE>
     void collectVariable(const GridType& grid, const Selector<CARGO>& selector, const COLLECTION_INTERFACE& collectionInterface)
     {
-        CoordBox<DIM> box = grid.boundingBox();
-        for (typename CoordBox<DIM>::Iterator i = box.begin();
-             i != box.end();
+        for (typename Region<DIM>::Iterator i = domain.begin();
+             i != domain.end();
              ++i) {
 
             Cell cell = grid.get(*i);
@@ -575,16 +637,15 @@ private:
         }
     }
 
-    void collectRegularGridGeometry(const GridType& grid)
+    void collectRegularGridGeometry(const CoordBox<DIM>& box)
     {
-        Coord<DIM> dim = grid.boundingBox().dimensions;
         FloatCoord<DIM> quadrantDim;
         FloatCoord<DIM> origin;
         APITraits::SelectRegularGrid<Cell>::value(&quadrantDim, &origin);
 
         for (int d = 0; d < DIM; ++d) {
-            for (int i = 0; i <= dim[d]; ++i) {
-                coords[d] << (origin[d] + quadrantDim[d] * i);
+            for (int i = 0; i <= box.dimensions[d]; ++i) {
+                coords[d] << (origin[d] + quadrantDim[d] * (box.origin[d] + i));
             }
         }
     }
@@ -631,8 +692,27 @@ private:
             tempCoords[d] = &coords[d][0];
         }
 
+        DBoptlist *options = NULL;
+#ifdef DBOPT_GHOST_ZONE_LABELS
+        // domains which don't fill their bounding box (as written by
+        // ParallelSiloWriter) hide the remaining cells:
+        std::vector<char> ghostLabels;
+        CoordBox<DIM> box = domain.boundingBox();
+        if (domain.size() != box.size()) {
+            for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+                ghostLabels << char(domain.count(*i) ? DB_GHOSTTYPE_NOGHOST : DB_GHOSTTYPE_INTDUP);
+            }
+            options = DBMakeOptlist(1);
+            DBAddOption(options, DBOPT_GHOST_ZONE_LABELS, &ghostLabels[0]);
+        }
+#endif
+
         DBPutQuadmesh(dbfile, regularGridLabel.c_str(), NULL, tempCoords, dimensions, DIM,
-                      DB_DOUBLE, DB_COLLINEAR, NULL);
+                      DB_DOUBLE, DB_COLLINEAR, options);
+
+        if (options) {
+            DBFreeOptlist(options);
+        }
     }
 
     void outputVariable(DBfile *dbfile, const Selector<Cell>& selector, const CoordBox<DIM>& box)
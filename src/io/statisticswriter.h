@@ -0,0 +1,426 @@
+#ifndef LIBGEODECOMP_IO_STATISTICSWRITER_H
+#define LIBGEODECOMP_IO_STATISTICSWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/filter.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace StatisticsWriterHelpers {
+
+/**
+ * Accumulates count, sum, extrema, and a histogram of the values it
+ * is being fed.
+ */
+class Accumulator
+{
+public:
+    Accumulator(std::size_t numBins = 0, double lower = 0, double upper = 1) :
+        histogram(numBins),
+        lower(lower),
+        binWidth((upper - lower) / std::max(numBins, std::size_t(1)))
+    {
+        if ((numBins > 0) && !(upper > lower)) {
+            throw std::invalid_argument("histogram needs upper > lower");
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        count = 0;
+        sum = 0;
+        min = std::numeric_limits<double>::max();
+        max = -std::numeric_limits<double>::max();
+        std::fill(histogram.begin(), histogram.end(), 0);
+    }
+
+    /**
+     * Folds the values into the statistics. Values outside of the
+     * histogram's range are counted in the first/last bin.
+     */
+    template<typename ITERATOR>
+    void add(ITERATOR begin, ITERATOR end)
+    {
+        double localSum = 0;
+        double localMin = min;
+        double localMax = max;
+        std::size_t localCount = 0;
+
+        for (ITERATOR i = begin; i != end; ++i) {
+            double value = *i;
+            localSum += value;
+            localMin = std::min(localMin, value);
+            localMax = std::max(localMax, value);
+            ++localCount;
+        }
+
+        if (!histogram.empty()) {
+            long lastBin = histogram.size() - 1;
+            for (ITERATOR i = begin; i != end; ++i) {
+                long bin = (*i - lower) / binWidth;
+                bin = std::max(0L, std::min(bin, lastBin));
+                histogram[bin] += 1;
+            }
+        }
+
+        count += localCount;
+        sum += localSum;
+        min = localMin;
+        max = localMax;
+    }
+
+    double count;
+    double sum;
+    double min;
+    double max;
+    std::vector<double> histogram;
+
+private:
+    double lower;
+    double binWidth;
+};
+
+/**
+ * Iterates through a member of a streak of cells, so that
+ * Accumulator::add() can read AoS and SoA data alike.
+ */
+template<typename CELL, typename MEMBER>
+class MemberIterator
+{
+public:
+    MemberIterator(const CELL *cell, MEMBER CELL:: *memberPointer) :
+        cell(cell),
+        memberPointer(memberPointer)
+    {}
+
+    inline const MEMBER& operator*() const
+    {
+        return cell->*memberPointer;
+    }
+
+    inline void operator++()
+    {
+        ++cell;
+    }
+
+    inline bool operator!=(const MemberIterator& other) const
+    {
+        return cell != other.cell;
+    }
+
+private:
+    const CELL *cell;
+    MEMBER CELL:: *memberPointer;
+};
+
+/**
+ * This filter doesn't copy any data but feeds it directly into an
+ * Accumulator. This avoids temporary buffers and lets grids with SoA
+ * layout hand over each member's contiguous array.
+ */
+template<typename CELL, typename MEMBER>
+class AccumulatingFilter : public Filter<CELL, MEMBER, char>
+{
+public:
+    AccumulatingFilter(std::size_t numBins, double lower, double upper) :
+        accumulator(numBins, lower, upper)
+    {}
+
+    void copyStreakInImpl(
+        const char * /* unused: source */,
+        MemoryLocation::Location /* unused: sourceLocation */,
+        MEMBER * /* unused: target */,
+        MemoryLocation::Location /* unused: targetLocation */,
+        const std::size_t /* unused: num */,
+        const std::size_t /* unused: stride */)
+    {
+        throw std::logic_error("this filter is meant for output only");
+    }
+
+    void copyStreakOutImpl(
+        const MEMBER *source,
+        MemoryLocation::Location sourceLocation,
+        char * /* unused: target */,
+        MemoryLocation::Location targetLocation,
+        const std::size_t num,
+        const std::size_t /* unused: stride */)
+    {
+        checkMemoryLocations(sourceLocation, targetLocation);
+        accumulator.add(source, source + num);
+    }
+
+    void copyMemberInImpl(
+        const char * /* unused: source */,
+        MemoryLocation::Location /* unused: sourceLocation */,
+        CELL * /* unused: target */,
+        MemoryLocation::Location /* unused: targetLocation */,
+        std::size_t /* unused: num */,
+        MEMBER CELL:: * /* unused: memberPointer */)
+    {
+        throw std::logic_error("this filter is meant for output only");
+    }
+
+    void copyMemberOutImpl(
+        const CELL *source,
+        MemoryLocation::Location sourceLocation,
+        char * /* unused: target */,
+        MemoryLocation::Location targetLocation,
+        std::size_t num,
+        MEMBER CELL:: *memberPointer)
+    {
+        checkMemoryLocations(sourceLocation, targetLocation);
+        accumulator.add(
+            MemberIterator<CELL, MEMBER>(source,       memberPointer),
+            MemberIterator<CELL, MEMBER>(source + num, memberPointer));
+    }
+
+    Accumulator accumulator;
+
+private:
+    void checkMemoryLocations(
+        MemoryLocation::Location sourceLocation,
+        MemoryLocation::Location targetLocation)
+    {
+        if ((sourceLocation != MemoryLocation::HOST) ||
+            (targetLocation != MemoryLocation::HOST)) {
+            throw std::invalid_argument("AccumulatingFilter can only access host memory");
+        }
+    }
+};
+
+/**
+ * Type erasure for the members added via
+ * StatisticsWriter::addMember(). Copies of the writer use it to set
+ * up fresh filters, so they don't share their Accumulators.
+ */
+template<typename CELL>
+class MemberBase
+{
+public:
+    virtual ~MemberBase()
+    {}
+
+    virtual Selector<CELL> selector(Accumulator **accumulator) const = 0;
+};
+
+template<typename CELL, typename MEMBER>
+class Member : public MemberBase<CELL>
+{
+public:
+    Member(
+        MEMBER CELL:: *memberPointer,
+        const std::string& memberName,
+        std::size_t numBins,
+        double lower,
+        double upper) :
+        memberPointer(memberPointer),
+        memberName(memberName),
+        numBins(numBins),
+        lower(lower),
+        upper(upper)
+    {}
+
+    Selector<CELL> selector(Accumulator **accumulator) const
+    {
+        boost::shared_ptr<AccumulatingFilter<CELL, MEMBER> > filter(
+            new AccumulatingFilter<CELL, MEMBER>(numBins, lower, upper));
+        *accumulator = &filter->accumulator;
+
+        return Selector<CELL>(memberPointer, memberName, filter);
+    }
+
+private:
+    MEMBER CELL:: *memberPointer;
+    std::string memberName;
+    std::size_t numBins;
+    double lower;
+    double upper;
+};
+
+}
+
+/**
+ * Computes global diagnostics (count, minimum, maximum, mean, and
+ * optionally a histogram) of selected members in situ, instead of
+ * dumping whole fields for post-processing. Each rank reduces its
+ * validRegion locally, the partial results of all ranks are then
+ * combined via three MPI reductions per step. The root appends one
+ * line per member and step to the file PREFIX.stats:
+ *
+ *   STEP MEMBER COUNT MIN MAX MEAN [BIN_0 ... BIN_N-1]
+ */
+template<typename CELL_TYPE>
+class StatisticsWriter : public Clonable<ParallelWriter<CELL_TYPE>, StatisticsWriter<CELL_TYPE> >
+{
+public:
+    friend class StatisticsWriterTest;
+
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef StatisticsWriterHelpers::Accumulator Accumulator;
+
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    static const int DIM = Topology::DIM;
+
+    explicit StatisticsWriter(
+        const std::string& prefix,
+        const unsigned period = 1,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL_TYPE>, StatisticsWriter<CELL_TYPE> >(prefix, period),
+        mpiLayer(communicator),
+        root(root)
+    {}
+
+    /**
+     * Copies start out with empty Accumulators of their own.
+     */
+    StatisticsWriter(const StatisticsWriter& other) :
+        Clonable<ParallelWriter<CELL_TYPE>, StatisticsWriter<CELL_TYPE> >(other),
+        mpiLayer(other.mpiLayer),
+        root(other.root)
+    {
+        for (std::size_t i = 0; i < other.members.size(); ++i) {
+            addMember(other.members[i]);
+        }
+    }
+
+    /**
+     * Adds a member for which statistics will be computed. If
+     * numBins is positive, a histogram with numBins bins of equal
+     * width, spanning [lower, upper), will be recorded, too.
+     */
+    template<typename MEMBER>
+    void addMember(
+        MEMBER CELL_TYPE:: *memberPointer,
+        const std::string& memberName,
+        std::size_t numBins = 0,
+        double lower = 0,
+        double upper = 1)
+    {
+        addMember(MemberPtr(
+                      new StatisticsWriterHelpers::Member<CELL_TYPE, MEMBER>(
+                          memberPointer, memberName, numBins, lower, upper)));
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& /* unused: globalDimensions */,
+        unsigned step,
+        WriterEvent event,
+        std::size_t /* unused: rank */,
+        bool lastCall)
+    {
+        for (std::size_t i = 0; i < selectors.size(); ++i) {
+            grid.saveMemberUnchecked(0, MemoryLocation::HOST, selectors[i], validRegion);
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        std::vector<double> sums;
+        std::vector<double> mins;
+        std::vector<double> maxs;
+        for (std::size_t i = 0; i < accumulators.size(); ++i) {
+            sums << accumulators[i]->count
+                 << accumulators[i]->sum;
+            sums.insert(sums.end(), accumulators[i]->histogram.begin(), accumulators[i]->histogram.end());
+            mins << accumulators[i]->min;
+            maxs << accumulators[i]->max;
+            accumulators[i]->reset();
+        }
+
+        std::vector<double> globalSums(sums.size());
+        std::vector<double> globalMins(mins.size());
+        std::vector<double> globalMaxs(maxs.size());
+        if (!sums.empty()) {
+            mpiLayer.reduce(&sums[0], &globalSums[0], sums.size(), MPI_SUM, root);
+            mpiLayer.reduce(&mins[0], &globalMins[0], mins.size(), MPI_MIN, root);
+            mpiLayer.reduce(&maxs[0], &globalMaxs[0], maxs.size(), MPI_MAX, root);
+        }
+
+        if (mpiLayer.rank() == root) {
+            write(step, event, globalSums, globalMins, globalMaxs);
+        }
+    }
+
+private:
+    typedef boost::shared_ptr<StatisticsWriterHelpers::MemberBase<CELL_TYPE> > MemberPtr;
+
+    MPILayer mpiLayer;
+    int root;
+    std::vector<MemberPtr> members;
+    std::vector<Selector<CELL_TYPE> > selectors;
+    // point into the filters held by selectors:
+    std::vector<Accumulator*> accumulators;
+
+    void addMember(const MemberPtr& member)
+    {
+        Accumulator *accumulator;
+        members << member;
+        selectors << member->selector(&accumulator);
+        accumulators << accumulator;
+    }
+
+    void write(
+        unsigned step,
+        WriterEvent event,
+        const std::vector<double>& sums,
+        const std::vector<double>& mins,
+        const std::vector<double>& maxs)
+    {
+        std::string filename = prefix + ".stats";
+        std::ios_base::openmode mode = std::ios::out;
+        if (event != WRITER_INITIALIZED) {
+            mode |= std::ios::app;
+        }
+
+        std::ofstream outfile(filename.c_str(), mode);
+        if (!outfile) {
+            throw FileOpenException(filename);
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < selectors.size(); ++i) {
+            double count = sums[offset + 0];
+            double sum   = sums[offset + 1];
+            outfile << step << " " << selectors[i].name() << " " << count << " "
+                    << mins[i] << " " << maxs[i] << " " << (count > 0 ? sum / count : 0);
+
+            std::size_t numBins = accumulators[i]->histogram.size();
+            for (std::size_t j = 0; j < numBins; ++j) {
+                outfile << " " << sums[offset + 2 + j];
+            }
+            outfile << "\n";
+            offset += 2 + numBins;
+        }
+
+        if (!outfile.good()) {
+            throw FileWriteException(filename);
+        }
+    }
+};
+
+}
+
+#endif
+
+#endif
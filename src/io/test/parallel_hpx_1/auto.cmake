@@ -0,0 +1,9 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}parallelwritertest.h
+  ${RELATIVE_PATH}ppmwritertest.h
+  ${RELATIVE_PATH}serialbovwritertest.h
+  ${RELATIVE_PATH}simpleinitializertest.h
+  ${RELATIVE_PATH}steerertest.h
+)
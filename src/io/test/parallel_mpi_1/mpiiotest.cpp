@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPIIOTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_1/mpiiotest.h"
+
+static MPIIOTest suite_MPIIOTest;
+
+static CxxTest::List Tests_MPIIOTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPIIOTest( "/root/repo/src/io/test/parallel_mpi_1/mpiiotest.h", 13, "MPIIOTest", suite_MPIIOTest, Tests_MPIIOTest );
+
+static class TestDescription_suite_MPIIOTest_testBasicReadWrite2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOTest_testBasicReadWrite2D() : CxxTest::RealTestDescription( Tests_MPIIOTest, suiteDescription_MPIIOTest, 16, "testBasicReadWrite2D" ) {}
+ void runTest() { suite_MPIIOTest.testBasicReadWrite2D(); }
+} testDescription_suite_MPIIOTest_testBasicReadWrite2D;
+
+static class TestDescription_suite_MPIIOTest_testBasicReadWrite3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOTest_testBasicReadWrite3D() : CxxTest::RealTestDescription( Tests_MPIIOTest, suiteDescription_MPIIOTest, 53, "testBasicReadWrite3D" ) {}
+ void runTest() { suite_MPIIOTest.testBasicReadWrite3D(); }
+} testDescription_suite_MPIIOTest_testBasicReadWrite3D;
+
+static class TestDescription_suite_MPIIOTest_testAdvancedReadWrite : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOTest_testAdvancedReadWrite() : CxxTest::RealTestDescription( Tests_MPIIOTest, suiteDescription_MPIIOTest, 98, "testAdvancedReadWrite" ) {}
+ void runTest() { suite_MPIIOTest.testAdvancedReadWrite(); }
+} testDescription_suite_MPIIOTest_testAdvancedReadWrite;
+
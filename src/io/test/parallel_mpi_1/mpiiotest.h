@@ -147,6 +147,50 @@ public:
             }
         }
     }
+
+    void testTorusRegion()
+    {
+        // streaks with negative coordinates wrap around and land in
+        // the file out of order:
+        typedef Topologies::Torus<2>::Topology Torus;
+        Coord<2> dim(6, 5);
+        std::string filename = TempFile::parallel("mpiio");
+        MPIIO<double, Torus> mpiio;
+
+        Grid<double, Torus> grid1(dim, -1);
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                grid1[Coord<2>(x, y)] = y * 10 + x;
+            }
+        }
+
+        Region<2> region;
+        region << Streak<2>(Coord<2>(0, -1), 6)
+               << Streak<2>(Coord<2>(1,  0), 4)
+               << Streak<2>(Coord<2>(0,  1), 6)
+               << Streak<2>(Coord<2>(2,  2), 3);
+
+        Grid<double, Torus> source(dim, -2);
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            source[*i] = grid1[*i];
+        }
+        mpiio.writeRegion(source, dim, 1, 2, filename, region);
+
+        Grid<double, Torus> grid2(dim, -3);
+        mpiio.readRegion(&grid2, filename, region);
+
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                Coord<2> c(x, y);
+                bool inRegion =
+                    (y == 4) ||
+                    (y == 1) ||
+                    ((y == 0) && (x >= 1) && (x < 4)) ||
+                    ((y == 2) && (x >= 2) && (x < 3));
+                TS_ASSERT_EQUALS(inRegion ? grid1[c] : -3.0, grid2[c]);
+            }
+        }
+    }
 };
 
 }
@@ -0,0 +1,27 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}bovwritertest.cpp
+  ${RELATIVE_PATH}collectingwritertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mpiioinitializertest.cpp
+  ${RELATIVE_PATH}mpiiotest.cpp
+  ${RELATIVE_PATH}parallelmemorywritertest.cpp
+  ${RELATIVE_PATH}parallelmpiiowritertest.cpp
+  ${RELATIVE_PATH}remotesteerertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}tracingwritertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}bovwritertest.h
+  ${RELATIVE_PATH}checkpointwritertest.h
+  ${RELATIVE_PATH}collectingwritertest.h
+  ${RELATIVE_PATH}mpiioinitializertest.h
+  ${RELATIVE_PATH}mpiiotest.h
+  ${RELATIVE_PATH}paralleldownsamplingwritertest.h
+  ${RELATIVE_PATH}parallelmemorywritertest.h
+  ${RELATIVE_PATH}parallelmpiiowritertest.h
+  ${RELATIVE_PATH}parallelsilowritertest.h
+  ${RELATIVE_PATH}remotesteerertest.h
+  ${RELATIVE_PATH}statisticswritertest.h
+  ${RELATIVE_PATH}timeserieswritertest.h
+  ${RELATIVE_PATH}tracingwritertest.h
+)
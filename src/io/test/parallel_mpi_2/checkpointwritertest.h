@@ -0,0 +1,148 @@
+#include <libgeodecomp/io/checkpointinitializer.h>
+#include <libgeodecomp/io/checkpointwriter.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cstdio>
+#include <fstream>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CheckpointWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        MPILayer mpiLayer;
+        prefix = TempFile::parallel("checkpointwriter");
+        dim = Coord<2>(20, 12);
+        ownRegion.clear();
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            ownRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+    }
+
+    void tearDown()
+    {
+        MPILayer mpiLayer;
+        mpiLayer.barrier();
+        if (mpiLayer.rank() == 0) {
+            CheckpointManifest manifest(prefix);
+            for (unsigned step = 0; step < 10; ++step) {
+                std::remove(manifest.fullFilename(step).c_str());
+                std::remove(manifest.diffFilename(step).c_str());
+            }
+            std::remove(manifest.filename().c_str());
+        }
+    }
+
+    void testDifferentialCheckpoints()
+    {
+        writeCheckpoints();
+
+        CheckpointManifest manifest(prefix);
+        std::vector<CheckpointManifest::Entry> entries = manifest.entries();
+        TS_ASSERT_EQUALS(std::size_t(6), entries.size());
+        unsigned expectedBase[] = { 0, 0, 0, 3, 3, 5 };
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            TS_ASSERT_EQUALS(unsigned(i), entries[i].step);
+            TS_ASSERT_EQUALS(expectedBase[i], entries[i].baseStep);
+            TS_ASSERT_EQUALS(unsigned(42), entries[i].maxSteps);
+        }
+
+        // only one brick changes per step:
+        TS_ASSERT_LESS_THAN(fileSize(manifest.diffFilename(1)) * 4, fileSize(manifest.fullFilename(0)));
+    }
+
+    void testRestore()
+    {
+        MPILayer mpiLayer;
+        writeCheckpoints();
+
+        for (unsigned step = 0; step < 6; ++step) {
+            CheckpointInitializer<TestCell<2> > initializer(prefix, step);
+            TS_ASSERT_EQUALS(dim, initializer.gridDimensions());
+            TS_ASSERT_EQUALS(step, initializer.startStep());
+            TS_ASSERT_EQUALS(unsigned(42), initializer.maxSteps());
+            TS_ASSERT(initializer.supportsParallelInit());
+
+            // each rank only restores its own part of the grid:
+            CoordBox<2> box(Coord<2>(2 + mpiLayer.rank(), 1), Coord<2>(15, 10));
+            DisplacedGrid<TestCell<2> > grid(box);
+            initializer.grid(&grid);
+
+            TS_ASSERT_EQUALS(double(step), grid.getEdge().testValue);
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                TS_ASSERT_EQUALS(expected(*i, step), grid[*i]);
+            }
+        }
+
+        CheckpointInitializer<TestCell<2> > latest(prefix);
+        TS_ASSERT_EQUALS(unsigned(5), latest.startStep());
+        TS_ASSERT_THROWS(CheckpointInitializer<TestCell<2> >(prefix, 7), std::invalid_argument&);
+    }
+
+private:
+    std::string prefix;
+    Coord<2> dim;
+    Region<2> ownRegion;
+
+    /**
+     * All cells are static, except for one which gets modified in
+     * every step.
+     */
+    TestCell<2> expected(const Coord<2>& c, unsigned step)
+    {
+        TestCell<2> cell(c, dim);
+        if (c == Coord<2>(7, 3)) {
+            cell.testValue = 100 + step;
+        }
+
+        return cell;
+    }
+
+    void writeCheckpoints()
+    {
+        MPILayer mpiLayer;
+        CheckpointWriter<TestCell<2> > writer(prefix, 1, 42, 3, Coord<2>(5, 4));
+        DisplacedGrid<TestCell<2> > grid(CoordBox<2>(Coord<2>(), dim));
+
+        Region<2> leftColumns;
+        leftColumns << CoordBox<2>(Coord<2>(), Coord<2>(6, dim.y()));
+        Region<2> firstPart = ownRegion & leftColumns;
+
+        for (unsigned step = 0; step <= 5; ++step) {
+            for (CoordBox<2>::Iterator i = grid.boundingBox().begin(); i != grid.boundingBox().end(); ++i) {
+                grid[*i] = expected(*i, step);
+            }
+            TestCell<2> edge;
+            edge.testValue = step;
+            grid.setEdge(edge);
+
+            // repartitioning forces a full checkpoint:
+            if (step == 5) {
+                writer.setRegion(ownRegion);
+            }
+
+            WriterEvent event = step ? WRITER_STEP_FINISHED : WRITER_INITIALIZED;
+            writer.stepFinished(grid, firstPart,             dim, step, event, mpiLayer.rank(), false);
+            writer.stepFinished(grid, ownRegion - firstPart, dim, step, event, mpiLayer.rank(), true);
+        }
+
+        writer.stepFinished(grid, firstPart,             dim, 5, WRITER_ALL_DONE, mpiLayer.rank(), false);
+        writer.stepFinished(grid, ownRegion - firstPart, dim, 5, WRITER_ALL_DONE, mpiLayer.rank(), true);
+        mpiLayer.barrier();
+    }
+
+    std::size_t fileSize(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+        return file.tellg();
+    }
+};
+
+}
@@ -57,6 +57,38 @@ public:
         }
     }
 
+    void testTree()
+    {
+        // all but the root need to forward their children's data:
+        MPILayer mpiLayer;
+        int root = mpiLayer.size() - 1;
+        MemoryWriter<TestCell<3> > *treeWriter = 0;
+        if (mpiLayer.rank() == root) {
+            treeWriter = new MemoryWriter<TestCell<3> >(3);
+        }
+
+        LoadBalancer *balancer = mpiLayer.rank()? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > treeSim(getInit(), balancer);
+        treeSim.addWriter(
+            new CollectingWriter<TestCell<3> >(
+                treeWriter,
+                root,
+                MPI_COMM_WORLD,
+                APITraits::SelectMPIDataType<TestCell<3> >::value(),
+                1));
+        treeSim.run();
+
+        if (mpiLayer.rank() == root) {
+            int size = treeWriter->getGrids().size();
+            TS_ASSERT_LESS_THAN(1, size);
+
+            for (int i = 0; i < (size - 1); ++i) {
+                unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * i * 3;
+                TS_ASSERT_TEST_GRID(MemoryWriter<TestCell<3> >::GridType, treeWriter->getGrids()[i], cycle);
+            }
+        }
+    }
+
 private:
     boost::shared_ptr<StripingSimulator<TestCell<3> > > sim;
     MemoryWriter<TestCell<3> > *writer;
@@ -1,3 +1,4 @@
+#include <libgeodecomp/io/mmapinitializer.h>
 #include <libgeodecomp/io/mpiioinitializer.h>
 #include <libgeodecomp/io/mpiiowriter.h>
 #include <libgeodecomp/io/parallelmpiiowriter.h>
@@ -6,6 +7,7 @@
 #include <libgeodecomp/misc/tempfile.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
+#include <libgeodecomp/storage/displacedgrid.h>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem.hpp>
@@ -98,6 +100,54 @@ public:
             TS_ASSERT_EQUALS(expected, actual);
         }
     }
+
+    void testMMapInitializer()
+    {
+        files << "testmpiioinitializer3_00000.mpiio"
+              << "testmpiioinitializer3_00005.mpiio"
+              << "testmpiioinitializer3_00010.mpiio"
+              << "testmpiioinitializer3_00015.mpiio"
+              << "testmpiioinitializer3_00020.mpiio"
+              << "testmpiioinitializer3_00021.mpiio";
+
+        if (rank == 0) {
+            TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+            SerialSimulator<TestCell<3> > sim(init);
+            sim.addWriter(
+                new MPIIOWriter<TestCell<3> >(
+                    "testmpiioinitializer3_",
+                    5,
+                    init->maxSteps(),
+                    MPI_COMM_SELF));
+            sim.run();
+        }
+        MPILayer().barrier();
+
+        // snapshots can be read without MPI, too. TestCell contains
+        // padding, so its edge cell can't be read via mmap():
+        std::string snapshotFile = "testmpiioinitializer3_00010.mpiio";
+        MPIIOInitializer<TestCell<3> > mpiioInitializer(snapshotFile);
+        TestCell<3> edgeCell(Coord<3>::diagonal(-1), mpiioInitializer.gridDimensions());
+        edgeCell.isEdgeCell = true;
+        MMapInitializer<TestCell<3> > mmapInitializer(snapshotFile, edgeCell);
+        TS_ASSERT_EQUALS(mpiioInitializer.gridDimensions(), mmapInitializer.gridDimensions());
+        TS_ASSERT_EQUALS(mpiioInitializer.startStep(),      mmapInitializer.startStep());
+        TS_ASSERT_EQUALS(mpiioInitializer.maxSteps(),       mmapInitializer.maxSteps());
+
+        typedef APITraits::SelectTopology<TestCell<3> >::Value Topology;
+        CoordBox<3> box(Coord<3>(2, 3 + rank, 4), Coord<3>(7, 5, 3));
+        Coord<3> dimensions = mpiioInitializer.gridDimensions();
+        DisplacedGrid<TestCell<3>, Topology> expected(box, TestCell<3>(), TestCell<3>(), dimensions);
+        DisplacedGrid<TestCell<3>, Topology> actual(  box, TestCell<3>(), TestCell<3>(), dimensions);
+        mpiioInitializer.grid(&expected);
+        mmapInitializer.grid(&actual);
+
+        TS_ASSERT_EQUALS(expected.getEdge(), actual.getEdge());
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(expected.get(*i), actual.get(*i));
+        }
+        MPILayer().barrier();
+    }
 };
 
 }
@@ -4,6 +4,7 @@
 #include <libgeodecomp/storage/grid.h>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstdio>
 #include <unistd.h>
 #include <cxxtest/TestSuite.h>
 
@@ -80,6 +81,101 @@ public:
             }
         }
     }
+
+    void testChunkedRead()
+    {
+        // chunks of 3 streaks (12 cells) each:
+        MPIIO<double, Topologies::Cube<2>::Topology> mpiio(10);
+        MPILayer mpiLayer;
+        Coord<2> dim(6, 9);
+        std::string filename = TempFile::parallel("mpiio");
+
+        Grid<double, Topologies::Cube<2>::Topology> source(dim, -2);
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                source[Coord<2>(x, y)] = y * 10 + x;
+            }
+        }
+
+        Region<2> writeRegion;
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            writeRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+        mpiio.writeRegion(source, dim, 0, 10, filename, writeRegion);
+
+        // ranks read differing numbers of chunks, rank 0 reads most:
+        Region<2> readRegion;
+        int rows = mpiLayer.rank() ? 1 : 7;
+        readRegion << CoordBox<2>(Coord<2>(1, mpiLayer.rank()), Coord<2>(4, rows));
+
+        Grid<double, Topologies::Cube<2>::Topology> target(dim, -1);
+        mpiio.readRegion(&target, filename, readRegion);
+
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                Coord<2> c(x, y);
+                double expected = readRegion.count(c) ? source[c] : -1;
+                TS_ASSERT_EQUALS(expected, target[c]);
+            }
+        }
+
+        mpiLayer.barrier();
+        if (mpiLayer.rank() == 0) {
+            std::remove(filename.c_str());
+        }
+    }
+
+    void testTruncatedFile()
+    {
+        MPIIO<double, Topologies::Cube<2>::Topology> mpiio;
+        MPILayer mpiLayer;
+        Coord<2> dim(6, 9);
+        std::string filename = TempFile::parallel("mpiio");
+
+        // only the upper rows get written:
+        Grid<double, Topologies::Cube<2>::Topology> source(dim, -2);
+        Region<2> writeRegion;
+        writeRegion << Streak<2>(Coord<2>(0, mpiLayer.rank()), dim.x());
+        mpiio.writeRegion(source, dim, 0, 10, filename, writeRegion);
+
+        // a read is rejected by all ranks, even if only one of them
+        // requests cells beyond the end of the file:
+        Region<2> readRegion;
+        if (mpiLayer.rank() == 0) {
+            readRegion << Streak<2>(Coord<2>(0, 8), dim.x());
+        }
+        Grid<double, Topologies::Cube<2>::Topology> target(dim, -1);
+        TS_ASSERT_THROWS(mpiio.readRegion(&target, filename, readRegion), FileReadException&);
+
+        mpiLayer.barrier();
+        if (mpiLayer.rank() == 0) {
+            std::remove(filename.c_str());
+        }
+    }
+
+    void testCostMap()
+    {
+        MPIIO<double, Topologies::Cube<2>::Topology> mpiio;
+        std::string filename = TempFile::parallel("mpiiocosts");
+        if (MPILayer().rank() != 0) {
+            return;
+        }
+
+        CostMap<2> costs(CoordBox<2>(Coord<2>(1, 2), Coord<2>(7, 5)), Coord<2>(2, 3));
+        costs.set(Coord<2>(1, 2), 0.1);
+        costs.set(Coord<2>(7, 6), 123.456);
+        mpiio.writeCostMap(costs, filename);
+
+        CostMap<2> restored = mpiio.readCostMap<2>(filename);
+        TS_ASSERT_EQUALS(costs.boundingBox(), restored.boundingBox());
+        TS_ASSERT_EQUALS(costs.getBlockDim(), restored.getBlockDim());
+        for (CoordBox<2>::Iterator i = costs.boundingBox().begin(); i != costs.boundingBox().end(); ++i) {
+            TS_ASSERT_EQUALS(costs[*i], restored[*i]);
+        }
+
+        TS_ASSERT_THROWS(mpiio.readCostMap<3>(filename), FileReadException&);
+        std::remove(filename.c_str());
+    }
 };
 
 }
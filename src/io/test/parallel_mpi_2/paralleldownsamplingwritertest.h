@@ -0,0 +1,63 @@
+#include <libgeodecomp/io/collectingwriter.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/paralleldownsamplingwriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/loadbalancer/noopbalancer.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/parallelization/stripingsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ParallelDownsamplingWriterTest : public CxxTest::TestSuite
+{
+public:
+    void testGatherSampledCells()
+    {
+        MPILayer mpiLayer;
+        TestInitializer<TestCell<2> > *init = new TestInitializer<TestCell<2> >();
+        Coord<2> dim = init->gridDimensions();
+        StripingSimulator<TestCell<2> > sim(init, mpiLayer.rank() ? 0 : new NoOpBalancer());
+
+        MemoryWriter<TestCell<2> > *memoryWriter = 0;
+        if (mpiLayer.rank() == 0) {
+            memoryWriter = new MemoryWriter<TestCell<2> >(5);
+        }
+
+        Coord<2> stride(3, 4);
+        CoordBox<2> roi(Coord<2>(2, 1), dim - Coord<2>(4, 2));
+        sim.addWriter(
+            new ParallelDownsamplingWriter<TestCell<2> >(
+                new CollectingWriter<TestCell<2> >(memoryWriter, 0),
+                stride,
+                roi));
+        sim.run();
+
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        Coord<2> coarseDim((roi.dimensions.x() + 2) / 3, (roi.dimensions.y() + 3) / 4);
+        std::vector<Grid<TestCell<2> > >& grids = memoryWriter->getGrids();
+        TS_ASSERT_LESS_THAN(std::size_t(1), grids.size());
+
+        for (std::size_t i = 0; i < grids.size(); ++i) {
+            TS_ASSERT_EQUALS(coarseDim, grids[i].getDimensions());
+            unsigned cycle = grids[i][Coord<2>()].cycleCounter;
+
+            for (int y = 0; y < coarseDim.y(); ++y) {
+                for (int x = 0; x < coarseDim.x(); ++x) {
+                    Coord<2> c(x, y);
+                    TS_ASSERT_EQUALS(roi.origin + c.scale(stride), grids[i][c].pos);
+                    TS_ASSERT_EQUALS(cycle, grids[i][c].cycleCounter);
+                    TS_ASSERT(grids[i][c].isValid);
+                }
+            }
+        }
+    }
+};
+
+}
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelMPIIOWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/parallelmpiiowritertest.h"
+
+static ParallelMPIIOWriterTest suite_ParallelMPIIOWriterTest;
+
+static CxxTest::List Tests_ParallelMPIIOWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelMPIIOWriterTest( "/root/repo/src/io/test/parallel_mpi_2/parallelmpiiowritertest.h", 16, "ParallelMPIIOWriterTest", suite_ParallelMPIIOWriterTest, Tests_ParallelMPIIOWriterTest );
+
+static class TestDescription_suite_ParallelMPIIOWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPIIOWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_ParallelMPIIOWriterTest, suiteDescription_ParallelMPIIOWriterTest, 34, "testBasic" ) {}
+ void runTest() { suite_ParallelMPIIOWriterTest.testBasic(); }
+} testDescription_suite_ParallelMPIIOWriterTest_testBasic;
+
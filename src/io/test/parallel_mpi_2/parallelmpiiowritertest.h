@@ -1,8 +1,13 @@
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/io/collectingwriter.h>
 #include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/mpiioinitializer.h>
 #include <libgeodecomp/io/parallelmpiiowriter.h>
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/loadbalancer/randombalancer.h>
 #include <libgeodecomp/misc/random.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/hiparsimulator.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
 
@@ -13,6 +18,31 @@ using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
 
+/**
+ * Cuts the grid like StripingPartition, but lacks support for cost
+ * maps (as inherited from Partition).
+ */
+class ParallelMPIIOWriterTestPartition : public Partition<3>
+{
+public:
+    explicit ParallelMPIIOWriterTestPartition(
+        const Coord<3>& origin = Coord<3>(),
+        const Coord<3>& dimensions = Coord<3>(),
+        const long& offset = 0,
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2)) :
+        Partition<3>(offset, weights),
+        delegate(origin, dimensions, offset, weights)
+    {}
+
+    Region<3> getRegion(const std::size_t node) const
+    {
+        return delegate.getRegion(node);
+    }
+
+private:
+    StripingPartition<3> delegate;
+};
+
 class ParallelMPIIOWriterTest : public CxxTest::TestSuite
 {
 public:
@@ -90,6 +120,103 @@ public:
             TS_ASSERT_EQUALS(actual,        expected);
         }
     }
+
+    void testCostMap()
+    {
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+        Coord<3> dim = init->gridDimensions();
+
+        LoadBalancer *balancer = MPILayer().rank()? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(init, balancer);
+        ParallelMPIIOWriter<TestCell<3> > *writer = new ParallelMPIIOWriter<TestCell<3> >(
+            "testmpiiowritercosts",
+            10,
+            init->maxSteps());
+        writer->setCostFunction(PositionCost(), Coord<3>(4, 4, 4));
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned i = 0; i <= 21; i += (i == 20)? 1 : 10) {
+            files << writer->filename(i) << writer->costMapFilename(i);
+        }
+        MPILayer().barrier();
+
+        // every rank may restart from any snapshot with costs:
+        MPIIOInitializer<TestCell<3> > restart(writer->filename(10));
+        CostMap<3> costs = restart.getCostMap();
+        TS_ASSERT_EQUALS(CoordBox<3>(Coord<3>(), dim), costs.boundingBox());
+        TS_ASSERT_EQUALS(Coord<3>(4, 4, 4), costs.getBlockDim());
+
+        // the cost is the average x coordinate of each block:
+        TS_ASSERT_EQUALS(2.5, costs[Coord<3>(0, 0, 0)]);
+        TS_ASSERT_EQUALS(6.5, costs[Coord<3>(7, 2, 9)]);
+
+        MPILayer().barrier();
+        if (MPILayer().rank() != 0) {
+            files.clear();
+        }
+    }
+
+    void testRestartWithPartitionLackingCostMaps()
+    {
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+        LoadBalancer *balancer = MPILayer().rank()? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(init, balancer);
+        ParallelMPIIOWriter<TestCell<3> > *writer = new ParallelMPIIOWriter<TestCell<3> >(
+            "testmpiiowriterrestart",
+            10,
+            init->maxSteps());
+        writer->setCostFunction(PositionCost(), Coord<3>(4, 4, 4));
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned i = 0; i <= 21; i += (i == 20)? 1 : 10) {
+            files << writer->filename(i) << writer->costMapFilename(i);
+        }
+        MPILayer().barrier();
+
+        TS_ASSERT(!ParallelMPIIOWriterTestPartition().supportsCostMaps());
+        TS_ASSERT(StripingPartition<3>().supportsCostMaps());
+
+        // the snapshot comes with costs, but the partition will
+        // have to cut by cell count:
+        HiParSimulator<TestCell<3>, ParallelMPIIOWriterTestPartition> restart(
+            new MPIIOInitializer<TestCell<3> >(writer->filename(10)));
+        MemoryWriter<TestCell<3> > *memoryWriter = 0;
+        if (MPILayer().rank() == 0) {
+            memoryWriter = new MemoryWriter<TestCell<3> >(1);
+        }
+        restart.addWriter(new CollectingWriter<TestCell<3> >(memoryWriter));
+        TS_ASSERT_THROWS_NOTHING(restart.run());
+
+        if (MPILayer().rank() == 0) {
+            unsigned nanoSteps = APITraits::SelectNanoSteps<TestCell<3> >::VALUE;
+            TS_ASSERT_LESS_THAN(1, memoryWriter->getGrids().size());
+            TS_ASSERT_TEST_GRID(
+                MemoryWriter<TestCell<3> >::GridType,
+                memoryWriter->getGrids().front(),
+                10 * nanoSteps);
+            TS_ASSERT_TEST_GRID(
+                MemoryWriter<TestCell<3> >::GridType,
+                memoryWriter->getGrids().back(),
+                21 * nanoSteps);
+        }
+
+        MPILayer().barrier();
+        if (MPILayer().rank() != 0) {
+            files.clear();
+        }
+    }
+
+private:
+    class PositionCost
+    {
+    public:
+        double operator()(const TestCell<3>& cell) const
+        {
+            return cell.pos.x() + 1;
+        }
+    };
 };
 
 }
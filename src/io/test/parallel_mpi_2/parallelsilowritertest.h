@@ -0,0 +1,278 @@
+#include <libgeodecomp/io/parallelsilowriter.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cstdio>
+#include <fstream>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ParallelSiloTestParticle
+{
+public:
+    explicit ParallelSiloTestParticle(const FloatCoord<2>& pos = FloatCoord<2>(), double mass = 1) :
+        pos(pos),
+        mass(mass)
+    {}
+
+    FloatCoord<2> getPoint() const
+    {
+        return pos;
+    }
+
+    std::vector<FloatCoord<2> > getShape() const
+    {
+        return std::vector<FloatCoord<2> >(1, pos);
+    }
+
+    FloatCoord<2> pos;
+    double mass;
+};
+
+class ParallelSiloTestCell
+{
+public:
+    typedef ParallelSiloTestParticle value_type;
+    typedef std::vector<ParallelSiloTestParticle>::iterator iterator;
+    typedef std::vector<ParallelSiloTestParticle>::const_iterator const_iterator;
+
+    class API :
+        public APITraits::HasPointMesh
+    {};
+
+    explicit ParallelSiloTestCell(double value = 0) :
+        value(value)
+    {}
+
+    iterator begin()
+    {
+        return particles.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return particles.begin();
+    }
+
+    iterator end()
+    {
+        return particles.end();
+    }
+
+    const_iterator end() const
+    {
+        return particles.end();
+    }
+
+    std::size_t size() const
+    {
+        return particles.size();
+    }
+
+    std::vector<ParallelSiloTestParticle> particles;
+    double value;
+};
+
+class ParallelSiloWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        MPILayer mpiLayer;
+        prefix = TempFile::parallel("parallelsilowriter");
+        dim = Coord<2>(20, 12);
+        ownRegion.clear();
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            ownRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+    }
+
+    void tearDown()
+    {
+        MPILayer mpiLayer;
+        mpiLayer.barrier();
+#ifdef LIBGEODECOMP_WITH_SILO
+        if (mpiLayer.rank() == 0) {
+            ParallelSiloWriter<ParallelSiloTestCell> writer(prototype());
+            std::remove(writer.masterFilename(0).c_str());
+            for (int i = 0; i < mpiLayer.size(); ++i) {
+                std::remove(writer.domainFilename(0, i).c_str());
+            }
+        }
+#endif
+    }
+
+    void testSharedFile()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer mpiLayer;
+        ParallelSiloWriter<ParallelSiloTestCell> writer(prototype(), 1);
+        write(&writer, WRITER_INITIALIZED);
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        checkMasterFile(writer, 1);
+
+        // all domains went to one file, each to its own directory:
+        DBfile *dbfile = DBOpen(writer.domainFilename(0, 0).c_str(), DB_UNKNOWN, DB_READ);
+        TS_ASSERT(dbfile);
+        for (int rank = 0; rank < mpiLayer.size(); ++rank) {
+            std::string directory = "domain_0000" + StringOps::itoa(rank);
+            TS_ASSERT_EQUALS(0, DBSetDir(dbfile, directory.c_str()));
+
+            // the regular grid spans the domain's bounding box:
+            DBquadmesh *mesh = DBGetQuadmesh(dbfile, "regular_grid");
+            TS_ASSERT_EQUALS(dim.x() + 1,                   mesh->dims[0]);
+            TS_ASSERT_EQUALS(dim.y() - mpiLayer.size() + 2, mesh->dims[1]);
+            DBFreeQuadmesh(mesh);
+
+            DBquadvar *var = DBGetQuadvar(dbfile, "value");
+            TS_ASSERT_EQUALS(cell(Coord<2>(0, rank)).value, static_cast<double*>(var->vals[0])[0]);
+            DBFreeQuadvar(var);
+
+            DBSetDir(dbfile, "/");
+        }
+        DBClose(dbfile);
+#endif
+    }
+
+    void testFilePerRank()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer mpiLayer;
+        ParallelSiloWriter<ParallelSiloTestCell> writer(prototype());
+        write(&writer, WRITER_INITIALIZED);
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        checkMasterFile(writer, mpiLayer.size());
+        for (int rank = 0; rank < mpiLayer.size(); ++rank) {
+            DBfile *dbfile = DBOpen(writer.domainFilename(0, rank).c_str(), DB_UNKNOWN, DB_READ);
+            TS_ASSERT(dbfile);
+            DBClose(dbfile);
+        }
+#endif
+    }
+
+    void testFinalStepIsWrittenOnce()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer mpiLayer;
+        ParallelSiloWriter<ParallelSiloTestCell> writer(prototype(), 1);
+        write(&writer, WRITER_INITIALIZED);
+        if (mpiLayer.rank() == 0) {
+            std::remove(writer.masterFilename(0).c_str());
+        }
+
+        write(&writer, WRITER_ALL_DONE);
+        if (mpiLayer.rank() == 0) {
+            TS_ASSERT(!DBOpen(writer.masterFilename(0).c_str(), DB_UNKNOWN, DB_READ));
+        }
+#endif
+    }
+
+private:
+    std::string prefix;
+    Coord<2> dim;
+    Region<2> ownRegion;
+
+#ifdef LIBGEODECOMP_WITH_SILO
+    /**
+     * The only particle resides in the first row, hence all other
+     * ranks contribute empty blocks to the point mesh.
+     */
+    ParallelSiloTestCell cell(const Coord<2>& c)
+    {
+        ParallelSiloTestCell ret(c.toIndex(dim));
+        if (c == Coord<2>(3, 0)) {
+            ret.particles << ParallelSiloTestParticle(FloatCoord<2>(3.5, 0.5), 42);
+        }
+
+        return ret;
+    }
+
+    SiloWriter<ParallelSiloTestCell> prototype()
+    {
+        SiloWriter<ParallelSiloTestCell> ret(prefix, 1);
+        ret.addSelector(&ParallelSiloTestCell::value, "value");
+        ret.addSelectorForPointMesh(&ParallelSiloTestParticle::mass, "mass");
+        return ret;
+    }
+
+    /**
+     * Writes time step 0, with the ghost zone (here: the left
+     * columns) reported separately.
+     */
+    void write(ParallelSiloWriter<ParallelSiloTestCell> *writer, WriterEvent event)
+    {
+        MPILayer mpiLayer;
+        writer->setRegion(ownRegion);
+
+        DisplacedGrid<ParallelSiloTestCell> grid(CoordBox<2>(Coord<2>(), dim));
+        for (CoordBox<2>::Iterator i = grid.boundingBox().begin(); i != grid.boundingBox().end(); ++i) {
+            grid[*i] = cell(*i);
+        }
+
+        Region<2> leftColumns;
+        leftColumns << CoordBox<2>(Coord<2>(), Coord<2>(6, dim.y()));
+        Region<2> firstPart = ownRegion & leftColumns;
+
+        writer->stepFinished(grid, firstPart,             dim, 0, event, mpiLayer.rank(), false);
+        writer->stepFinished(grid, ownRegion - firstPart, dim, 0, event, mpiLayer.rank(), true);
+        mpiLayer.barrier();
+    }
+
+    void checkMasterFile(const ParallelSiloWriter<ParallelSiloTestCell>& writer, int numFiles)
+    {
+        MPILayer mpiLayer;
+        for (int i = 0; i < numFiles; ++i) {
+            TS_ASSERT(std::ifstream(writer.domainFilename(0, i).c_str()));
+        }
+
+        DBfile *dbfile = DBOpen(writer.masterFilename(0).c_str(), DB_UNKNOWN, DB_READ);
+        TS_ASSERT(dbfile);
+
+        DBmultimesh *mesh = DBGetMultimesh(dbfile, "regular_grid");
+        TS_ASSERT_EQUALS(mpiLayer.size(), mesh->nblocks);
+        for (int rank = 0; rank < mesh->nblocks; ++rank) {
+            std::string filename = writer.domainFilename(0, rank * numFiles / mpiLayer.size());
+            filename = filename.substr(filename.find_last_of('/') + 1);
+            std::string expected = filename + ":/domain_0000" + StringOps::itoa(rank) + "/regular_grid";
+
+            TS_ASSERT_EQUALS(expected, std::string(mesh->meshnames[rank]));
+            TS_ASSERT_EQUALS(DB_QUADMESH, mesh->meshtypes[rank]);
+        }
+        DBFreeMultimesh(mesh);
+
+        DBmultivar *var = DBGetMultivar(dbfile, "value");
+        TS_ASSERT_EQUALS(mpiLayer.size(), var->nvars);
+        TS_ASSERT_EQUALS(DB_QUADVAR, var->vartypes[0]);
+        DBFreeMultivar(var);
+
+        mesh = DBGetMultimesh(dbfile, "point_mesh");
+        TS_ASSERT_EQUALS(mpiLayer.size(), mesh->nblocks);
+        TS_ASSERT_EQUALS(DB_POINTMESH, mesh->meshtypes[0]);
+        for (int rank = 1; rank < mesh->nblocks; ++rank) {
+            TS_ASSERT_EQUALS(std::string("EMPTY"), std::string(mesh->meshnames[rank]));
+        }
+        DBFreeMultimesh(mesh);
+
+        var = DBGetMultivar(dbfile, "mass");
+        TS_ASSERT_EQUALS(mpiLayer.size(), var->nvars);
+        TS_ASSERT_EQUALS(DB_POINTVAR, var->vartypes[0]);
+        DBFreeMultivar(var);
+
+        // there are no shapes:
+        TS_ASSERT(!DBGetMultimesh(dbfile, "unstructured_mesh"));
+        DBClose(dbfile);
+    }
+#endif
+};
+
+}
@@ -0,0 +1,147 @@
+#include <libgeodecomp/io/statisticswriter.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/soagrid.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class StatisticsWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        prefix = TempFile::parallel("statisticswriter");
+    }
+
+    void tearDown()
+    {
+        if (MPILayer().rank() == 0) {
+            std::remove((prefix + ".stats").c_str());
+        }
+    }
+
+    void testAoS()
+    {
+        MPILayer mpiLayer;
+        Coord<2> dim(10, 6);
+        DisplacedGrid<TestCell<2> > grid(CoordBox<2>(Coord<2>(), dim));
+        Region<2> ownRegion;
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            ownRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+
+        StatisticsWriter<TestCell<2> > writer(prefix, 1);
+        writer.addMember(&TestCell<2>::testValue, "testValue", 6, 0, 60);
+        writer.addMember(&TestCell<2>::cycleCounter, "cycleCounter");
+
+        for (unsigned step = 0; step < 2; ++step) {
+            for (int y = 0; y < dim.y(); ++y) {
+                for (int x = 0; x < dim.x(); ++x) {
+                    grid[Coord<2>(x, y)].testValue = (step + 1) * (x + y * dim.x());
+                    grid[Coord<2>(x, y)].cycleCounter = step;
+                }
+            }
+
+            // feed the region in two parts, as HiParSimulator does
+            // for ghost zones and inner sets:
+            Region<2> leftColumns;
+            leftColumns << CoordBox<2>(Coord<2>(), Coord<2>(3, dim.y()));
+            Region<2> firstPart = ownRegion & leftColumns;
+            WriterEvent event = step ? WRITER_STEP_FINISHED : WRITER_INITIALIZED;
+            writer.stepFinished(grid, firstPart,             dim, step, event, mpiLayer.rank(), false);
+            writer.stepFinished(grid, ownRegion - firstPart, dim, step, event, mpiLayer.rank(), true);
+        }
+
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        std::ifstream infile((prefix + ".stats").c_str());
+        std::string line;
+        std::vector<std::string> lines;
+        while (std::getline(infile, line)) {
+            lines << line;
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(4), lines.size());
+        TS_ASSERT_EQUALS("0 testValue 60 0 59 29.5 10 10 10 10 10 10", lines[0]);
+        TS_ASSERT_EQUALS("0 cycleCounter 60 0 0 0",                    lines[1]);
+        // values beyond the histogram's range end up in the last bin:
+        TS_ASSERT_EQUALS("1 testValue 60 0 118 59 5 5 5 5 5 35",       lines[2]);
+        TS_ASSERT_EQUALS("1 cycleCounter 60 1 1 1",                    lines[3]);
+    }
+
+    void testSoA()
+    {
+        MPILayer mpiLayer;
+        Coord<3> dim(4, 3, 2 * mpiLayer.size());
+        CoordBox<3> box(Coord<3>(0, 0, 2 * mpiLayer.rank()), Coord<3>(4, 3, 2));
+        SoAGrid<TestCellSoA, Topologies::Cube<3>::Topology> grid(box);
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TestCellSoA cell;
+            cell.testValue = (*i).z() + 0.5;
+            grid.set(*i, cell);
+        }
+
+        Region<3> region;
+        region << box;
+        StatisticsWriter<TestCellSoA> writer(prefix, 1, mpiLayer.size() - 1);
+        writer.addMember(&TestCellSoA::testValue, "testValue");
+        writer.stepFinished(grid, region, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), true);
+
+        if (mpiLayer.rank() != (mpiLayer.size() - 1)) {
+            return;
+        }
+
+        std::ifstream infile((prefix + ".stats").c_str());
+        std::string line;
+        std::getline(infile, line);
+
+        std::stringstream expected;
+        expected << "0 testValue " << box.size() * mpiLayer.size() << " 0.5 "
+                 << (2 * mpiLayer.size() - 0.5) << " " << mpiLayer.size();
+        TS_ASSERT_EQUALS(expected.str(), line);
+    }
+
+    void testCloneHasOwnAccumulators()
+    {
+        MPILayer mpiLayer;
+        Coord<2> dim(10, 6);
+        DisplacedGrid<TestCell<2> > grid(CoordBox<2>(Coord<2>(), dim));
+        Region<2> ownRegion;
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            ownRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+
+        StatisticsWriter<TestCell<2> > writer(prefix, 1);
+        writer.addMember(&TestCell<2>::cycleCounter, "cycleCounter");
+        boost::shared_ptr<ParallelWriter<TestCell<2> > > clone(writer.clone());
+
+        // a step in progress must not leak into the clone's output:
+        writer.stepFinished(grid, ownRegion, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), false);
+        clone->stepFinished(grid, ownRegion, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), true);
+
+        if (mpiLayer.rank() != 0) {
+            return;
+        }
+
+        std::ifstream infile((prefix + ".stats").c_str());
+        std::string line;
+        std::getline(infile, line);
+        TS_ASSERT_EQUALS("0 cycleCounter 60 0 0 0", line);
+    }
+
+private:
+    std::string prefix;
+};
+
+}
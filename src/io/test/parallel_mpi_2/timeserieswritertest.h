@@ -0,0 +1,202 @@
+#include <libgeodecomp/io/timeseriesinitializer.h>
+#include <libgeodecomp/io/timeseriesreader.h>
+#include <libgeodecomp/io/timeserieswriter.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TimeSeriesWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        MPILayer mpiLayer;
+        prefix = TempFile::parallel("timeserieswriter");
+        dim = Coord<2>(13, 9);
+        for (int y = mpiLayer.rank(); y < dim.y(); y += mpiLayer.size()) {
+            ownRegion << Streak<2>(Coord<2>(0, y), dim.x());
+        }
+    }
+
+    void tearDown()
+    {
+        MPILayer mpiLayer;
+        mpiLayer.barrier();
+        if (mpiLayer.rank() == 0) {
+            for (unsigned step = 0; step < 10; ++step) {
+                std::remove(filename(step).c_str());
+            }
+        }
+    }
+
+    void testWriteAndRead()
+    {
+        for (int compress = 0; compress < 2; ++compress) {
+            writeSteps(compress, 0);
+
+            TimeSeriesReader<2> reader(filename(0));
+            TS_ASSERT_EQUALS(dim, reader.gridDimensions());
+            TS_ASSERT_EQUALS(Coord<2>(4, 3), reader.brickDimensions());
+
+            std::vector<unsigned> expectedSteps;
+            expectedSteps << 0 << 2 << 4 << 5;
+            TS_ASSERT_EQUALS(expectedSteps, reader.steps());
+
+            std::vector<std::string> expectedNames;
+            expectedNames << "testValue" << "cycleCounter";
+            TS_ASSERT_EQUALS(expectedNames, reader.memberNames());
+
+            for (std::size_t i = 0; i < expectedSteps.size(); ++i) {
+                checkSubBox(reader, expectedSteps[i]);
+            }
+        }
+    }
+
+    void testRollover()
+    {
+        writeSteps(true, 2);
+
+        TimeSeriesReader<2> first(filename(0));
+        TimeSeriesReader<2> second(filename(4));
+        std::vector<unsigned> expectedFirst;
+        std::vector<unsigned> expectedSecond;
+        expectedFirst << 0 << 2;
+        expectedSecond << 4 << 5;
+        TS_ASSERT_EQUALS(expectedFirst, first.steps());
+        TS_ASSERT_EQUALS(expectedSecond, second.steps());
+
+        checkSubBox(second, 5);
+    }
+
+    void testInitializer()
+    {
+        MPILayer mpiLayer;
+        writeSteps(true, 0);
+
+        std::vector<Selector<TestCell<2> > > selectors;
+        selectors << selector()
+                  << Selector<TestCell<2> >(&TestCell<2>::cycleCounter, "cycleCounter");
+        TestCell<2> prototype;
+        prototype.isValid = true;
+        TimeSeriesInitializer<TestCell<2> > initializer(
+            filename(0),
+            selectors,
+            4,
+            20,
+            prototype);
+        TS_ASSERT_EQUALS(dim, initializer.gridDimensions());
+        TS_ASSERT_EQUALS(unsigned(4), initializer.startStep());
+        TS_ASSERT(initializer.supportsParallelInit());
+
+        // includes a column beyond the grid, which is left untouched:
+        CoordBox<2> box(Coord<2>(9, 2 + mpiLayer.rank()), Coord<2>(5, 4));
+        DisplacedGrid<TestCell<2> > grid(box);
+        initializer.grid(&grid);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT(grid[*i].isValid);
+            if (i->x() < dim.x()) {
+                TS_ASSERT_EQUALS(value(*i, 4), grid[*i].testValue);
+                TS_ASSERT_EQUALS(unsigned(4), grid[*i].cycleCounter);
+            } else {
+                TS_ASSERT_EQUALS(prototype.testValue, grid[*i].testValue);
+            }
+        }
+
+        TS_ASSERT_THROWS(
+            TimeSeriesInitializer<TestCell<2> >(
+                filename(0),
+                selectors,
+                3,
+                20),
+            std::invalid_argument&);
+    }
+
+private:
+    std::string prefix;
+    Coord<2> dim;
+    Region<2> ownRegion;
+
+    static Selector<TestCell<2> > selector()
+    {
+        return Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue");
+    }
+
+    std::string filename(unsigned step)
+    {
+        return TimeSeriesWriter<TestCell<2> >(selector(), prefix, 1).filename(step);
+    }
+
+    double value(const Coord<2>& c, unsigned step)
+    {
+        return 1000.0 * step + c.y() * dim.x() + c.x();
+    }
+
+    /**
+     * Emulates a Simulator's calls: every other step is written, the
+     * final step is reported twice and, as in HiParSimulator, each
+     * step is delivered in two parts.
+     */
+    void writeSteps(bool compress, unsigned stepsPerFile)
+    {
+        MPILayer mpiLayer;
+        TimeSeriesWriter<TestCell<2> > writer(selector(), prefix, 2, Coord<2>(4, 3), stepsPerFile, compress);
+        writer.addSelector(Selector<TestCell<2> >(&TestCell<2>::cycleCounter, "cycleCounter"));
+        DisplacedGrid<TestCell<2> > grid(CoordBox<2>(Coord<2>(), dim));
+
+        Region<2> leftColumns;
+        leftColumns << CoordBox<2>(Coord<2>(), Coord<2>(5, dim.y()));
+        Region<2> firstPart = ownRegion & leftColumns;
+
+        for (unsigned step = 0; step <= 5; ++step) {
+            for (CoordBox<2>::Iterator i = grid.boundingBox().begin(); i != grid.boundingBox().end(); ++i) {
+                grid[*i].testValue = value(*i, step);
+                grid[*i].cycleCounter = step;
+            }
+
+            WriterEvent event = step ? WRITER_STEP_FINISHED : WRITER_INITIALIZED;
+            writer.stepFinished(grid, firstPart,             dim, step, event, mpiLayer.rank(), false);
+            writer.stepFinished(grid, ownRegion - firstPart, dim, step, event, mpiLayer.rank(), true);
+        }
+
+        writer.stepFinished(grid, firstPart,             dim, 5, WRITER_STEP_FINISHED, mpiLayer.rank(), false);
+        writer.stepFinished(grid, ownRegion - firstPart, dim, 5, WRITER_STEP_FINISHED, mpiLayer.rank(), true);
+        writer.stepFinished(grid, firstPart,             dim, 5, WRITER_ALL_DONE,      mpiLayer.rank(), false);
+        writer.stepFinished(grid, ownRegion - firstPart, dim, 5, WRITER_ALL_DONE,      mpiLayer.rank(), true);
+        mpiLayer.barrier();
+    }
+
+    void checkSubBox(const TimeSeriesReader<2>& reader, unsigned step)
+    {
+        MPILayer mpiLayer;
+        // the box straddles bricks and the parts written by all ranks:
+        CoordBox<2> box(Coord<2>(3, 1 + mpiLayer.rank()), Coord<2>(7, 5));
+        DisplacedGrid<TestCell<2> > grid(box);
+        Region<2> region;
+        region << box;
+
+        reader.read(&grid, selector(), step, region);
+        reader.read(&grid, Selector<TestCell<2> >(&TestCell<2>::cycleCounter, "cycleCounter"), step, region);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(value(*i, step), grid[*i].testValue);
+            TS_ASSERT_EQUALS(step, grid[*i].cycleCounter);
+        }
+
+        TS_ASSERT_THROWS(
+            reader.read(&grid, Selector<TestCell<2> >(&TestCell<2>::pos, "pos"), step, region),
+            std::invalid_argument&);
+        TS_ASSERT_THROWS(
+            reader.read(&grid, Selector<TestCell<2> >(&TestCell<2>::isValid, "cycleCounter"), step, region),
+            std::invalid_argument&);
+    }
+};
+
+}
@@ -0,0 +1,137 @@
+#include <libgeodecomp/io/collectingwriter.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/loadbalancer/randombalancer.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/stripingsimulator.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * With 4 ranks and a fan-out of 2 the tree has two levels below the
+ * root, so inner ranks need to merge their children's data with
+ * their own before forwarding it.
+ */
+class CollectingWriterTest : public CxxTest::TestSuite
+{
+public:
+    typedef DisplacedGrid<TestCell<2> > GridType;
+
+    void setUp()
+    {
+        dim = Coord<2>(20, 9);
+        // a root other than 0 checks the renumbering of the ranks:
+        root = 1;
+    }
+
+    void testTreeGathersInterleavedRegions()
+    {
+        MPILayer mpiLayer;
+        MemoryWriter<TestCell<2> > *memoryWriter = 0;
+        if (mpiLayer.rank() == root) {
+            memoryWriter = new MemoryWriter<TestCell<2> >(1);
+        }
+        CollectingWriter<TestCell<2> > writer(
+            memoryWriter,
+            root,
+            MPI_COMM_WORLD,
+            APITraits::SelectMPIDataType<TestCell<2> >::value(),
+            2);
+
+        GridType grid(CoordBox<2>(Coord<2>(), dim));
+        Region<2> region = ownRegion(mpiLayer.rank());
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            grid.set(*i, TestCell<2>(*i, dim, mpiLayer.rank() + 1));
+        }
+
+        // ghost zone and inner set are reported separately:
+        Region<2> upperHalf;
+        upperHalf << CoordBox<2>(Coord<2>(), Coord<2>(dim.x(), 4));
+        writer.stepFinished(grid, region & upperHalf, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), false);
+        writer.stepFinished(grid, region - upperHalf, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), true);
+
+        if (mpiLayer.rank() != root) {
+            return;
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(1), memoryWriter->getGrids().size());
+        const MemoryWriter<TestCell<2> >::StorageGrid& gathered = memoryWriter->getGrids()[0];
+        TS_ASSERT_EQUALS(dim, gathered.getDimensions());
+
+        for (int r = 0; r < mpiLayer.size(); ++r) {
+            Region<2> expected = ownRegion(r);
+            for (Region<2>::Iterator i = expected.begin(); i != expected.end(); ++i) {
+                TS_ASSERT(gathered.get(*i).valid());
+                TS_ASSERT_EQUALS(*i, gathered.get(*i).pos);
+                TS_ASSERT_EQUALS(unsigned(r + 1), gathered.get(*i).cycleCounter);
+            }
+        }
+
+        // cells which no rank owns remain untouched:
+        Region<2> hole = ownRegion(mpiLayer.size());
+        TS_ASSERT(!hole.empty());
+        for (Region<2>::Iterator i = hole.begin(); i != hole.end(); ++i) {
+            TS_ASSERT(!gathered.get(*i).valid());
+        }
+    }
+
+    void testTreeWithSimulator()
+    {
+        MPILayer mpiLayer;
+        MemoryWriter<TestCell<3> > *memoryWriter = 0;
+        if (mpiLayer.rank() == root) {
+            memoryWriter = new MemoryWriter<TestCell<3> >(3);
+        }
+
+        LoadBalancer *balancer = mpiLayer.rank()? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(new TestInitializer<TestCell<3> >(), balancer);
+        sim.addWriter(
+            new CollectingWriter<TestCell<3> >(
+                memoryWriter,
+                root,
+                MPI_COMM_WORLD,
+                APITraits::SelectMPIDataType<TestCell<3> >::value(),
+                2));
+        sim.run();
+
+        if (mpiLayer.rank() == root) {
+            int size = memoryWriter->getGrids().size();
+            TS_ASSERT_LESS_THAN(1, size);
+
+            for (int i = 0; i < (size - 1); ++i) {
+                unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * i * 3;
+                TS_ASSERT_TEST_GRID(MemoryWriter<TestCell<3> >::GridType, memoryWriter->getGrids()[i], cycle);
+            }
+        }
+    }
+
+private:
+    Coord<2> dim;
+    int root;
+
+    /**
+     * Rank r owns the pairs of columns for which (x / 2 + y) % 5 ==
+     * r, yielding many streaks per rank which interleave with those
+     * of the other ranks. Pass 4 to get the cells owned by none.
+     */
+    Region<2> ownRegion(int rank)
+    {
+        Region<2> ret;
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); x += 2) {
+                if ((x / 2 + y) % 5 == rank) {
+                    ret << Streak<2>(Coord<2>(x, y), x + 2);
+                }
+            }
+        }
+
+        return ret;
+    }
+};
+
+}
@@ -0,0 +1,28 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}checkpointmanifesttest.cpp
+  ${RELATIVE_PATH}clonableinitializerwrappertest.cpp
+  ${RELATIVE_PATH}downsamplingwritertest.cpp
+  ${RELATIVE_PATH}initializertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mmapinitializertest.cpp
+  ${RELATIVE_PATH}parallelgridinitializertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}serialbovwritertest.cpp
+  ${RELATIVE_PATH}silowritertest.cpp
+  ${RELATIVE_PATH}steerertest.cpp
+  ${RELATIVE_PATH}timeseriesformattest.cpp
+  ${RELATIVE_PATH}visitwritertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}checkpointmanifesttest.h
+  ${RELATIVE_PATH}clonableinitializerwrappertest.h
+  ${RELATIVE_PATH}downsamplingwritertest.h
+  ${RELATIVE_PATH}initializertest.h
+  ${RELATIVE_PATH}mmapinitializertest.h
+  ${RELATIVE_PATH}parallelgridinitializertest.h
+  ${RELATIVE_PATH}serialbovwritertest.h
+  ${RELATIVE_PATH}silowritertest.h
+  ${RELATIVE_PATH}steerertest.h
+  ${RELATIVE_PATH}timeseriesformattest.h
+  ${RELATIVE_PATH}visitwritertest.h
+)
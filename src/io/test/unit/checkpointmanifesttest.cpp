@@ -0,0 +1,45 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CheckpointManifestTest_init = false;
+#include "/root/repo/src/io/test/unit/checkpointmanifesttest.h"
+
+static CheckpointManifestTest suite_CheckpointManifestTest;
+
+static CxxTest::List Tests_CheckpointManifestTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CheckpointManifestTest( "/root/repo/src/io/test/unit/checkpointmanifesttest.h", 11, "CheckpointManifestTest", suite_CheckpointManifestTest, Tests_CheckpointManifestTest );
+
+static class TestDescription_suite_CheckpointManifestTest_testFilenames : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckpointManifestTest_testFilenames() : CxxTest::RealTestDescription( Tests_CheckpointManifestTest, suiteDescription_CheckpointManifestTest, 24, "testFilenames" ) {}
+ void runTest() { suite_CheckpointManifestTest.testFilenames(); }
+} testDescription_suite_CheckpointManifestTest_testFilenames;
+
+static class TestDescription_suite_CheckpointManifestTest_testAppendAndFind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckpointManifestTest_testAppendAndFind() : CxxTest::RealTestDescription( Tests_CheckpointManifestTest, suiteDescription_CheckpointManifestTest, 32, "testAppendAndFind" ) {}
+ void runTest() { suite_CheckpointManifestTest.testAppendAndFind(); }
+} testDescription_suite_CheckpointManifestTest_testAppendAndFind;
+
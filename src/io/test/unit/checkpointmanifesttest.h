@@ -0,0 +1,56 @@
+#include <libgeodecomp/io/checkpointmanifest.h>
+#include <libgeodecomp/misc/tempfile.h>
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CheckpointManifestTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        prefix = TempFile::serial("checkpointmanifest");
+    }
+
+    void tearDown()
+    {
+        std::remove(CheckpointManifest(prefix).filename().c_str());
+    }
+
+    void testFilenames()
+    {
+        CheckpointManifest manifest("foo/bar");
+        TS_ASSERT_EQUALS("foo/bar.checkpoints",  manifest.filename());
+        TS_ASSERT_EQUALS("foo/bar.00042.full",   manifest.fullFilename(42));
+        TS_ASSERT_EQUALS("foo/bar.00123.diff",   manifest.diffFilename(123));
+    }
+
+    void testAppendAndFind()
+    {
+        CheckpointManifest manifest(prefix);
+        TS_ASSERT_THROWS(manifest.latest(), FileOpenException&);
+
+        manifest.append(CheckpointManifest::Entry(10, 10, 100));
+        manifest.append(CheckpointManifest::Entry(20, 10, 100));
+        manifest.append(CheckpointManifest::Entry(30, 10, 100));
+
+        std::vector<CheckpointManifest::Entry> entries = manifest.entries();
+        TS_ASSERT_EQUALS(std::size_t(3), entries.size());
+        TS_ASSERT(entries[0].isFull());
+        TS_ASSERT(!entries[1].isFull());
+
+        TS_ASSERT_EQUALS(unsigned(30), manifest.latest().step);
+        TS_ASSERT_EQUALS(unsigned(10), manifest.latest().baseStep);
+        TS_ASSERT_EQUALS(unsigned(100), manifest.find(20).maxSteps);
+        TS_ASSERT_THROWS(manifest.find(25), std::invalid_argument&);
+    }
+
+private:
+    std::string prefix;
+};
+
+}
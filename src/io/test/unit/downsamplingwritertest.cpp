@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DownsamplingWriterTest_init = false;
+#include "/root/repo/src/io/test/unit/downsamplingwritertest.h"
+
+static DownsamplingWriterTest suite_DownsamplingWriterTest;
+
+static CxxTest::List Tests_DownsamplingWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DownsamplingWriterTest( "/root/repo/src/io/test/unit/downsamplingwritertest.h", 12, "DownsamplingWriterTest", suite_DownsamplingWriterTest, Tests_DownsamplingWriterTest );
+
+static class TestDescription_suite_DownsamplingWriterTest_testCoarsen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DownsamplingWriterTest_testCoarsen() : CxxTest::RealTestDescription( Tests_DownsamplingWriterTest, suiteDescription_DownsamplingWriterTest, 28, "testCoarsen" ) {}
+ void runTest() { suite_DownsamplingWriterTest.testCoarsen(); }
+} testDescription_suite_DownsamplingWriterTest_testCoarsen;
+
+static class TestDescription_suite_DownsamplingWriterTest_testWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DownsamplingWriterTest_testWriter() : CxxTest::RealTestDescription( Tests_DownsamplingWriterTest, suiteDescription_DownsamplingWriterTest, 54, "testWriter" ) {}
+ void runTest() { suite_DownsamplingWriterTest.testWriter(); }
+} testDescription_suite_DownsamplingWriterTest_testWriter;
+
+static class TestDescription_suite_DownsamplingWriterTest_testUnitStride : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DownsamplingWriterTest_testUnitStride() : CxxTest::RealTestDescription( Tests_DownsamplingWriterTest, suiteDescription_DownsamplingWriterTest, 76, "testUnitStride" ) {}
+ void runTest() { suite_DownsamplingWriterTest.testUnitStride(); }
+} testDescription_suite_DownsamplingWriterTest_testUnitStride;
+
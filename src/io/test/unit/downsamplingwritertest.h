@@ -0,0 +1,99 @@
+#include <libgeodecomp/io/downsamplingwriter.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class DownsamplingWriterTest : public CxxTest::TestSuite
+{
+public:
+    typedef DownsamplingWriterHelpers::Sampler<2> SamplerType;
+
+    void setUp()
+    {
+        dim = Coord<2>(10, 7);
+        grid = Grid<TestCell<2> >(dim);
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                grid[Coord<2>(x, y)] = TestCell<2>(Coord<2>(x, y), dim);
+            }
+        }
+    }
+
+    void testCoarsen()
+    {
+        SamplerType sampler(Coord<2>(3, 2), CoordBox<2>(Coord<2>(1, 1), Coord<2>(8, 5)));
+        TS_ASSERT_EQUALS(Coord<2>(3, 3), sampler.coarseDimensions(dim));
+        TS_ASSERT_EQUALS(Coord<2>(7, 5), sampler.fineCoord(Coord<2>(2, 2), dim));
+
+        // fine x coordinates 1, 4, 7 are sampled, rows 1, 3, 5:
+        Region<2> fineRegion;
+        fineRegion << Streak<2>(Coord<2>(2, 1), 8)
+                   << Streak<2>(Coord<2>(0, 2), 10)
+                   << Streak<2>(Coord<2>(0, 3),  4)
+                   << Streak<2>(Coord<2>(7, 5), 10);
+
+        Region<2> expected;
+        expected << Streak<2>(Coord<2>(1, 0), 3)
+                 << Streak<2>(Coord<2>(0, 1), 1)
+                 << Streak<2>(Coord<2>(2, 2), 3);
+        TS_ASSERT_EQUALS(expected, sampler.coarsen(fineRegion, dim));
+
+        // an empty ROI selects the whole grid:
+        SamplerType fullSampler(Coord<2>(4, 4));
+        TS_ASSERT_EQUALS(Coord<2>(3, 2), fullSampler.coarseDimensions(dim));
+
+        TS_ASSERT_THROWS(SamplerType(Coord<2>(0, 1)), std::invalid_argument);
+    }
+
+    void testWriter()
+    {
+        MemoryWriter<TestCell<2> > *memoryWriter = new MemoryWriter<TestCell<2> >(2);
+        DownsamplingWriter<TestCell<2> > writer(
+            memoryWriter,
+            Coord<2>(3, 2),
+            CoordBox<2>(Coord<2>(1, 1), Coord<2>(8, 5)));
+        TS_ASSERT_EQUALS(unsigned(2), writer.getPeriod());
+
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        writer.stepFinished(grid, 1, WRITER_STEP_FINISHED);
+        TS_ASSERT_EQUALS(std::size_t(1), memoryWriter->getGrids().size());
+
+        Grid<TestCell<2> >& coarseGrid = memoryWriter->getGrids()[0];
+        TS_ASSERT_EQUALS(Coord<2>(3, 3), coarseGrid.getDimensions());
+        for (int y = 0; y < 3; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                TS_ASSERT_EQUALS(Coord<2>(1 + 3 * x, 1 + 2 * y), coarseGrid[Coord<2>(x, y)].pos);
+            }
+        }
+    }
+
+    void testUnitStride()
+    {
+        MemoryWriter<TestCell<2> > *memoryWriter = new MemoryWriter<TestCell<2> >(1);
+        DownsamplingWriter<TestCell<2> > writer(
+            memoryWriter,
+            Coord<2>(1, 3),
+            CoordBox<2>(Coord<2>(2, 0), Coord<2>(5, 7)));
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+
+        Grid<TestCell<2> >& coarseGrid = memoryWriter->getGrids()[0];
+        TS_ASSERT_EQUALS(Coord<2>(5, 3), coarseGrid.getDimensions());
+        for (int y = 0; y < 3; ++y) {
+            for (int x = 0; x < 5; ++x) {
+                TS_ASSERT_EQUALS(Coord<2>(2 + x, 3 * y), coarseGrid[Coord<2>(x, y)].pos);
+            }
+        }
+    }
+
+private:
+    Coord<2> dim;
+    Grid<TestCell<2> > grid;
+};
+
+}
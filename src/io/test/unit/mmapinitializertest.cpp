@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MMapInitializerTest_init = false;
+#include "/root/repo/src/io/test/unit/mmapinitializertest.h"
+
+static MMapInitializerTest suite_MMapInitializerTest;
+
+static CxxTest::List Tests_MMapInitializerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MMapInitializerTest( "/root/repo/src/io/test/unit/mmapinitializertest.h", 15, "MMapInitializerTest", suite_MMapInitializerTest, Tests_MMapInitializerTest );
+
+static class TestDescription_suite_MMapInitializerTest_testMetadata : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MMapInitializerTest_testMetadata() : CxxTest::RealTestDescription( Tests_MMapInitializerTest, suiteDescription_MMapInitializerTest, 28, "testMetadata" ) {}
+ void runTest() { suite_MMapInitializerTest.testMetadata(); }
+} testDescription_suite_MMapInitializerTest_testMetadata;
+
+static class TestDescription_suite_MMapInitializerTest_testAlignedCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MMapInitializerTest_testAlignedCells() : CxxTest::RealTestDescription( Tests_MMapInitializerTest, suiteDescription_MMapInitializerTest, 39, "testAlignedCells" ) {}
+ void runTest() { suite_MMapInitializerTest.testAlignedCells(); }
+} testDescription_suite_MMapInitializerTest_testAlignedCells;
+
+static class TestDescription_suite_MMapInitializerTest_testUnalignedCellsOnTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MMapInitializerTest_testUnalignedCellsOnTorus() : CxxTest::RealTestDescription( Tests_MMapInitializerTest, suiteDescription_MMapInitializerTest, 55, "testUnalignedCellsOnTorus" ) {}
+ void runTest() { suite_MMapInitializerTest.testUnalignedCellsOnTorus(); }
+} testDescription_suite_MMapInitializerTest_testUnalignedCellsOnTorus;
+
+static class TestDescription_suite_MMapInitializerTest_testRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MMapInitializerTest_testRegion() : CxxTest::RealTestDescription( Tests_MMapInitializerTest, suiteDescription_MMapInitializerTest, 73, "testRegion" ) {}
+ void runTest() { suite_MMapInitializerTest.testRegion(); }
+} testDescription_suite_MMapInitializerTest_testRegion;
+
+static class TestDescription_suite_MMapInitializerTest_testTruncatedFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MMapInitializerTest_testTruncatedFile() : CxxTest::RealTestDescription( Tests_MMapInitializerTest, suiteDescription_MMapInitializerTest, 93, "testTruncatedFile" ) {}
+ void runTest() { suite_MMapInitializerTest.testTruncatedFile(); }
+} testDescription_suite_MMapInitializerTest_testTruncatedFile;
+
@@ -0,0 +1,146 @@
+#include <libgeodecomp/io/mmapinitializer.h>
+#include <libgeodecomp/io/parallelgridinitializer.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cstdio>
+#include <fstream>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class MMapInitializerTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        filename = TempFile::serial("mmapinitializer");
+    }
+
+    void tearDown()
+    {
+        std::remove(filename.c_str());
+    }
+
+    void testMetadata()
+    {
+        writeSnapshot<TestCell<2> >(Coord<2>(17, 12), 5, 42);
+        MMapInitializer<TestCell<2> > initializer(filename);
+
+        TS_ASSERT_EQUALS(Coord<2>(17, 12), initializer.gridDimensions());
+        TS_ASSERT_EQUALS(unsigned(5),  initializer.startStep());
+        TS_ASSERT_EQUALS(unsigned(42), initializer.maxSteps());
+        TS_ASSERT(initializer.supportsParallelInit());
+    }
+
+    void testAlignedCells()
+    {
+        Coord<2> dim(17, 12);
+        writeSnapshot<TestCell<2> >(dim, 5, 42);
+        MMapInitializer<TestCell<2> > initializer(filename);
+
+        CoordBox<2> box(Coord<2>(3, 2), Coord<2>(10, 8));
+        DisplacedGrid<TestCell<2> > actual(box);
+        initializer.grid(&actual);
+        TS_ASSERT(actual.getEdge().isEdgeCell);
+
+        DisplacedGrid<TestCell<2> > expected(box);
+        TestInitializer<TestCell<2> >(dim, 42, 5).grid(&expected);
+        checkEqual(expected, actual, box);
+    }
+
+    void testUnalignedCellsOnTorus()
+    {
+        // the header is 20 bytes long here, so cells are copied via a
+        // buffer. Also, the grid exceeds the simulation space on
+        // each side, hence streaks wrap around:
+        Coord<3> dim(13, 12, 11);
+        writeSnapshot<TestCell<3> >(dim, 0, 10);
+        MMapInitializer<TestCell<3> > initializer(filename);
+
+        CoordBox<3> box(Coord<3>(-1, -1, -1), Coord<3>(15, 14, 13));
+        DisplacedGrid<TestCell<3>, Topologies::Torus<3>::Topology> actual(box, TestCell<3>(), TestCell<3>(), dim);
+        ParallelGridInitializer<TestCell<3> >()(&initializer, &actual);
+
+        DisplacedGrid<TestCell<3>, Topologies::Torus<3>::Topology> expected(box, TestCell<3>(), TestCell<3>(), dim);
+        TestInitializer<TestCell<3> >(dim, 10, 0).grid(&expected);
+        checkEqual(expected, actual, box);
+    }
+
+    void testRegion()
+    {
+        Coord<2> dim(17, 12);
+        writeSnapshot<TestCell<2> >(dim, 0, 10);
+        MMapInitializer<TestCell<2> > initializer(filename);
+
+        CoordBox<2> box(Coord<2>(), dim);
+        Region<2> region;
+        region << CoordBox<2>(Coord<2>(2, 1), Coord<2>(5, 3))
+               << Streak<2>(Coord<2>(9, 7), 16);
+
+        DisplacedGrid<TestCell<2> > actual(box);
+        ParallelGridInitializer<TestCell<2> >(false)(&initializer, &actual, region);
+
+        // cells outside of the region remain untouched:
+        DisplacedGrid<TestCell<2> > expected(box);
+        TestInitializer<TestCell<2> >(dim, 10, 0).initRegion(&expected, region);
+        checkEqual(expected, actual, box);
+    }
+
+    void testTruncatedFile()
+    {
+        writeSnapshot<TestCell<2> >(Coord<2>(17, 12), 0, 10);
+        {
+            std::ofstream file(filename.c_str(), std::ios::binary | std::ios::app);
+            file << "trailing garbage is fine";
+        }
+        TS_ASSERT_THROWS_NOTHING(MMapInitializer<TestCell<2> > initializer(filename));
+
+        writeSnapshot<TestCell<2> >(Coord<2>(17, 12), 0, 10, 1);
+        TS_ASSERT_THROWS(MMapInitializer<TestCell<2> > initializer(filename), FileReadException&);
+        TS_ASSERT_THROWS(MMapInitializer<TestCell<2> > initializer(filename + "nonexistent"), FileOpenException&);
+    }
+
+private:
+    std::string filename;
+
+    /**
+     * Writes a snapshot of the TestInitializer's grid, omitting the
+     * last missingCells cells.
+     */
+    template<typename CELL, int DIM>
+    void writeSnapshot(const Coord<DIM>& dim, unsigned step, unsigned maxSteps, std::size_t missingCells = 0)
+    {
+        typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+        CoordBox<DIM> box(Coord<DIM>(), dim);
+        DisplacedGrid<CELL, Topology> grid(box);
+        TestInitializer<CELL>(dim, maxSteps, step).grid(&grid);
+        CELL edge = grid.getEdge();
+
+        std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&dim),      sizeof(dim));
+        file.write(reinterpret_cast<const char*>(&step),     sizeof(step));
+        file.write(reinterpret_cast<const char*>(&maxSteps), sizeof(maxSteps));
+        file.write(reinterpret_cast<const char*>(&edge),     sizeof(edge));
+
+        std::size_t numCells = box.size() - missingCells;
+        typename CoordBox<DIM>::Iterator i = box.begin();
+        for (std::size_t n = 0; n < numCells; ++n, ++i) {
+            CELL cell = grid.get(*i);
+            file.write(reinterpret_cast<const char*>(&cell), sizeof(cell));
+        }
+    }
+
+    template<typename GRID, int DIM>
+    void checkEqual(const GRID& expected, const GRID& actual, const CoordBox<DIM>& box)
+    {
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(expected.get(*i), actual.get(*i));
+        }
+    }
+};
+
+}
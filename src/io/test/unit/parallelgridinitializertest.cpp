@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelGridInitializerTest_init = false;
+#include "/root/repo/src/io/test/unit/parallelgridinitializertest.h"
+
+static ParallelGridInitializerTest suite_ParallelGridInitializerTest;
+
+static CxxTest::List Tests_ParallelGridInitializerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelGridInitializerTest( "/root/repo/src/io/test/unit/parallelgridinitializertest.h", 67, "ParallelGridInitializerTest", suite_ParallelGridInitializerTest, Tests_ParallelGridInitializerTest );
+
+static class TestDescription_suite_ParallelGridInitializerTest_testParallelInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelGridInitializerTest_testParallelInit() : CxxTest::RealTestDescription( Tests_ParallelGridInitializerTest, suiteDescription_ParallelGridInitializerTest, 72, "testParallelInit" ) {}
+ void runTest() { suite_ParallelGridInitializerTest.testParallelInit(); }
+} testDescription_suite_ParallelGridInitializerTest_testParallelInit;
+
+static class TestDescription_suite_ParallelGridInitializerTest_testFallbackToSerialInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelGridInitializerTest_testFallbackToSerialInit() : CxxTest::RealTestDescription( Tests_ParallelGridInitializerTest, suiteDescription_ParallelGridInitializerTest, 99, "testFallbackToSerialInit" ) {}
+ void runTest() { suite_ParallelGridInitializerTest.testFallbackToSerialInit(); }
+} testDescription_suite_ParallelGridInitializerTest_testFallbackToSerialInit;
+
+static class TestDescription_suite_ParallelGridInitializerTest_testRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelGridInitializerTest_testRegion() : CxxTest::RealTestDescription( Tests_ParallelGridInitializerTest, suiteDescription_ParallelGridInitializerTest, 111, "testRegion" ) {}
+ void runTest() { suite_ParallelGridInitializerTest.testRegion(); }
+} testDescription_suite_ParallelGridInitializerTest_testRegion;
+
+static class TestDescription_suite_ParallelGridInitializerTest_testReplicate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelGridInitializerTest_testReplicate() : CxxTest::RealTestDescription( Tests_ParallelGridInitializerTest, suiteDescription_ParallelGridInitializerTest, 144, "testReplicate" ) {}
+ void runTest() { suite_ParallelGridInitializerTest.testReplicate(); }
+} testDescription_suite_ParallelGridInitializerTest_testReplicate;
+
@@ -0,0 +1,174 @@
+#include <libgeodecomp/io/parallelgridinitializer.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Records the regions passed to initRegion() so we can check that
+ * they cover the grid.
+ */
+class RecordingTestInitializer : public TestInitializer<TestCell<3> >
+{
+public:
+    explicit RecordingTestInitializer(const Coord<3>& dim) :
+        TestInitializer<TestCell<3> >(dim),
+        gridCalls(0),
+        edgeCalls(0)
+    {}
+
+    virtual void grid(GridBase<TestCell<3>, 3> *ret)
+    {
+        ++gridCalls;
+        TestInitializer<TestCell<3> >::grid(ret);
+    }
+
+    virtual void initRegion(GridBase<TestCell<3>, 3> *ret, const Region<3>& region)
+    {
+#pragma omp critical
+        {
+            regions << region;
+        }
+        TestInitializer<TestCell<3> >::initRegion(ret, region);
+    }
+
+    virtual void initEdge(GridBase<TestCell<3>, 3> *ret)
+    {
+        ++edgeCalls;
+        TestInitializer<TestCell<3> >::initEdge(ret);
+    }
+
+    std::vector<Region<3> > regions;
+    int gridCalls;
+    int edgeCalls;
+};
+
+/**
+ * An Initializer which doesn't support parallel initialization.
+ */
+class SerialTestInitializer : public RecordingTestInitializer
+{
+public:
+    explicit SerialTestInitializer(const Coord<3>& dim) :
+        RecordingTestInitializer(dim)
+    {}
+
+    virtual bool supportsParallelInit() const
+    {
+        return false;
+    }
+};
+
+class ParallelGridInitializerTest : public CxxTest::TestSuite
+{
+public:
+    typedef DisplacedGrid<TestCell<3>, Topologies::Torus<3>::Topology> GridType;
+
+    void testParallelInit()
+    {
+        CoordBox<3> box(Coord<3>(1, 2, 3), Coord<3>(10, 9, 7));
+        RecordingTestInitializer initializer(Coord<3>(20, 20, 20));
+        GridType grid(box);
+
+        ParallelGridInitializer<TestCell<3> >()(&initializer, &grid);
+        TS_ASSERT_EQUALS(0, initializer.gridCalls);
+        TS_ASSERT_EQUALS(1, initializer.edgeCalls);
+        TS_ASSERT(grid.getEdge().isEdgeCell);
+
+        // one region per plane:
+        TS_ASSERT_EQUALS(std::size_t(7), initializer.regions.size());
+        Region<3> sum;
+        for (std::size_t i = 0; i < initializer.regions.size(); ++i) {
+            TS_ASSERT((sum & initializer.regions[i]).empty());
+            sum += initializer.regions[i];
+        }
+        Region<3> expected;
+        expected << box;
+        TS_ASSERT_EQUALS(expected, sum);
+
+        GridType reference(box);
+        RecordingTestInitializer(Coord<3>(20, 20, 20)).grid(&reference);
+        checkEqual(reference, grid);
+    }
+
+    void testFallbackToSerialInit()
+    {
+        CoordBox<3> box(Coord<3>(), Coord<3>(4, 5, 6));
+        SerialTestInitializer initializer(box.dimensions);
+        GridType grid(box);
+
+        ParallelGridInitializer<TestCell<3> >()(&initializer, &grid);
+        TS_ASSERT_EQUALS(1, initializer.gridCalls);
+        TS_ASSERT_EQUALS(std::size_t(1), initializer.regions.size());
+        TS_ASSERT_TEST_GRID(GridType, grid, 0);
+    }
+
+    void testRegion()
+    {
+        CoordBox<3> box(Coord<3>(), Coord<3>(10, 9, 7));
+        Region<3> region;
+        region << CoordBox<3>(Coord<3>(1, 1, 1), Coord<3>(3, 4, 5))
+               << Streak<3>(Coord<3>(0, 8, 6), 10);
+
+        // even without OpenMP only the region gets initialized:
+        RecordingTestInitializer initializer(box.dimensions);
+        GridType grid(box);
+        ParallelGridInitializer<TestCell<3> > gridInitializer(false);
+        gridInitializer(&initializer, &grid, region);
+        TS_ASSERT_EQUALS(0, initializer.gridCalls);
+        TS_ASSERT_EQUALS(1, initializer.edgeCalls);
+
+        Region<3> sum;
+        for (std::size_t i = 0; i < initializer.regions.size(); ++i) {
+            sum += initializer.regions[i];
+        }
+        TS_ASSERT_EQUALS(region, sum);
+
+        GridType target(box);
+        gridInitializer.replicate(&initializer, grid, &target, region);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(region.count(*i) ? grid.get(*i) : TestCell<3>(), target.get(*i));
+        }
+
+        // Initializers which need to set up the whole grid still can:
+        SerialTestInitializer serialInitializer(box.dimensions);
+        gridInitializer(&serialInitializer, &grid, region);
+        TS_ASSERT_EQUALS(1, serialInitializer.gridCalls);
+    }
+
+    void testReplicate()
+    {
+        CoordBox<3> box(Coord<3>(-1, -1, -1), Coord<3>(15, 14, 13));
+        RecordingTestInitializer initializer(Coord<3>(13, 12, 11));
+        GridType source(box);
+        GridType target(box);
+
+        ParallelGridInitializer<TestCell<3> > gridInitializer;
+        gridInitializer(&initializer, &source);
+        gridInitializer.replicate(&initializer, source, &target);
+
+        // the Initializer was only used for the source grid:
+        TS_ASSERT_EQUALS(1, initializer.edgeCalls);
+        TS_ASSERT_EQUALS(std::size_t(13), initializer.regions.size());
+        TS_ASSERT(target.getEdge().isEdgeCell);
+        checkEqual(source, target);
+    }
+
+private:
+    void checkEqual(const GridType& expected, const GridType& actual)
+    {
+        CoordBox<3> box = expected.boundingBox();
+        TS_ASSERT_EQUALS(box, actual.boundingBox());
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(expected.get(*i), actual.get(*i));
+        }
+    }
+};
+
+}
@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SiloWriterTest_init = false;
+#include "/root/repo/src/io/test/unit/silowritertest.h"
+
+static SiloWriterTest suite_SiloWriterTest;
+
+static CxxTest::List Tests_SiloWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SiloWriterTest( "/root/repo/src/io/test/unit/silowritertest.h", 276, "SiloWriterTest", suite_SiloWriterTest, Tests_SiloWriterTest );
+
+static class TestDescription_suite_SiloWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SiloWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_SiloWriterTest, suiteDescription_SiloWriterTest, 410, "testBasic" ) {}
+ void runTest() { suite_SiloWriterTest.testBasic(); }
+} testDescription_suite_SiloWriterTest_testBasic;
+
+static class TestDescription_suite_SiloWriterTest_testMemberExtraction1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SiloWriterTest_testMemberExtraction1() : CxxTest::RealTestDescription( Tests_SiloWriterTest, suiteDescription_SiloWriterTest, 511, "testMemberExtraction1" ) {}
+ void runTest() { suite_SiloWriterTest.testMemberExtraction1(); }
+} testDescription_suite_SiloWriterTest_testMemberExtraction1;
+
+static class TestDescription_suite_SiloWriterTest_testMemberExtraction2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SiloWriterTest_testMemberExtraction2() : CxxTest::RealTestDescription( Tests_SiloWriterTest, suiteDescription_SiloWriterTest, 597, "testMemberExtraction2" ) {}
+ void runTest() { suite_SiloWriterTest.testMemberExtraction2(); }
+} testDescription_suite_SiloWriterTest_testMemberExtraction2;
+
@@ -0,0 +1,69 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TimeSeriesFormatTest_init = false;
+#include "/root/repo/src/io/test/unit/timeseriesformattest.h"
+
+static TimeSeriesFormatTest suite_TimeSeriesFormatTest;
+
+static CxxTest::List Tests_TimeSeriesFormatTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimeSeriesFormatTest( "/root/repo/src/io/test/unit/timeseriesformattest.h", 9, "TimeSeriesFormatTest", suite_TimeSeriesFormatTest, Tests_TimeSeriesFormatTest );
+
+static class TestDescription_suite_TimeSeriesFormatTest_testShuffle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testShuffle() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 12, "testShuffle" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testShuffle(); }
+} testDescription_suite_TimeSeriesFormatTest_testShuffle;
+
+static class TestDescription_suite_TimeSeriesFormatTest_testCompressRoundTrip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testCompressRoundTrip() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 31, "testCompressRoundTrip" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testCompressRoundTrip(); }
+} testDescription_suite_TimeSeriesFormatTest_testCompressRoundTrip;
+
+static class TestDescription_suite_TimeSeriesFormatTest_testCorruptData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testCorruptData() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 57, "testCorruptData" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testCorruptData(); }
+} testDescription_suite_TimeSeriesFormatTest_testCorruptData;
+
+static class TestDescription_suite_TimeSeriesFormatTest_testBricks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testBricks() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 72, "testBricks" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testBricks(); }
+} testDescription_suite_TimeSeriesFormatTest_testBricks;
+
+static class TestDescription_suite_TimeSeriesFormatTest_testChunkRoundTrip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testChunkRoundTrip() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 93, "testChunkRoundTrip" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testChunkRoundTrip(); }
+} testDescription_suite_TimeSeriesFormatTest_testChunkRoundTrip;
+
+static class TestDescription_suite_TimeSeriesFormatTest_testHeader : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeSeriesFormatTest_testHeader() : CxxTest::RealTestDescription( Tests_TimeSeriesFormatTest, suiteDescription_TimeSeriesFormatTest, 119, "testHeader" ) {}
+ void runTest() { suite_TimeSeriesFormatTest.testHeader(); }
+} testDescription_suite_TimeSeriesFormatTest_testHeader;
+
@@ -0,0 +1,162 @@
+#include <libgeodecomp/io/timeseriesformat.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TimeSeriesFormatTest : public CxxTest::TestSuite
+{
+public:
+    void testShuffle()
+    {
+        std::vector<char> source;
+        for (int i = 0; i < 12; ++i) {
+            source << char(i);
+        }
+
+        std::vector<char> shuffled(12);
+        std::vector<char> unshuffled(12);
+        TimeSeriesFormat::Codec::shuffle(&source[0], 3, 4, &shuffled[0]);
+        TS_ASSERT_EQUALS(char(0), shuffled[0]);
+        TS_ASSERT_EQUALS(char(4), shuffled[1]);
+        TS_ASSERT_EQUALS(char(8), shuffled[2]);
+        TS_ASSERT_EQUALS(char(1), shuffled[3]);
+
+        TimeSeriesFormat::Codec::unshuffle(&shuffled[0], 3, 4, &unshuffled[0]);
+        TS_ASSERT_EQUALS(source, unshuffled);
+    }
+
+    void testCompressRoundTrip()
+    {
+        std::vector<char> smooth;
+        for (int i = 0; i < 5000; ++i) {
+            smooth << char(i / 100);
+        }
+        checkRoundTrip(smooth);
+
+        std::vector<char> compressed;
+        TimeSeriesFormat::Codec::compress(smooth, &compressed);
+        TS_ASSERT_LESS_THAN(compressed.size() * 10, smooth.size());
+
+        // incompressible data may grow slightly, but must survive:
+        std::vector<char> noise;
+        unsigned seed = 47;
+        for (int i = 0; i < 3000; ++i) {
+            seed = seed * 1103515245 + 12345;
+            noise << char(seed >> 16);
+        }
+        checkRoundTrip(noise);
+
+        checkRoundTrip(std::vector<char>());
+        checkRoundTrip(std::vector<char>(3, 'a'));
+        checkRoundTrip(std::vector<char>(1000, 'a'));
+    }
+
+    void testCorruptData()
+    {
+        std::vector<char> source(1000, 'x');
+        std::vector<char> compressed;
+        std::vector<char> target;
+        TimeSeriesFormat::Codec::compress(source, &compressed);
+
+        TS_ASSERT_THROWS(
+            TimeSeriesFormat::Codec::decompress(&compressed[0], compressed.size() - 1, source.size(), &target),
+            IOException&);
+        TS_ASSERT_THROWS(
+            TimeSeriesFormat::Codec::decompress(&compressed[0], compressed.size(), source.size() - 1, &target),
+            IOException&);
+    }
+
+    void testBricks()
+    {
+        TimeSeriesFormat::Bricks<2> bricks(Coord<2>(10, 7), Coord<2>(4, 3));
+        std::vector<boost::uint64_t> ids;
+        std::vector<CoordBox<2> > boxes;
+        bricks.intersecting(CoordBox<2>(Coord<2>(3, 2), Coord<2>(2, 5)), &ids, &boxes);
+
+        // 3x3 bricks, the box touches columns 0-1 and rows 0-2:
+        std::vector<boost::uint64_t> expectedIDs;
+        expectedIDs << 0 << 1 << 3 << 4 << 6 << 7;
+        TS_ASSERT_EQUALS(expectedIDs, ids);
+        TS_ASSERT_EQUALS(CoordBox<2>(Coord<2>(4, 6), Coord<2>(4, 3)), boxes[5]);
+
+        ids.clear();
+        boxes.clear();
+        bricks.intersecting(CoordBox<2>(Coord<2>(-5, -5), Coord<2>(3, 20)), &ids, &boxes);
+        TS_ASSERT(ids.empty());
+
+        TS_ASSERT_THROWS((TimeSeriesFormat::Bricks<2>(Coord<2>(10, 7), Coord<2>(0, 3))), std::invalid_argument);
+    }
+
+    void testChunkRoundTrip()
+    {
+        Region<3> region;
+        region << Streak<3>(Coord<3>(1, 2, 3), 6)
+               << Streak<3>(Coord<3>(2, 3, 3), 4);
+
+        std::vector<char> data;
+        for (std::size_t i = 0; i < region.size(); ++i) {
+            double value = 1.5 * i;
+            data.insert(data.end(), reinterpret_cast<char*>(&value), reinterpret_cast<char*>(&value) + 8);
+        }
+
+        for (int compress = 0; compress < 2; ++compress) {
+            std::vector<char> raw;
+            std::vector<char> encoded;
+            TimeSeriesFormat::encodeChunk(region, data, 8, compress, &raw, &encoded);
+            TS_ASSERT(encoded.size() <= raw.size());
+
+            Region<3> decodedRegion;
+            std::vector<char> decodedData;
+            TimeSeriesFormat::decodeChunk(encoded, raw.size(), 8, compress, &decodedRegion, &decodedData);
+            TS_ASSERT_EQUALS(region, decodedRegion);
+            TS_ASSERT_EQUALS(data, decodedData);
+        }
+    }
+
+    void testHeader()
+    {
+        TimeSeriesFormat::Header<2> header;
+        header.gridDimensions = Coord<2>(100, 50);
+        header.brickDimensions = Coord<2>(32, 32);
+        header.compressed = true;
+        header.names << "rho" << "velocity";
+        header.elementSizes << 8 << 24;
+
+        std::vector<char> buffer;
+        header.serialize(&buffer);
+        TS_ASSERT_EQUALS(std::string(TimeSeriesFormat::magic()), std::string(&buffer[0], 8));
+
+        std::size_t offset = TimeSeriesFormat::MAGIC_LENGTH;
+        TS_ASSERT_EQUALS(TimeSeriesFormat::BYTE_ORDER_MARK, TimeSeriesFormat::extract<boost::uint32_t>(buffer, &offset));
+        TS_ASSERT_EQUALS(buffer.size(), TimeSeriesFormat::extract<boost::uint64_t>(buffer, &offset));
+
+        TimeSeriesFormat::Header<2> parsed;
+        parsed.parse(std::vector<char>(buffer.begin() + TimeSeriesFormat::PREAMBLE_LENGTH, buffer.end()));
+        TS_ASSERT_EQUALS(header.gridDimensions,  parsed.gridDimensions);
+        TS_ASSERT_EQUALS(header.brickDimensions, parsed.brickDimensions);
+        TS_ASSERT_EQUALS(header.compressed,      parsed.compressed);
+        TS_ASSERT_EQUALS(header.names,           parsed.names);
+        TS_ASSERT_EQUALS(header.elementSizes,    parsed.elementSizes);
+
+        TimeSeriesFormat::Header<3> wrongDim;
+        TS_ASSERT_THROWS(
+            wrongDim.parse(std::vector<char>(buffer.begin() + TimeSeriesFormat::PREAMBLE_LENGTH, buffer.end())),
+            IOException&);
+    }
+
+private:
+    void checkRoundTrip(const std::vector<char>& source)
+    {
+        std::vector<char> compressed;
+        std::vector<char> decompressed;
+        TimeSeriesFormat::Codec::compress(source, &compressed);
+        TimeSeriesFormat::Codec::decompress(
+            compressed.empty() ? 0 : &compressed[0], compressed.size(), source.size(), &decompressed);
+        TS_ASSERT_EQUALS(source, decompressed);
+    }
+};
+
+}
@@ -29,14 +29,29 @@ public:
 
     virtual void grid(GridBase<TEST_CELL, DIM> *ret)
     {
-        CoordBox<DIM> rect = ret->boundingBox();
+        Region<DIM> region;
+        region << ret->boundingBox();
+        initRegion(ret, region);
+        initEdge(ret);
+    }
+
+    virtual bool supportsParallelInit() const
+    {
+        return true;
+    }
+
+    virtual void initRegion(GridBase<TEST_CELL, DIM> *ret, const Region<DIM>& region)
+    {
         unsigned cycle = startStep() * NANO_STEPS;
-        for (typename CoordBox<DIM>::Iterator i = rect.begin(); i != rect.end(); ++i) {
+        for (typename Region<DIM>::Iterator i = region.begin(); i != region.end(); ++i) {
             Coord<DIM> coord = Topology::normalize(*i, dimensions);
             double index = 1 + coord.toIndex(dimensions);
             ret->set(*i, TEST_CELL(coord, dimensions, cycle, index));
         }
+    }
 
+    virtual void initEdge(GridBase<TEST_CELL, DIM> *ret)
+    {
         TEST_CELL edgeCell(Coord<DIM>::diagonal(-1), dimensions);
         edgeCell.isEdgeCell = true;
         ret->setEdge(edgeCell);
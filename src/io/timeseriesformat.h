@@ -0,0 +1,493 @@
+#ifndef LIBGEODECOMP_IO_TIMESERIESFORMAT_H
+#define LIBGEODECOMP_IO_TIMESERIESFORMAT_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Building blocks of the time series container written by
+ * TimeSeriesWriter and read by TimeSeriesReader. A file holds any
+ * number of time steps of a set of members (see Selector). Each
+ * member of each step is split into chunks along a regular grid of
+ * bricks, so that readers may fetch any sub-box of any step by
+ * reading only the chunks which overlap it. Chunks may be
+ * compressed. The layout (all values in native byte order) is:
+ *
+ * - header: magic, byte order mark, header length, dimension,
+ *   grid and brick dimensions, compression flag, member names and
+ *   element sizes (see Header)
+ * - chunks: the streaks of the chunk's region, followed by its cells
+ * - index: one IndexEntry per chunk
+ * - trailer: offset of the index, magic
+ *
+ * If a brick straddles several ranks, each of them writes its own
+ * chunk for that brick.
+ */
+namespace TimeSeriesFormat {
+
+inline const char *magic()
+{
+    return "LGDTS01\n";
+}
+
+static const std::size_t MAGIC_LENGTH = 8;
+static const std::size_t PREAMBLE_LENGTH = MAGIC_LENGTH + sizeof(boost::uint32_t) + sizeof(boost::uint64_t);
+static const std::size_t TRAILER_LENGTH = sizeof(boost::uint64_t) + MAGIC_LENGTH;
+
+static const boost::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * Appends value's bytes to buffer.
+ */
+template<typename T>
+void append(std::vector<char> *buffer, const T& value)
+{
+    const char *bytes = reinterpret_cast<const char*>(&value);
+    buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+/**
+ * Counterpart of append(): reads a value at *offset and advances it.
+ */
+template<typename T>
+T extract(const std::vector<char>& buffer, std::size_t *offset)
+{
+    if (*offset + sizeof(T) > buffer.size()) {
+        throw IOException("truncated time series header");
+    }
+
+    T ret;
+    std::memcpy(&ret, &buffer[*offset], sizeof(T));
+    *offset += sizeof(T);
+    return ret;
+}
+
+/**
+ * Global metadata of a file: grid and brick dimensions and the
+ * members stored per step. The serialized form starts with the magic,
+ * a byte order mark and the header's total length, so that readers
+ * can detect foreign files (and foreign endianness) early.
+ */
+template<int DIM>
+class Header
+{
+public:
+    Header() :
+        compressed(false)
+    {}
+
+    void serialize(std::vector<char> *buffer) const
+    {
+        std::vector<char> body;
+        append(&body, boost::uint32_t(DIM));
+        for (int d = 0; d < DIM; ++d) {
+            append(&body, boost::int32_t(gridDimensions[d]));
+        }
+        for (int d = 0; d < DIM; ++d) {
+            append(&body, boost::int32_t(brickDimensions[d]));
+        }
+        append(&body, boost::uint32_t(compressed));
+        append(&body, boost::uint32_t(names.size()));
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            append(&body, boost::uint32_t(names[i].size()));
+            body.insert(body.end(), names[i].begin(), names[i].end());
+            append(&body, boost::uint64_t(elementSizes[i]));
+        }
+
+        buffer->assign(magic(), magic() + MAGIC_LENGTH);
+        append(buffer, BYTE_ORDER_MARK);
+        append(buffer, boost::uint64_t(PREAMBLE_LENGTH + body.size()));
+        buffer->insert(buffer->end(), body.begin(), body.end());
+    }
+
+    /**
+     * Parses the header's body, i.e. everything behind the 20 bytes
+     * of magic, byte order mark and length (PREAMBLE_LENGTH).
+     */
+    void parse(const std::vector<char>& body)
+    {
+        std::size_t offset = 0;
+        if (extract<boost::uint32_t>(body, &offset) != DIM) {
+            throw IOException("time series file has wrong dimension");
+        }
+        for (int d = 0; d < DIM; ++d) {
+            gridDimensions[d] = extract<boost::int32_t>(body, &offset);
+        }
+        for (int d = 0; d < DIM; ++d) {
+            brickDimensions[d] = extract<boost::int32_t>(body, &offset);
+        }
+        compressed = extract<boost::uint32_t>(body, &offset);
+
+        boost::uint32_t numMembers = extract<boost::uint32_t>(body, &offset);
+        names.clear();
+        elementSizes.clear();
+        for (boost::uint32_t i = 0; i < numMembers; ++i) {
+            boost::uint32_t length = extract<boost::uint32_t>(body, &offset);
+            if (offset + length > body.size()) {
+                throw IOException("truncated time series header");
+            }
+            names << std::string(&body[offset], length);
+            offset += length;
+            elementSizes << std::size_t(extract<boost::uint64_t>(body, &offset));
+        }
+    }
+
+    Coord<DIM> gridDimensions;
+    Coord<DIM> brickDimensions;
+    bool compressed;
+    std::vector<std::string> names;
+    std::vector<std::size_t> elementSizes;
+};
+
+/**
+ * Locates one chunk within the file. Chunks are stored compressed
+ * iff size < rawSize.
+ */
+class IndexEntry
+{
+public:
+    IndexEntry(
+        boost::uint64_t step = 0,
+        boost::uint64_t member = 0,
+        boost::uint64_t brick = 0,
+        boost::uint64_t offset = 0,
+        boost::uint64_t size = 0,
+        boost::uint64_t rawSize = 0) :
+        step(step),
+        member(member),
+        brick(brick),
+        offset(offset),
+        size(size),
+        rawSize(rawSize)
+    {}
+
+    bool operator<(const IndexEntry& other) const
+    {
+        if (step != other.step) {
+            return step < other.step;
+        }
+        if (member != other.member) {
+            return member < other.member;
+        }
+        return brick < other.brick;
+    }
+
+    boost::uint64_t step;
+    boost::uint64_t member;
+    boost::uint64_t brick;
+    boost::uint64_t offset;
+    boost::uint64_t size;
+    boost::uint64_t rawSize;
+};
+
+/**
+ * Simple, fast codec: byte shuffling (grouping the k-th bytes of all
+ * elements) makes smooth fields compressible, an LZ77-style pass with
+ * a hash table of recent 4-byte sequences then removes repetitions.
+ */
+class Codec
+{
+public:
+    static void shuffle(const char *source, std::size_t elements, std::size_t elementSize, char *target)
+    {
+        for (std::size_t i = 0; i < elements; ++i) {
+            for (std::size_t b = 0; b < elementSize; ++b) {
+                target[b * elements + i] = source[i * elementSize + b];
+            }
+        }
+    }
+
+    static void unshuffle(const char *source, std::size_t elements, std::size_t elementSize, char *target)
+    {
+        for (std::size_t i = 0; i < elements; ++i) {
+            for (std::size_t b = 0; b < elementSize; ++b) {
+                target[i * elementSize + b] = source[b * elements + i];
+            }
+        }
+    }
+
+    /**
+     * The compressed stream is a sequence of tokens (literal count,
+     * literals, match length, match distance), a match length of 0
+     * terminates it.
+     */
+    static void compress(const std::vector<char>& source, std::vector<char> *target)
+    {
+        const std::size_t hashSize = 1 << 14;
+        std::vector<long> table(hashSize, -1);
+        std::size_t size = source.size();
+        std::size_t anchor = 0;
+        std::size_t pos = 0;
+        target->clear();
+
+        while (pos + 4 <= size) {
+            boost::uint32_t sequence;
+            std::memcpy(&sequence, &source[pos], 4);
+            std::size_t hash = (sequence * 2654435761u) >> 18;
+            long candidate = table[hash];
+            table[hash] = pos;
+
+            if ((candidate < 0) || (std::memcmp(&source[candidate], &source[pos], 4) != 0)) {
+                ++pos;
+                continue;
+            }
+
+            std::size_t length = 4;
+            while ((pos + length < size) && (source[candidate + length] == source[pos + length])) {
+                ++length;
+            }
+
+            putVarint(pos - anchor, target);
+            target->insert(target->end(), source.begin() + anchor, source.begin() + pos);
+            putVarint(length, target);
+            putVarint(pos - candidate, target);
+            pos += length;
+            anchor = pos;
+        }
+
+        putVarint(size - anchor, target);
+        target->insert(target->end(), source.begin() + anchor, source.end());
+        putVarint(0, target);
+    }
+
+    static void decompress(const char *source, std::size_t size, std::size_t rawSize, std::vector<char> *target)
+    {
+        target->clear();
+        target->reserve(rawSize);
+        const char *end = source + size;
+
+        for (;;) {
+            std::size_t literals = getVarint(&source, end);
+            if ((std::size_t(end - source) < literals) || (target->size() + literals > rawSize)) {
+                throw IOException("corrupt chunk in time series file");
+            }
+            target->insert(target->end(), source, source + literals);
+            source += literals;
+
+            std::size_t length = getVarint(&source, end);
+            if (length == 0) {
+                break;
+            }
+            std::size_t distance = getVarint(&source, end);
+            if ((distance == 0) || (distance > target->size()) || (target->size() + length > rawSize)) {
+                throw IOException("corrupt chunk in time series file");
+            }
+
+            // byte-wise as source and target of a match may overlap:
+            std::size_t from = target->size() - distance;
+            for (std::size_t i = 0; i < length; ++i) {
+                target->push_back((*target)[from + i]);
+            }
+        }
+
+        if (target->size() != rawSize) {
+            throw IOException("corrupt chunk in time series file");
+        }
+    }
+
+private:
+    static void putVarint(std::size_t value, std::vector<char> *target)
+    {
+        while (value >= 0x80) {
+            target->push_back(char((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        target->push_back(char(value));
+    }
+
+    static std::size_t getVarint(const char **source, const char *end)
+    {
+        std::size_t ret = 0;
+        for (int shift = 0; ; shift += 7) {
+            if ((*source == end) || (shift > 56)) {
+                throw IOException("corrupt chunk in time series file");
+            }
+            unsigned char byte = **source;
+            ++*source;
+            ret |= std::size_t(byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                return ret;
+            }
+        }
+    }
+};
+
+/**
+ * Maps coordinates to the bricks which make up the chunks.
+ */
+template<int DIM>
+class Bricks
+{
+public:
+    Bricks(const Coord<DIM>& gridDimensions, const Coord<DIM>& brickDimensions) :
+        brickDimensions(brickDimensions)
+    {
+        for (int d = 0; d < DIM; ++d) {
+            if (brickDimensions[d] < 1) {
+                throw std::invalid_argument("brick dimensions must be positive");
+            }
+            numBricks[d] = (gridDimensions[d] + brickDimensions[d] - 1) / brickDimensions[d];
+        }
+    }
+
+    /**
+     * Yields the IDs and boxes of all bricks which intersect box.
+     */
+    void intersecting(
+        const CoordBox<DIM>& box,
+        std::vector<boost::uint64_t> *ids,
+        std::vector<CoordBox<DIM> > *boxes) const
+    {
+        Coord<DIM> first;
+        Coord<DIM> count;
+        for (int d = 0; d < DIM; ++d) {
+            int lower = std::max(box.origin[d], 0);
+            int upper = std::min(box.origin[d] + box.dimensions[d], numBricks[d] * brickDimensions[d]);
+            if (upper <= lower) {
+                return;
+            }
+            first[d] = lower / brickDimensions[d];
+            count[d] = (upper - 1) / brickDimensions[d] - first[d] + 1;
+        }
+
+        CoordBox<DIM> brickRange(first, count);
+        for (typename CoordBox<DIM>::Iterator i = brickRange.begin(); i != brickRange.end(); ++i) {
+            boost::uint64_t id = 0;
+            for (int d = DIM - 1; d >= 0; --d) {
+                id = id * numBricks[d] + (*i)[d];
+            }
+            *ids << id;
+            *boxes << CoordBox<DIM>(i->scale(brickDimensions), brickDimensions);
+        }
+    }
+
+private:
+    Coord<DIM> brickDimensions;
+    Coord<DIM> numBricks;
+};
+
+/**
+ * Serializes a chunk: its region followed by the cells' data (shuffled
+ * if compression is enabled). Compression is applied only if it
+ * actually saves space.
+ */
+template<int DIM>
+void encodeChunk(
+    const Region<DIM>& region,
+    const std::vector<char>& data,
+    std::size_t elementSize,
+    bool compress,
+    std::vector<char> *raw,
+    std::vector<char> *encoded)
+{
+    boost::int32_t numStreaks = region.numStreaks();
+    std::vector<boost::int32_t> streaks;
+    streaks.reserve(numStreaks * (DIM + 1));
+    for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+        for (int d = 0; d < DIM; ++d) {
+            streaks << i->origin[d];
+        }
+        streaks << i->endX;
+    }
+
+    std::size_t headerSize = sizeof(boost::int32_t) * (1 + streaks.size());
+    raw->resize(headerSize + data.size());
+    std::memcpy(&(*raw)[0], &numStreaks, sizeof(boost::int32_t));
+    if (!streaks.empty()) {
+        std::memcpy(&(*raw)[sizeof(boost::int32_t)], &streaks[0], sizeof(boost::int32_t) * streaks.size());
+    }
+
+    if (data.empty()) {
+        *encoded = *raw;
+        return;
+    }
+
+    if (!compress) {
+        std::copy(data.begin(), data.end(), raw->begin() + headerSize);
+        *encoded = *raw;
+        return;
+    }
+
+    Codec::shuffle(&data[0], data.size() / elementSize, elementSize, &(*raw)[headerSize]);
+    Codec::compress(*raw, encoded);
+    if (encoded->size() >= raw->size()) {
+        *encoded = *raw;
+    }
+}
+
+/**
+ * Inverse of encodeChunk(): yields the chunk's region and data (in
+ * region order, elementSize bytes per cell).
+ */
+template<int DIM>
+void decodeChunk(
+    const std::vector<char>& encoded,
+    std::size_t rawSize,
+    std::size_t elementSize,
+    bool compressed,
+    Region<DIM> *region,
+    std::vector<char> *data)
+{
+    std::vector<char> buffer;
+    const std::vector<char> *raw = &encoded;
+    if (encoded.size() < rawSize) {
+        Codec::decompress(&encoded[0], encoded.size(), rawSize, &buffer);
+        raw = &buffer;
+    }
+
+    boost::int32_t numStreaks;
+    if (raw->size() < sizeof(boost::int32_t)) {
+        throw IOException("corrupt chunk in time series file");
+    }
+    std::memcpy(&numStreaks, &(*raw)[0], sizeof(boost::int32_t));
+    std::size_t headerSize = sizeof(boost::int32_t) * (1 + numStreaks * (DIM + 1));
+    if (raw->size() < headerSize) {
+        throw IOException("corrupt chunk in time series file");
+    }
+
+    std::vector<boost::int32_t> streaks(numStreaks * (DIM + 1));
+    if (!streaks.empty()) {
+        std::memcpy(&streaks[0], &(*raw)[sizeof(boost::int32_t)], sizeof(boost::int32_t) * streaks.size());
+    }
+
+    region->clear();
+    for (int i = 0; i < numStreaks; ++i) {
+        Streak<DIM> streak;
+        for (int d = 0; d < DIM; ++d) {
+            streak.origin[d] = streaks[i * (DIM + 1) + d];
+        }
+        streak.endX = streaks[i * (DIM + 1) + DIM];
+        *region << streak;
+    }
+
+    std::size_t dataSize = raw->size() - headerSize;
+    if (dataSize != region->size() * elementSize) {
+        throw IOException("corrupt chunk in time series file");
+    }
+
+    data->resize(dataSize);
+    if (dataSize == 0) {
+        return;
+    }
+    if (compressed) {
+        Codec::unshuffle(&(*raw)[headerSize], dataSize / elementSize, elementSize, &(*data)[0]);
+    } else {
+        std::copy(raw->begin() + headerSize, raw->end(), data->begin());
+    }
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef LIBGEODECOMP_IO_TIMESERIESINITIALIZER_H
+#define LIBGEODECOMP_IO_TIMESERIESINITIALIZER_H
+
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/io/timeseriesreader.h>
+#include <libgeodecomp/storage/selector.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Sets up a simulation from one step of a file written by
+ * TimeSeriesWriter. Each process only reads the chunks which
+ * intersect its part of the grid. Cells start out as copies of the
+ * prototype, the selected members are then overwritten with the
+ * stored values. Coordinates beyond the stored grid (e.g. ghost
+ * zones on periodic topologies) retain the prototype's values.
+ */
+template<typename CELL_TYPE>
+class TimeSeriesInitializer : public Initializer<CELL_TYPE>
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+
+    TimeSeriesInitializer(
+        const std::string& filename,
+        const std::vector<Selector<CELL_TYPE> >& selectors,
+        unsigned step,
+        unsigned maxSteps,
+        const CELL_TYPE& prototype = CELL_TYPE()) :
+        reader(filename),
+        selectors(selectors),
+        step(step),
+        maximumSteps(maxSteps),
+        prototype(prototype)
+    {
+        if (std::find(reader.steps().begin(), reader.steps().end(), step) == reader.steps().end()) {
+            throw std::invalid_argument("requested step not found in " + filename);
+        }
+    }
+
+    virtual void grid(GridBase<CELL_TYPE, DIM> *target)
+    {
+        initEdge(target);
+        Region<DIM> region;
+        region << target->boundingBox();
+        initRegion(target, region);
+    }
+
+    virtual bool supportsParallelInit() const
+    {
+        return true;
+    }
+
+    virtual void initRegion(GridBase<CELL_TYPE, DIM> *target, const Region<DIM>& region)
+    {
+        std::vector<CELL_TYPE> buffer;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            buffer.assign(i->length(), prototype);
+            target->set(*i, &buffer[0]);
+        }
+
+        for (std::size_t i = 0; i < selectors.size(); ++i) {
+            reader.read(target, selectors[i], step, region);
+        }
+    }
+
+    virtual void initEdge(GridBase<CELL_TYPE, DIM> *target)
+    {
+        target->setEdge(prototype);
+    }
+
+    virtual Coord<DIM> gridDimensions() const
+    {
+        return reader.gridDimensions();
+    }
+
+    virtual unsigned startStep() const
+    {
+        return step;
+    }
+
+    virtual unsigned maxSteps() const
+    {
+        return maximumSteps;
+    }
+
+private:
+    TimeSeriesReader<DIM> reader;
+    std::vector<Selector<CELL_TYPE> > selectors;
+    unsigned step;
+    unsigned maximumSteps;
+    CELL_TYPE prototype;
+};
+
+}
+
+#endif
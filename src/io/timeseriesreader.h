@@ -0,0 +1,323 @@
+#ifndef LIBGEODECOMP_IO_TIMESERIESREADER_H
+#define LIBGEODECOMP_IO_TIMESERIESREADER_H
+
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/io/timeseriesformat.h>
+#include <libgeodecomp/storage/gridbase.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <fstream>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+namespace TimeSeriesReaderHelpers {
+
+/**
+ * Stores decoded data in a single member of the target's cells.
+ */
+template<typename CELL, int DIM>
+class MemberLoader
+{
+public:
+    MemberLoader(GridBase<CELL, DIM> *target, const Selector<CELL>& selector) :
+        target(target),
+        selector(selector)
+    {}
+
+    void operator()(const char *data, const Region<DIM>& region)
+    {
+        target->loadMemberUnchecked(data, MemoryLocation::HOST, selector, region);
+    }
+
+private:
+    GridBase<CELL, DIM> *target;
+    const Selector<CELL>& selector;
+};
+
+/**
+ * Stores decoded data as whole cells.
+ */
+template<typename CELL, int DIM>
+class CellLoader
+{
+public:
+    explicit CellLoader(GridBase<CELL, DIM> *target) :
+        target(target)
+    {}
+
+    void operator()(const char *data, const Region<DIM>& region)
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            buffer.resize(i->length());
+            std::memcpy(&buffer[0], data, i->length() * sizeof(CELL));
+            target->set(*i, &buffer[0]);
+            data += i->length() * sizeof(CELL);
+        }
+    }
+
+private:
+    GridBase<CELL, DIM> *target;
+    std::vector<CELL> buffer;
+};
+
+}
+
+/**
+ * Random access to files written by TimeSeriesWriter: any sub-box of
+ * any stored step can be loaded, only chunks which intersect it are
+ * read and decompressed. The index is kept in memory. read() opens
+ * its own stream and is const, so it may be called concurrently.
+ */
+template<int DIM>
+class TimeSeriesReader
+{
+public:
+    typedef TimeSeriesFormat::IndexEntry IndexEntry;
+
+    explicit TimeSeriesReader(const std::string& filename) :
+        filename(filename)
+    {
+        std::ifstream file(filename.c_str(), std::ios::binary);
+        if (!file) {
+            throw FileOpenException(filename);
+        }
+
+        file.seekg(0, std::ios::end);
+        boost::uint64_t fileSize = file.tellg();
+        if (fileSize < TimeSeriesFormat::PREAMBLE_LENGTH + TimeSeriesFormat::TRAILER_LENGTH) {
+            throw FileReadException(filename);
+        }
+
+        std::vector<char> trailer = readBytes(
+            file,
+            fileSize - TimeSeriesFormat::TRAILER_LENGTH,
+            TimeSeriesFormat::TRAILER_LENGTH);
+        std::size_t offset = 0;
+        boost::uint64_t indexOffset = TimeSeriesFormat::extract<boost::uint64_t>(trailer, &offset);
+        if (!checkMagic(trailer, offset) || (indexOffset > fileSize - TimeSeriesFormat::TRAILER_LENGTH)) {
+            throw FileReadException(filename);
+        }
+
+        std::vector<char> preamble = readBytes(file, 0, TimeSeriesFormat::PREAMBLE_LENGTH);
+        offset = TimeSeriesFormat::MAGIC_LENGTH;
+        if (!checkMagic(preamble, 0) ||
+            (TimeSeriesFormat::extract<boost::uint32_t>(preamble, &offset) != TimeSeriesFormat::BYTE_ORDER_MARK)) {
+            throw FileReadException(filename);
+        }
+        boost::uint64_t headerLength = TimeSeriesFormat::extract<boost::uint64_t>(preamble, &offset);
+        if ((headerLength < TimeSeriesFormat::PREAMBLE_LENGTH) || (headerLength > indexOffset)) {
+            throw FileReadException(filename);
+        }
+        header.parse(readBytes(
+                         file,
+                         TimeSeriesFormat::PREAMBLE_LENGTH,
+                         headerLength - TimeSeriesFormat::PREAMBLE_LENGTH));
+
+        std::size_t indexBytes = fileSize - TimeSeriesFormat::TRAILER_LENGTH - indexOffset;
+        index.resize(indexBytes / sizeof(IndexEntry));
+        if (!index.empty()) {
+            file.seekg(indexOffset);
+            file.read(reinterpret_cast<char*>(&index[0]), index.size() * sizeof(IndexEntry));
+            if (!file) {
+                throw FileReadException(filename);
+            }
+        }
+        std::sort(index.begin(), index.end());
+
+        for (std::size_t i = 0; i < index.size(); ++i) {
+            if (stepList.empty() || (stepList.back() != index[i].step)) {
+                stepList << unsigned(index[i].step);
+            }
+        }
+    }
+
+    const Coord<DIM>& gridDimensions() const
+    {
+        return header.gridDimensions;
+    }
+
+    const Coord<DIM>& brickDimensions() const
+    {
+        return header.brickDimensions;
+    }
+
+    const std::vector<std::string>& memberNames() const
+    {
+        return header.names;
+    }
+
+    /**
+     * All steps stored in the file, in ascending order.
+     */
+    const std::vector<unsigned>& steps() const
+    {
+        return stepList;
+    }
+
+    /**
+     * Loads the member identified by selector's name for all cells
+     * of region from the given step into target. Cells of region for
+     * which the file holds no data are left untouched.
+     */
+    template<typename CELL>
+    void read(
+        GridBase<CELL, DIM> *target,
+        const Selector<CELL>& selector,
+        unsigned step,
+        const Region<DIM>& region) const
+    {
+        std::size_t member = findMember(selector.name(), selector.sizeOfExternal());
+        TimeSeriesReaderHelpers::MemberLoader<CELL, DIM> loader(target, selector);
+        readChunks(member, step, region, loader);
+    }
+
+    /**
+     * Same as read(), but for members which hold whole cells, as
+     * written by CheckpointWriter. This requires CELL to be
+     * trivially copyable.
+     */
+    template<typename CELL>
+    void readCells(
+        GridBase<CELL, DIM> *target,
+        const std::string& memberName,
+        unsigned step,
+        const Region<DIM>& region) const
+    {
+        std::size_t member = findMember(memberName, sizeof(CELL));
+        TimeSeriesReaderHelpers::CellLoader<CELL, DIM> loader(target);
+        readChunks(member, step, region, loader);
+    }
+
+private:
+    std::string filename;
+    TimeSeriesFormat::Header<DIM> header;
+    std::vector<IndexEntry> index;
+    std::vector<unsigned> stepList;
+
+    std::size_t findMember(const std::string& name, std::size_t elementSize) const
+    {
+        std::vector<std::string>::const_iterator i =
+            std::find(header.names.begin(), header.names.end(), name);
+        if (i == header.names.end()) {
+            throw std::invalid_argument("member " + name + " not found in " + filename);
+        }
+
+        std::size_t member = i - header.names.begin();
+        if (header.elementSizes[member] != elementSize) {
+            throw std::invalid_argument("size of member " + name + " doesn't match " + filename);
+        }
+
+        return member;
+    }
+
+    template<typename LOADER>
+    void readChunks(std::size_t member, unsigned step, const Region<DIM>& region, LOADER& loader) const
+    {
+        std::size_t elementSize = header.elementSizes[member];
+        if (region.empty()) {
+            return;
+        }
+
+        std::ifstream file(filename.c_str(), std::ios::binary);
+        if (!file) {
+            throw FileOpenException(filename);
+        }
+
+        TimeSeriesFormat::Bricks<DIM> bricks(header.gridDimensions, header.brickDimensions);
+        std::vector<boost::uint64_t> brickIDs;
+        std::vector<CoordBox<DIM> > brickBoxes;
+        bricks.intersecting(region.boundingBox(), &brickIDs, &brickBoxes);
+
+        Region<DIM> chunkRegion;
+        std::vector<char> data;
+
+        for (std::size_t i = 0; i < brickIDs.size(); ++i) {
+            Region<DIM> brickRegion;
+            brickRegion << brickBoxes[i];
+            if ((region & brickRegion).empty()) {
+                continue;
+            }
+
+            std::pair<typename std::vector<IndexEntry>::const_iterator,
+                      typename std::vector<IndexEntry>::const_iterator> range =
+                std::equal_range(index.begin(), index.end(), IndexEntry(step, member, brickIDs[i]));
+
+            for (typename std::vector<IndexEntry>::const_iterator entry = range.first;
+                 entry != range.second;
+                 ++entry) {
+                std::vector<char> encoded = readBytes(file, entry->offset, entry->size);
+                TimeSeriesFormat::decodeChunk(
+                    encoded, entry->rawSize, elementSize, header.compressed, &chunkRegion, &data);
+                load(loader, region, chunkRegion, data, elementSize);
+            }
+        }
+    }
+
+    /**
+     * Passes those cells of a decoded chunk which lie within region
+     * on to the loader. Whole chunks are handed over in one go,
+     * otherwise we proceed streak by streak.
+     */
+    template<typename LOADER>
+    static void load(
+        LOADER& loader,
+        const Region<DIM>& region,
+        const Region<DIM>& chunkRegion,
+        const std::vector<char>& data,
+        std::size_t elementSize)
+    {
+        Region<DIM> overlap = chunkRegion & region;
+        if (overlap.empty()) {
+            return;
+        }
+        if (overlap.size() == chunkRegion.size()) {
+            loader(&data[0], chunkRegion);
+            return;
+        }
+
+        std::size_t offset = 0;
+        for (typename Region<DIM>::StreakIterator i = chunkRegion.beginStreak();
+             i != chunkRegion.endStreak();
+             ++i) {
+            Region<DIM> streakRegion;
+            streakRegion << *i;
+            Region<DIM> parts = streakRegion & region;
+
+            for (typename Region<DIM>::StreakIterator j = parts.beginStreak(); j != parts.endStreak(); ++j) {
+                Region<DIM> part;
+                part << *j;
+                std::size_t partOffset = offset + (j->origin.x() - i->origin.x()) * elementSize;
+                loader(&data[partOffset], part);
+            }
+
+            offset += i->length() * elementSize;
+        }
+    }
+
+    static bool checkMagic(const std::vector<char>& buffer, std::size_t offset)
+    {
+        return std::equal(
+            buffer.begin() + offset,
+            buffer.begin() + offset + TimeSeriesFormat::MAGIC_LENGTH,
+            TimeSeriesFormat::magic());
+    }
+
+    std::vector<char> readBytes(std::ifstream& file, boost::uint64_t offset, std::size_t length) const
+    {
+        std::vector<char> buffer(length);
+        file.seekg(offset);
+        if (length > 0) {
+            file.read(&buffer[0], length);
+        }
+        if (!file) {
+            throw FileReadException(filename);
+        }
+
+        return buffer;
+    }
+};
+
+}
+
+#endif
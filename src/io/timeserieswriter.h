@@ -0,0 +1,360 @@
+#ifndef LIBGEODECOMP_IO_TIMESERIESWRITER_H
+#define LIBGEODECOMP_IO_TIMESERIESWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/io/timeseriesformat.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+namespace TimeSeriesWriterHelpers {
+
+/**
+ * A file in TimeSeriesFormat which all ranks of a communicator append
+ * chunks to. Each append() is a single collective write, the offsets
+ * of the ranks' data are derived from a prefix sum. The index is
+ * gathered on rank 0 and written on close().
+ */
+class ChunkFile
+{
+public:
+    typedef TimeSeriesFormat::IndexEntry IndexEntry;
+
+    ChunkFile() :
+        fileOpen(false),
+        dataEnd(0)
+    {}
+
+    /**
+     * Collectively creates the file, rank 0 writes the (serialized)
+     * header.
+     */
+    void open(const std::string& newFilename, const std::vector<char>& header, MPI_Comm newComm)
+    {
+        filename = newFilename;
+        comm = newComm;
+        int error = MPI_File_open(
+            comm, const_cast<char*>(filename.c_str()),
+            MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+            &file);
+        if (error != MPI_SUCCESS) {
+            throw FileOpenException(filename);
+        }
+        // drop stale contents from previous runs:
+        MPI_File_set_size(file, 0);
+
+        if (MPILayer(comm).rank() == 0) {
+            MPI_File_write_at(
+                file, 0, const_cast<char*>(&header[0]), header.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+        }
+
+        fileOpen = true;
+        dataEnd = header.size();
+        localIndex.clear();
+    }
+
+    /**
+     * Appends this rank's chunks. Offsets in entries are expected to
+     * be relative to the start of chunks. Both buffers are cleared
+     * afterwards.
+     */
+    void append(std::vector<char> *chunks, std::vector<IndexEntry> *entries)
+    {
+        unsigned long long localSize = chunks->size();
+        unsigned long long localOffset = 0;
+        unsigned long long totalSize = 0;
+        MPI_Exscan(&localSize, &localOffset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+        MPI_Allreduce(&localSize, &totalSize, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+        if (MPILayer(comm).rank() == 0) {
+            // MPI_Exscan leaves the receive buffer undefined on rank 0
+            localOffset = 0;
+        }
+
+        boost::uint64_t base = dataEnd + localOffset;
+        char *data = chunks->empty() ? 0 : &(*chunks)[0];
+        MPI_File_write_at_all(file, base, data, chunks->size(), MPI_CHAR, MPI_STATUS_IGNORE);
+
+        for (std::size_t i = 0; i < entries->size(); ++i) {
+            (*entries)[i].offset += base;
+            localIndex << (*entries)[i];
+        }
+
+        dataEnd += totalSize;
+        chunks->clear();
+        entries->clear();
+    }
+
+    /**
+     * Gathers the index on rank 0, which appends it, followed by the
+     * trailer, to the file.
+     */
+    void close()
+    {
+        MPILayer mpiLayer(comm);
+        int localBytes = localIndex.size() * sizeof(IndexEntry);
+        std::vector<int> lengths = mpiLayer.gather(localBytes, 0);
+
+        std::vector<char> indexBuffer;
+        if (mpiLayer.rank() == 0) {
+            int totalBytes = 0;
+            for (std::size_t i = 0; i < lengths.size(); ++i) {
+                totalBytes += lengths[i];
+            }
+            indexBuffer.resize(totalBytes);
+        }
+
+        const char *localData = localIndex.empty() ? 0 : reinterpret_cast<const char*>(&localIndex[0]);
+        char *indexData = indexBuffer.empty() ? 0 : &indexBuffer[0];
+        mpiLayer.gatherV(localData, localBytes, lengths, 0, indexData, MPI_CHAR);
+
+        if (mpiLayer.rank() == 0) {
+            std::vector<IndexEntry> index(indexBuffer.size() / sizeof(IndexEntry));
+            if (!index.empty()) {
+                std::memcpy(&index[0], &indexBuffer[0], indexBuffer.size());
+            }
+            std::sort(index.begin(), index.end());
+
+            std::vector<char> buffer;
+            for (std::size_t i = 0; i < index.size(); ++i) {
+                TimeSeriesFormat::append(&buffer, index[i]);
+            }
+            TimeSeriesFormat::append(&buffer, dataEnd);
+            buffer.insert(
+                buffer.end(),
+                TimeSeriesFormat::magic(),
+                TimeSeriesFormat::magic() + TimeSeriesFormat::MAGIC_LENGTH);
+
+            MPI_File_write_at(file, dataEnd, &buffer[0], buffer.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+        }
+
+        MPI_File_close(&file);
+        fileOpen = false;
+        localIndex.clear();
+    }
+
+    bool isOpen() const
+    {
+        return fileOpen;
+    }
+
+private:
+    std::string filename;
+    MPI_Comm comm;
+    MPI_File file;
+    bool fileOpen;
+    boost::uint64_t dataEnd;
+    std::vector<IndexEntry> localIndex;
+};
+
+}
+
+/**
+ * Appends multiple time steps of multiple members (see Selector) to
+ * a single file (see TimeSeriesFormat). Unlike BOVWriter, which
+ * creates two files per step and member, this keeps the file count
+ * low and allows readers (TimeSeriesReader, TimeSeriesInitializer)
+ * to fetch arbitrary sub-boxes of any step without touching the rest
+ * of the file.
+ *
+ * Each rank compresses its chunks locally, the actual I/O is a
+ * single collective write per step. If stepsPerFile is positive, a
+ * new file is started every stepsPerFile output steps. File names are
+ * derived from the prefix and the first step stored within.
+ */
+template<typename CELL_TYPE>
+class TimeSeriesWriter : public Clonable<ParallelWriter<CELL_TYPE>, TimeSeriesWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef TimeSeriesFormat::IndexEntry IndexEntry;
+
+    using ParallelWriter<CELL_TYPE>::period;
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * Chunks will cover boxes of brickDimensions cells. Readers will
+     * read whole chunks, so smaller bricks speed up the retrieval of
+     * small boxes, larger ones improve compression and shrink the
+     * index. An empty brickDimensions selects a single brick which
+     * spans the whole grid.
+     */
+    TimeSeriesWriter(
+        const Selector<CELL_TYPE>& selector,
+        const std::string& prefix,
+        const unsigned period,
+        const Coord<DIM>& brickDimensions = Coord<DIM>(),
+        const unsigned stepsPerFile = 0,
+        const bool compress = true,
+        const MPI_Comm& communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL_TYPE>, TimeSeriesWriter<CELL_TYPE> >(prefix, period),
+        brickDimensions(brickDimensions),
+        stepsPerFile(stepsPerFile),
+        compress(compress),
+        comm(communicator),
+        stepsInFile(0),
+        lastStep(0),
+        haveLastStep(false),
+        stepBoundary(true),
+        skipStep(false)
+    {
+        addSelector(selector);
+    }
+
+    void addSelector(const Selector<CELL_TYPE>& selector)
+    {
+        if (file.isOpen()) {
+            throw std::logic_error("cannot add members after TimeSeriesWriter has started writing");
+        }
+
+        selectors << selector;
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        if (stepBoundary) {
+            stepBoundary = false;
+            // Simulators report the final step twice (STEP_FINISHED
+            // and ALL_DONE), but it needs to be stored only once:
+            skipStep = haveLastStep && (step == lastStep);
+
+            if (!skipStep) {
+                if (file.isOpen() && (stepsPerFile > 0) && (stepsInFile >= stepsPerFile)) {
+                    file.close();
+                }
+                if (!file.isOpen()) {
+                    openFile(step, globalDimensions);
+                }
+            }
+        }
+
+        if (!skipStep) {
+            encode(grid, validRegion, step);
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        stepBoundary = true;
+        if (!skipStep) {
+            file.append(&pending, &pendingEntries);
+            ++stepsInFile;
+            lastStep = step;
+            haveLastStep = true;
+        }
+
+        if ((event == WRITER_ALL_DONE) && file.isOpen()) {
+            file.close();
+        }
+    }
+
+    std::string filename(unsigned firstStep) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "." << std::setfill('0') << std::setw(5) << firstStep << ".lgdts";
+        return buf.str();
+    }
+
+private:
+    std::vector<Selector<CELL_TYPE> > selectors;
+    Coord<DIM> brickDimensions;
+    unsigned stepsPerFile;
+    bool compress;
+    MPI_Comm comm;
+    TimeSeriesWriterHelpers::ChunkFile file;
+    unsigned stepsInFile;
+    unsigned lastStep;
+    bool haveLastStep;
+    bool stepBoundary;
+    bool skipStep;
+    boost::shared_ptr<TimeSeriesFormat::Bricks<DIM> > bricks;
+    std::vector<char> pending;
+    std::vector<IndexEntry> pendingEntries;
+
+    void openFile(unsigned step, const Coord<DIM>& globalDimensions)
+    {
+        TimeSeriesFormat::Header<DIM> header;
+        header.gridDimensions = globalDimensions;
+        header.brickDimensions = brickDimensions;
+        for (int d = 0; d < DIM; ++d) {
+            if (header.brickDimensions[d] == 0) {
+                header.brickDimensions[d] = globalDimensions[d];
+            }
+        }
+        header.compressed = compress;
+        for (std::size_t i = 0; i < selectors.size(); ++i) {
+            header.names << selectors[i].name();
+            header.elementSizes << selectors[i].sizeOfExternal();
+        }
+        bricks.reset(new TimeSeriesFormat::Bricks<DIM>(globalDimensions, header.brickDimensions));
+
+        std::vector<char> buffer;
+        header.serialize(&buffer);
+
+        file.open(filename(step), buffer, comm);
+        stepsInFile = 0;
+    }
+
+    void encode(const GridType& grid, const Region<DIM>& validRegion, unsigned step)
+    {
+        if (validRegion.empty()) {
+            return;
+        }
+
+        std::vector<boost::uint64_t> brickIDs;
+        std::vector<CoordBox<DIM> > brickBoxes;
+        bricks->intersecting(validRegion.boundingBox(), &brickIDs, &brickBoxes);
+
+        std::vector<char> data;
+        std::vector<char> raw;
+        std::vector<char> encoded;
+
+        for (std::size_t i = 0; i < brickIDs.size(); ++i) {
+            Region<DIM> brickRegion;
+            brickRegion << brickBoxes[i];
+            Region<DIM> piece = validRegion & brickRegion;
+            if (piece.empty()) {
+                continue;
+            }
+
+            for (std::size_t m = 0; m < selectors.size(); ++m) {
+                std::size_t elementSize = selectors[m].sizeOfExternal();
+                data.resize(piece.size() * elementSize);
+                grid.saveMemberUnchecked(&data[0], MemoryLocation::HOST, selectors[m], piece);
+                TimeSeriesFormat::encodeChunk(piece, data, elementSize, compress, &raw, &encoded);
+
+                pendingEntries << IndexEntry(step, m, brickIDs[i], pending.size(), encoded.size(), raw.size());
+                pending.insert(pending.end(), encoded.begin(), encoded.end());
+            }
+        }
+    }
+};
+
+}
+
+#endif
+#endif
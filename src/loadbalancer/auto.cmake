@@ -0,0 +1,16 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}biasbalancer.cpp
+  ${RELATIVE_PATH}mockbalancer.cpp
+  ${RELATIVE_PATH}oozebalancer.cpp
+  ${RELATIVE_PATH}randombalancer.cpp
+  ${RELATIVE_PATH}tracingbalancer.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}biasbalancer.h
+  ${RELATIVE_PATH}loadbalancer.h
+  ${RELATIVE_PATH}mockbalancer.h
+  ${RELATIVE_PATH}noopbalancer.h
+  ${RELATIVE_PATH}oozebalancer.h
+  ${RELATIVE_PATH}randombalancer.h
+  ${RELATIVE_PATH}tracingbalancer.h
+)
@@ -0,0 +1,6 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}oozebalancertest.h
+  ${RELATIVE_PATH}tracingbalancertest.h
+)
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_NoOpBalancerTest_init = false;
+#include "/root/repo/src/loadbalancer/test/unit/noopbalancertest.h"
+
+static NoOpBalancerTest suite_NoOpBalancerTest;
+
+static CxxTest::List Tests_NoOpBalancerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_NoOpBalancerTest( "/root/repo/src/loadbalancer/test/unit/noopbalancertest.h", 8, "NoOpBalancerTest", suite_NoOpBalancerTest, Tests_NoOpBalancerTest );
+
+static class TestDescription_suite_NoOpBalancerTest_testEcho : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NoOpBalancerTest_testEcho() : CxxTest::RealTestDescription( Tests_NoOpBalancerTest, suiteDescription_NoOpBalancerTest, 12, "testEcho" ) {}
+ void runTest() { suite_NoOpBalancerTest.testEcho(); }
+} testDescription_suite_NoOpBalancerTest_testEcho;
+
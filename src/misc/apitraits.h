@@ -288,6 +288,116 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    /**
+     * Check whether the cell asks monolithic Simulators to store the
+     * grid in bricks (see BrickedGrid).
+     */
+    template<typename CELL, typename HAS_BRICKED_GRID = void>
+    class SelectBrickedGrid
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectBrickedGrid<CELL, typename CELL::API::SupportsBrickedGrid>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Use this qualifier in a cell's API to request a bricked memory
+     * layout, which may improve cache and TLB hit rates for 3D
+     * stencils with a large reach along the Y and Z axes. It's
+     * ignored for cells which rely on contiguous rows (i.e. SoA and
+     * FixedCoordsOnlyUpdate).
+     */
+    class HasBrickedGrid
+    {
+    public:
+        typedef void SupportsBrickedGrid;
+    };
+
+    /**
+     * Check whether the cell asks monolithic Simulators to allocate
+     * only those bricks which hold active cells (see
+     * SparseBrickedGrid).
+     */
+    template<typename CELL, typename HAS_SPARSE_BRICKED_GRID = void>
+    class SelectSparseBrickedGrid
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectSparseBrickedGrid<CELL, typename CELL::API::SupportsSparseBrickedGrid>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Cells which use this qualifier need to provide a member
+     *
+     *   bool isActive() const
+     *
+     * Inactive cells need to be equivalent to the default cell and
+     * must stay inactive as long as their neighborhood is inactive.
+     * Memory is then only allocated for bricks of active cells and
+     * only these are updated, which pays off for domains which are
+     * mostly "dead" (e.g. obstacles or dry land). Like
+     * HasBrickedGrid it's ignored for SoA and FixedCoordsOnlyUpdate
+     * cells and takes precedence over HasBrickedGrid.
+     */
+    class HasSparseBrickedGrid
+    {
+    public:
+        typedef void SupportsSparseBrickedGrid;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+    /**
+     * Check whether the cell reports changes so that Simulators may
+     * skip updates of quiescent cells (see ActivityTracker).
+     */
+    template<typename CELL, typename HAS_ACTIVITY_TRACKING = void>
+    class SelectActivityTracking
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectActivityTracking<CELL, typename CELL::API::SupportsActivityTracking>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Cells which use this qualifier need to provide a member
+     *
+     *   bool hasChanged() const
+     *
+     * which tells whether the last update modified the cell. Only
+     * cells within the stencil's radius of changed cells will then be
+     * updated in the next nano step. This requires the update to be a
+     * function of the neighborhood only (i.e. a cell whose
+     * neighborhood didn't change won't change either) and pays off
+     * for models where activity is limited to fronts (e.g. fires or
+     * diffusion fronts).
+     */
+    class HasActivityTracking
+    {
+    public:
+        typedef void SupportsActivityTracking;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     /**
      * Of how many nano steps (intermediate steps) is a whole cell cycle composed?
      */
@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_APITraitsTest_init = false;
+#include "/root/repo/src/misc/test/parallel_mpi_1/apitraitstest.h"
+
+static APITraitsTest suite_APITraitsTest;
+
+static CxxTest::List Tests_APITraitsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_APITraitsTest( "/root/repo/src/misc/test/parallel_mpi_1/apitraitstest.h", 120, "APITraitsTest", suite_APITraitsTest, Tests_APITraitsTest );
+
+static class TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellA() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 153, "testMPIDatatypeSelectionCellA" ) {}
+ void runTest() { suite_APITraitsTest.testMPIDatatypeSelectionCellA(); }
+} testDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellA;
+
+static class TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellB : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellB() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 177, "testMPIDatatypeSelectionCellB" ) {}
+ void runTest() { suite_APITraitsTest.testMPIDatatypeSelectionCellB(); }
+} testDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellB;
+
+static class TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellC : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellC() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 202, "testMPIDatatypeSelectionCellC" ) {}
+ void runTest() { suite_APITraitsTest.testMPIDatatypeSelectionCellC(); }
+} testDescription_suite_APITraitsTest_testMPIDatatypeSelectionCellC;
+
+static class TestDescription_suite_APITraitsTest_testMPIDatatypeCreationWithCellCD : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testMPIDatatypeCreationWithCellCD() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 226, "testMPIDatatypeCreationWithCellCD" ) {}
+ void runTest() { suite_APITraitsTest.testMPIDatatypeCreationWithCellCD(); }
+} testDescription_suite_APITraitsTest_testMPIDatatypeCreationWithCellCD;
+
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ClonableTest_init = false;
+#include "/root/repo/src/misc/test/unit/clonabletest.h"
+
+static ClonableTest suite_ClonableTest;
+
+static CxxTest::List Tests_ClonableTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ClonableTest( "/root/repo/src/misc/test/unit/clonabletest.h", 36, "ClonableTest", suite_ClonableTest, Tests_ClonableTest );
+
+static class TestDescription_suite_ClonableTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ClonableTest_testBasic() : CxxTest::RealTestDescription( Tests_ClonableTest, suiteDescription_ClonableTest, 40, "testBasic" ) {}
+ void runTest() { suite_ClonableTest.testBasic(); }
+} testDescription_suite_ClonableTest_testBasic;
+
@@ -0,0 +1,257 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_GoalFunctionOptimizerTest_init = false;
+#include "/root/repo/src/misc/test/unit/optimizertest.h"
+
+static GoalFunctionOptimizerTest suite_GoalFunctionOptimizerTest;
+
+static CxxTest::List Tests_GoalFunctionOptimizerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GoalFunctionOptimizerTest( "/root/repo/src/misc/test/unit/optimizertest.h", 13, "GoalFunctionOptimizerTest", suite_GoalFunctionOptimizerTest, Tests_GoalFunctionOptimizerTest );
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 32, "testPatternDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testPatternDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testPatternDefault;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 40, "testSimplexDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testSimplexDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testSimplexDefault;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testSimplexChangedStart : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testSimplexChangedStart() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 48, "testSimplexChangedStart" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testSimplexChangedStart(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testSimplexChangedStart;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerPatternDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 58, "testRightUpperCornerPatternDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testRightUpperCornerPatternDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerPatternDefault;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerSimplexDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 74, "testRightUpperCornerSimplexDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testRightUpperCornerSimplexDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testRightUpperCornerSimplexDefault;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerPatternDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 84, "testRightLowerCornerPatternDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testRightLowerCornerPatternDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerPatternDefault;
+
+static class TestDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerSimplexDefault() : CxxTest::RealTestDescription( Tests_GoalFunctionOptimizerTest, suiteDescription_GoalFunctionOptimizerTest, 100, "testRightLowerCornerSimplexDefault" ) {}
+ void runTest() { suite_GoalFunctionOptimizerTest.testRightLowerCornerSimplexDefault(); }
+} testDescription_suite_GoalFunctionOptimizerTest_testRightLowerCornerSimplexDefault;
+
+static ThreeDimFunctionOptimizerTest suite_ThreeDimFunctionOptimizerTest;
+
+static CxxTest::List Tests_ThreeDimFunctionOptimizerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThreeDimFunctionOptimizerTest( "/root/repo/src/misc/test/unit/optimizertest.h", 116, "ThreeDimFunctionOptimizerTest", suite_ThreeDimFunctionOptimizerTest, Tests_ThreeDimFunctionOptimizerTest );
+
+static class TestDescription_suite_ThreeDimFunctionOptimizerTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreeDimFunctionOptimizerTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_ThreeDimFunctionOptimizerTest, suiteDescription_ThreeDimFunctionOptimizerTest, 137, "testPatternDefault" ) {}
+ void runTest() { suite_ThreeDimFunctionOptimizerTest.testPatternDefault(); }
+} testDescription_suite_ThreeDimFunctionOptimizerTest_testPatternDefault;
+
+static class TestDescription_suite_ThreeDimFunctionOptimizerTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreeDimFunctionOptimizerTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_ThreeDimFunctionOptimizerTest, suiteDescription_ThreeDimFunctionOptimizerTest, 145, "testSimplexDefault" ) {}
+ void runTest() { suite_ThreeDimFunctionOptimizerTest.testSimplexDefault(); }
+} testDescription_suite_ThreeDimFunctionOptimizerTest_testSimplexDefault;
+
+static Multimodal2DTest suite_Multimodal2DTest;
+
+static CxxTest::List Tests_Multimodal2DTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Multimodal2DTest( "/root/repo/src/misc/test/unit/optimizertest.h", 157, "Multimodal2DTest", suite_Multimodal2DTest, Tests_Multimodal2DTest );
+
+static class TestDescription_suite_Multimodal2DTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Multimodal2DTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_Multimodal2DTest, suiteDescription_Multimodal2DTest, 176, "testPatternDefault" ) {}
+ void runTest() { suite_Multimodal2DTest.testPatternDefault(); }
+} testDescription_suite_Multimodal2DTest_testPatternDefault;
+
+static class TestDescription_suite_Multimodal2DTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Multimodal2DTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_Multimodal2DTest, suiteDescription_Multimodal2DTest, 184, "testSimplexDefault" ) {}
+ void runTest() { suite_Multimodal2DTest.testSimplexDefault(); }
+} testDescription_suite_Multimodal2DTest_testSimplexDefault;
+
+static class TestDescription_suite_Multimodal2DTest_testSimplexModifiedParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Multimodal2DTest_testSimplexModifiedParameters() : CxxTest::RealTestDescription( Tests_Multimodal2DTest, suiteDescription_Multimodal2DTest, 192, "testSimplexModifiedParameters" ) {}
+ void runTest() { suite_Multimodal2DTest.testSimplexModifiedParameters(); }
+} testDescription_suite_Multimodal2DTest_testSimplexModifiedParameters;
+
+static DiscontinousFunctionTest suite_DiscontinousFunctionTest;
+
+static CxxTest::List Tests_DiscontinousFunctionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DiscontinousFunctionTest( "/root/repo/src/misc/test/unit/optimizertest.h", 209, "DiscontinousFunctionTest", suite_DiscontinousFunctionTest, Tests_DiscontinousFunctionTest );
+
+static class TestDescription_suite_DiscontinousFunctionTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DiscontinousFunctionTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_DiscontinousFunctionTest, suiteDescription_DiscontinousFunctionTest, 229, "testPatternDefault" ) {}
+ void runTest() { suite_DiscontinousFunctionTest.testPatternDefault(); }
+} testDescription_suite_DiscontinousFunctionTest_testPatternDefault;
+
+static class TestDescription_suite_DiscontinousFunctionTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DiscontinousFunctionTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_DiscontinousFunctionTest, suiteDescription_DiscontinousFunctionTest, 237, "testSimplexDefault" ) {}
+ void runTest() { suite_DiscontinousFunctionTest.testSimplexDefault(); }
+} testDescription_suite_DiscontinousFunctionTest_testSimplexDefault;
+
+static FiveDimensionsTest suite_FiveDimensionsTest;
+
+static CxxTest::List Tests_FiveDimensionsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FiveDimensionsTest( "/root/repo/src/misc/test/unit/optimizertest.h", 250, "FiveDimensionsTest", suite_FiveDimensionsTest, Tests_FiveDimensionsTest );
+
+static class TestDescription_suite_FiveDimensionsTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FiveDimensionsTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_FiveDimensionsTest, suiteDescription_FiveDimensionsTest, 276, "testPatternDefault" ) {}
+ void runTest() { suite_FiveDimensionsTest.testPatternDefault(); }
+} testDescription_suite_FiveDimensionsTest_testPatternDefault;
+
+static class TestDescription_suite_FiveDimensionsTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FiveDimensionsTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_FiveDimensionsTest, suiteDescription_FiveDimensionsTest, 284, "testSimplexDefault" ) {}
+ void runTest() { suite_FiveDimensionsTest.testSimplexDefault(); }
+} testDescription_suite_FiveDimensionsTest_testSimplexDefault;
+
+static class TestDescription_suite_FiveDimensionsTest_testSimplexOptimizedParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FiveDimensionsTest_testSimplexOptimizedParameters() : CxxTest::RealTestDescription( Tests_FiveDimensionsTest, suiteDescription_FiveDimensionsTest, 293, "testSimplexOptimizedParameters" ) {}
+ void runTest() { suite_FiveDimensionsTest.testSimplexOptimizedParameters(); }
+} testDescription_suite_FiveDimensionsTest_testSimplexOptimizedParameters;
+
+static class TestDescription_suite_FiveDimensionsTest_testHybridVersion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FiveDimensionsTest_testHybridVersion() : CxxTest::RealTestDescription( Tests_FiveDimensionsTest, suiteDescription_FiveDimensionsTest, 305, "testHybridVersion" ) {}
+ void runTest() { suite_FiveDimensionsTest.testHybridVersion(); }
+} testDescription_suite_FiveDimensionsTest_testHybridVersion;
+
+static HimmelblauTest suite_HimmelblauTest;
+
+static CxxTest::List Tests_HimmelblauTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HimmelblauTest( "/root/repo/src/misc/test/unit/optimizertest.h", 326, "HimmelblauTest", suite_HimmelblauTest, Tests_HimmelblauTest );
+
+static class TestDescription_suite_HimmelblauTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HimmelblauTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_HimmelblauTest, suiteDescription_HimmelblauTest, 344, "testPatternDefault" ) {}
+ void runTest() { suite_HimmelblauTest.testPatternDefault(); }
+} testDescription_suite_HimmelblauTest_testPatternDefault;
+
+static class TestDescription_suite_HimmelblauTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HimmelblauTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_HimmelblauTest, suiteDescription_HimmelblauTest, 352, "testSimplexDefault" ) {}
+ void runTest() { suite_HimmelblauTest.testSimplexDefault(); }
+} testDescription_suite_HimmelblauTest_testSimplexDefault;
+
+static HimmelblauDoubleTest suite_HimmelblauDoubleTest;
+
+static CxxTest::List Tests_HimmelblauDoubleTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HimmelblauDoubleTest( "/root/repo/src/misc/test/unit/optimizertest.h", 366, "HimmelblauDoubleTest", suite_HimmelblauDoubleTest, Tests_HimmelblauDoubleTest );
+
+static class TestDescription_suite_HimmelblauDoubleTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HimmelblauDoubleTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_HimmelblauDoubleTest, suiteDescription_HimmelblauDoubleTest, 385, "testPatternDefault" ) {}
+ void runTest() { suite_HimmelblauDoubleTest.testPatternDefault(); }
+} testDescription_suite_HimmelblauDoubleTest_testPatternDefault;
+
+static class TestDescription_suite_HimmelblauDoubleTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HimmelblauDoubleTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_HimmelblauDoubleTest, suiteDescription_HimmelblauDoubleTest, 393, "testSimplexDefault" ) {}
+ void runTest() { suite_HimmelblauDoubleTest.testSimplexDefault(); }
+} testDescription_suite_HimmelblauDoubleTest_testSimplexDefault;
+
+static class TestDescription_suite_HimmelblauDoubleTest_testSimplexChangedParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HimmelblauDoubleTest_testSimplexChangedParameters() : CxxTest::RealTestDescription( Tests_HimmelblauDoubleTest, suiteDescription_HimmelblauDoubleTest, 401, "testSimplexChangedParameters" ) {}
+ void runTest() { suite_HimmelblauDoubleTest.testSimplexChangedParameters(); }
+} testDescription_suite_HimmelblauDoubleTest_testSimplexChangedParameters;
+
+static Rosenbrock2DTest suite_Rosenbrock2DTest;
+
+static CxxTest::List Tests_Rosenbrock2DTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rosenbrock2DTest( "/root/repo/src/misc/test/unit/optimizertest.h", 415, "Rosenbrock2DTest", suite_Rosenbrock2DTest, Tests_Rosenbrock2DTest );
+
+static class TestDescription_suite_Rosenbrock2DTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock2DTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock2DTest, suiteDescription_Rosenbrock2DTest, 433, "testPatternDefault" ) {}
+ void runTest() { suite_Rosenbrock2DTest.testPatternDefault(); }
+} testDescription_suite_Rosenbrock2DTest_testPatternDefault;
+
+static class TestDescription_suite_Rosenbrock2DTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock2DTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock2DTest, suiteDescription_Rosenbrock2DTest, 441, "testSimplexDefault" ) {}
+ void runTest() { suite_Rosenbrock2DTest.testSimplexDefault(); }
+} testDescription_suite_Rosenbrock2DTest_testSimplexDefault;
+
+static Rosenbrock2DTestDouble suite_Rosenbrock2DTestDouble;
+
+static CxxTest::List Tests_Rosenbrock2DTestDouble = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rosenbrock2DTestDouble( "/root/repo/src/misc/test/unit/optimizertest.h", 453, "Rosenbrock2DTestDouble", suite_Rosenbrock2DTestDouble, Tests_Rosenbrock2DTestDouble );
+
+static class TestDescription_suite_Rosenbrock2DTestDouble_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock2DTestDouble_testPatternDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock2DTestDouble, suiteDescription_Rosenbrock2DTestDouble, 471, "testPatternDefault" ) {}
+ void runTest() { suite_Rosenbrock2DTestDouble.testPatternDefault(); }
+} testDescription_suite_Rosenbrock2DTestDouble_testPatternDefault;
+
+static class TestDescription_suite_Rosenbrock2DTestDouble_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock2DTestDouble_testSimplexDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock2DTestDouble, suiteDescription_Rosenbrock2DTestDouble, 479, "testSimplexDefault" ) {}
+ void runTest() { suite_Rosenbrock2DTestDouble.testSimplexDefault(); }
+} testDescription_suite_Rosenbrock2DTestDouble_testSimplexDefault;
+
+static Rosenbrock5DTest suite_Rosenbrock5DTest;
+
+static CxxTest::List Tests_Rosenbrock5DTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rosenbrock5DTest( "/root/repo/src/misc/test/unit/optimizertest.h", 491, "Rosenbrock5DTest", suite_Rosenbrock5DTest, Tests_Rosenbrock5DTest );
+
+static class TestDescription_suite_Rosenbrock5DTest_testPatternDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock5DTest_testPatternDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock5DTest, suiteDescription_Rosenbrock5DTest, 515, "testPatternDefault" ) {}
+ void runTest() { suite_Rosenbrock5DTest.testPatternDefault(); }
+} testDescription_suite_Rosenbrock5DTest_testPatternDefault;
+
+static class TestDescription_suite_Rosenbrock5DTest_testSimplexDefault : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock5DTest_testSimplexDefault() : CxxTest::RealTestDescription( Tests_Rosenbrock5DTest, suiteDescription_Rosenbrock5DTest, 523, "testSimplexDefault" ) {}
+ void runTest() { suite_Rosenbrock5DTest.testSimplexDefault(); }
+} testDescription_suite_Rosenbrock5DTest_testSimplexDefault;
+
+static class TestDescription_suite_Rosenbrock5DTest_testSimplexOptimizedParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rosenbrock5DTest_testSimplexOptimizedParameters() : CxxTest::RealTestDescription( Tests_Rosenbrock5DTest, suiteDescription_Rosenbrock5DTest, 532, "testSimplexOptimizedParameters" ) {}
+ void runTest() { suite_Rosenbrock5DTest.testSimplexOptimizedParameters(); }
+} testDescription_suite_Rosenbrock5DTest_testSimplexOptimizedParameters;
+
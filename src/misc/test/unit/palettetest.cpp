@@ -0,0 +1,39 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PaletteTest_init = false;
+#include "/root/repo/src/misc/test/unit/palettetest.h"
+
+static PaletteTest suite_PaletteTest;
+
+static CxxTest::List Tests_PaletteTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PaletteTest( "/root/repo/src/misc/test/unit/palettetest.h", 8, "PaletteTest", suite_PaletteTest, Tests_PaletteTest );
+
+static class TestDescription_suite_PaletteTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PaletteTest_testBasic() : CxxTest::RealTestDescription( Tests_PaletteTest, suiteDescription_PaletteTest, 11, "testBasic" ) {}
+ void runTest() { suite_PaletteTest.testBasic(); }
+} testDescription_suite_PaletteTest_testBasic;
+
@@ -5,9 +5,12 @@
 #ifdef LIBGEODECOMP_WITH_MPI
 
 #include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/geometry/partitions/hierarchicalpartition.h>
+#include <libgeodecomp/geometry/partitions/multilevelunstructuredpartition.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/ptscotchunstructuredpartition.h>
 #include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
+#include <libgeodecomp/io/logger.h>
 #include <libgeodecomp/loadbalancer/loadbalancer.h>
 #include <libgeodecomp/parallelization/distributedsimulator.h>
 #include <libgeodecomp/parallelization/nesting/eventpoint.h>
@@ -29,7 +32,8 @@ public:
     boost::shared_ptr<PARTITION_TYPE> operator()(
         const CoordBox<DIM>& box,
         const std::vector<std::size_t>& weights,
-        const Adjacency& /* unused*/)
+        const Adjacency& /* unused*/,
+        const MPI_Comm& /* unused: communicator */)
     {
         return boost::make_shared<PARTITION_TYPE>(
             box.origin,
@@ -46,7 +50,8 @@ public:
     boost::shared_ptr<UnstructuredStripingPartition> operator()(
         const CoordBox<1>& box,
         const std::vector<std::size_t>& weights,
-        const Adjacency& /* unused */)
+        const Adjacency& /* unused */,
+        const MPI_Comm& /* unused: communicator */)
     {
         return boost::make_shared<UnstructuredStripingPartition>(
             box.origin,
@@ -56,6 +61,61 @@ public:
     }
 };
 
+template<>
+class PartitionBuilder<MultilevelUnstructuredPartition>
+{
+public:
+    boost::shared_ptr<MultilevelUnstructuredPartition> operator()(
+        const CoordBox<1>& box,
+        const std::vector<std::size_t>& weights,
+        const Adjacency& adjacency,
+        const MPI_Comm& /* unused: communicator */)
+    {
+        boost::shared_ptr<MultilevelUnstructuredPartition> partition =
+            boost::make_shared<MultilevelUnstructuredPartition>(
+                box.origin,
+                box.dimensions,
+                0,
+                weights,
+                adjacency);
+
+        LOG(INFO, "MultilevelUnstructuredPartition: edge cut " << partition->getEdgeCut()
+            << ", imbalance " << partition->getImbalance());
+        return partition;
+    }
+};
+
+/**
+ * Derives the rank-to-node mapping from the MPI runtime so that
+ * neighboring subdomains end up on the same node.
+ */
+template<int DIM, typename OUTER_PARTITION, typename INNER_PARTITION>
+class PartitionBuilder<HierarchicalPartition<DIM, OUTER_PARTITION, INNER_PARTITION> >
+{
+public:
+    typedef HierarchicalPartition<DIM, OUTER_PARTITION, INNER_PARTITION> PartitionType;
+
+    boost::shared_ptr<PartitionType> operator()(
+        const CoordBox<DIM>& box,
+        const std::vector<std::size_t>& weights,
+        const Adjacency& /* unused */,
+        const MPI_Comm& communicator)
+    {
+        std::vector<std::size_t> nodeIDs = MPILayer(communicator).nodeIDs();
+        boost::shared_ptr<PartitionType> partition =
+            boost::make_shared<PartitionType>(
+                box.origin,
+                box.dimensions,
+                0,
+                weights,
+                nodeIDs);
+
+        LOG(INFO, "HierarchicalPartition: " << weights.size() << " ranks on "
+            << partition->getNumNodes() << " nodes");
+        return partition;
+    }
+};
+
 #ifdef WITH_SCOTCH
 template<int DIM>
 class PartitionBuilder<PTScotchUnstructuredPartition<DIM> >
@@ -64,7 +124,8 @@ public:
     boost::shared_ptr<PTScotchUnstructuredPartition<DIM >> operator()(
         const CoordBox<DIM>& box,
         const std::vector<std::size_t>& weights,
-        const Adjacency& adjacency)
+        const Adjacency& adjacency,
+        const MPI_Comm& /* unused: communicator */)
     {
         return boost::make_shared<PTScotchUnstructuredPartition<DIM> >(
             box.origin,
@@ -178,6 +239,57 @@ public:
         writerAdaptersInner.push_back(adapterInnerSet);
     }
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+    /**
+     * Like addWriter(), but the writer will be run by a dedicated I/O
+     * thread on snapshots of the grid, so the simulation doesn't
+     * stall on file system latency. At most queueDepth snapshots
+     * will be buffered, see ParallelWriterAdapterHelpers::AsyncWriterQueue.
+     * Unless writerUsesMPI is false, this requires MPI_THREAD_MULTIPLE,
+     * otherwise the writer will be run synchronously.
+     */
+    void addAsyncWriter(
+        ParallelWriter<CELL_TYPE> *writer,
+        std::size_t queueDepth = 2,
+        bool writerUsesMPI = true)
+    {
+        DistributedSimulator<CELL_TYPE>::addWriter(writer);
+
+        boost::shared_ptr<ParallelWriterAdapterHelpers::AsyncWriterQueue<CELL_TYPE> > queue(
+            new ParallelWriterAdapterHelpers::AsyncWriterQueue<CELL_TYPE>(
+                writers.back(), queueDepth, writerUsesMPI));
+
+        typename UpdateGroupType::PatchAccepterPtr adapterGhost(
+            new ParallelWriterAdapterType(
+                queue,
+                writers.back(),
+                initializer->startStep(),
+                initializer->maxSteps(),
+                false));
+        typename UpdateGroupType::PatchAccepterPtr adapterInnerSet(
+            new ParallelWriterAdapterType(
+                queue,
+                writers.back(),
+                initializer->startStep(),
+                initializer->maxSteps(),
+                true));
+
+        writerAdaptersGhost.push_back(adapterGhost);
+        writerAdaptersInner.push_back(adapterInnerSet);
+    }
+#endif
+
+    /**
+     * Lets the initial domain decomposition balance the estimated
+     * cost of the cells instead of their number (see
+     * Partition::setCostMap()). Needs to be called before run().
+     * Overrides the Initializer's CostMap, if any.
+     */
+    void setCostMap(const CostMap<DIM>& costs)
+    {
+        costMap.reset(new CostMap<DIM>(costs));
+    }
+
     std::vector<Chronometer> gatherStatistics()
     {
         Chronometer stats = chronometer + updateGroup->statistics();
@@ -195,6 +307,7 @@ private:
     EventMap events;
     MPILayer mpiLayer;
     boost::shared_ptr<UpdateGroupType> updateGroup;
+    boost::shared_ptr<CostMap<DIM> > costMap;
 
     typename UpdateGroupType::PatchProviderVec steererAdaptersGhost;
     typename UpdateGroupType::PatchProviderVec steererAdaptersInner;
@@ -267,7 +380,22 @@ private:
             HiParSimulatorHelpers::PartitionBuilder<PARTITION>()(
                box,
                weights,
-               initializer->getAdjacency());
+               initializer->getAdjacency(),
+               mpiLayer.communicator());
+        if (costMap) {
+            partition->setCostMap(*costMap);
+        } else {
+            // the initializer's estimate is optional, so partitions
+            // without cost maps simply cut by cell count:
+            CostMap<DIM> initialCosts = initializer->getCostMap();
+            if (initialCosts.boundingBox().dimensions.prod() > 0) {
+                if (partition->supportsCostMaps()) {
+                    partition->setCostMap(initialCosts);
+                } else {
+                    LOG(INFO, "partition doesn't support cost maps, ignoring the initializer's cost estimate");
+                }
+            }
+        }
 
         updateGroup.reset(
             new UpdateGroupType(
@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_COMMONSTEPPER_H
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_COMMONSTEPPER_H
 
+#include <libgeodecomp/io/parallelgridinitializer.h>
 #include <libgeodecomp/parallelization/nesting/stepper.h>
 #include <libgeodecomp/storage/patchbufferfixed.h>
 
@@ -37,6 +38,55 @@ public:
 
 };
 
+/**
+ * Converts a region into coordinates of a grid's bounding box: on
+ * periodic topologies the regions of the PartitionManager are
+ * normalized, but the grid may start at negative coordinates (see
+ * Stepper::guessOffset()). Accesses via streaks don't wrap around, so
+ * streaks are shifted (and split if need be).
+ */
+template<typename TOPOLOGY>
+class LocalRegion
+{
+public:
+    static const int DIM = TOPOLOGY::DIM;
+
+    Region<DIM> operator()(
+        const Region<DIM>& region,
+        const CoordBox<DIM>& gridBox,
+        const Coord<DIM>& topoDim) const
+    {
+        Region<DIM> ret;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> origin = gridBox.origin + TOPOLOGY::normalize(i->origin - gridBox.origin, topoDim);
+            int length = i->length();
+            int wrapped = origin.x() + length - (gridBox.origin.x() + topoDim.x());
+            if (TOPOLOGY::template WrapsAxis<0>::VALUE && (wrapped > 0)) {
+                ret << Streak<DIM>(origin, origin.x() + length - wrapped);
+                origin.x() = gridBox.origin.x();
+                length = wrapped;
+            }
+            ret << Streak<DIM>(origin, origin.x() + length);
+        }
+
+        return ret;
+    }
+};
+
+template<>
+class LocalRegion<TopologiesHelpers::UnstructuredTopology>
+{
+public:
+    Region<1> operator()(
+        const Region<1>& region,
+        const CoordBox<1>& /* gridBox */,
+        const Coord<1>& /* topoDim */) const
+    {
+        return region;
+    }
+};
+
 }
 
 template<typename CELL_TYPE>
@@ -176,7 +226,14 @@ protected:
         return curStep * NANO_STEPS + curNanoStep;
     }
 
-    inline CoordBox<DIM> initGridsCommon()
+    /**
+     * Allocates and initializes both grids. Only the cells within
+     * the node's own region and its ghost zone are set up, not the
+     * whole bounding box (unless the Initializer doesn't support
+     * parallel initialization). If enableOpenMP is set, the grids
+     * are set up by multiple threads (see ParallelGridInitializer).
+     */
+    inline CoordBox<DIM> initGridsCommon(bool enableOpenMP = false)
     {
         Coord<DIM> topoDim = initializer->gridDimensions();
         CoordBox<DIM> gridBox;
@@ -185,8 +242,11 @@ protected:
         oldGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
         newGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
 
-        initializer->grid(&*oldGrid);
-        initializer->grid(&*newGrid);
+        ParallelGridInitializer<CELL_TYPE> gridInitializer(enableOpenMP);
+        Region<DIM> region = CommonStepperHelpers::LocalRegion<Topology>()(
+            partitionManager->ownExpandedRegion(), gridBox, topoDim);
+        gridInitializer(&*initializer, &*oldGrid, region);
+        gridInitializer.replicate(&*initializer, *oldGrid, &*newGrid, region);
 
         notifyPatchProviders(partitionManager->getOuterRim(), ParentType::GHOST,     globalNanoStep());
         notifyPatchProviders(partitionManager->ownRegion(),   ParentType::INNER_SET, globalNanoStep());
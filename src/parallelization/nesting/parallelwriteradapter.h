@@ -1,11 +1,286 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_PARALLELWRITERADAPTER_H
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_PARALLELWRITERADAPTER_H
 
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/logger.h>
 #include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/storage/displacedgrid.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <boost/thread.hpp>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#endif
+
 namespace LibGeoDecomp {
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+namespace ParallelWriterAdapterHelpers {
+
+/**
+ * Moves the calls to ParallelWriter::stepFinished() off the
+ * simulation's critical path: push() copies the valid region into a
+ * pooled snapshot buffer and returns immediately, a dedicated thread
+ * then hands the snapshot to the writer. At most queueDepth snapshots
+ * may be in flight, push() blocks if all of them are taken
+ * (backpressure), so a writer which is consistently slower than the
+ * simulation will still throttle it.
+ *
+ * Both adapters of a writer (ghost zone and inner set) need to share
+ * one queue so that the writer sees the calls in the original order
+ * and never concurrently.
+ *
+ * Writers which issue MPI calls (e.g. ParallelMPIIOWriter) will do
+ * so from the I/O thread and thus require MPI to be initialized with
+ * MPI_THREAD_MULTIPLE. If MPI provides less, the queue falls back to
+ * invoking the writer synchronously from push(). Writers which don't
+ * use MPI may pass writerUsesMPI = false to remain asynchronous.
+ */
+template<typename CELL_TYPE>
+class AsyncWriterQueue
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> SnapshotType;
+    static const int DIM = Topology::DIM;
+
+    AsyncWriterQueue(
+        boost::shared_ptr<ParallelWriter<CELL_TYPE> > writer,
+        const std::size_t queueDepth,
+        const bool writerUsesMPI = true) :
+        writer(writer),
+        busy(false),
+        shutdown(false),
+        synchronous(writerUsesMPI && !threadMultipleAvailable())
+    {
+        if (queueDepth == 0) {
+            throw std::invalid_argument("queue depth must be positive");
+        }
+
+        if (synchronous) {
+            LOG(WARN, "MPI lacks MPI_THREAD_MULTIPLE, ParallelWriter will be run synchronously");
+            return;
+        }
+
+        snapshots.resize(queueDepth);
+        for (std::size_t i = 0; i < queueDepth; ++i) {
+            freeSnapshots.push_back(&snapshots[i]);
+        }
+
+        thread = boost::thread(&AsyncWriterQueue::run, this);
+    }
+
+    ~AsyncWriterQueue()
+    {
+        if (synchronous) {
+            return;
+        }
+
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            shutdown = true;
+        }
+        signal.notify_all();
+        thread.join();
+    }
+
+    /**
+     * true if the writer is being invoked from push() as MPI
+     * wouldn't permit calls from the I/O thread.
+     */
+    bool isSynchronous() const
+    {
+        return synchronous;
+    }
+
+    /**
+     * Waits until all pending snapshots have been written, then
+     * forwards the region to the writer.
+     */
+    void setRegion(const Region<DIM>& region)
+    {
+        drain();
+        writer->setRegion(region);
+        box = region.boundingBox();
+    }
+
+    void push(
+        const GridBase<CELL_TYPE, DIM>& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        const unsigned step,
+        const WriterEvent event,
+        const std::size_t rank,
+        const bool lastCall)
+    {
+        if (synchronous) {
+            writer->stepFinished(grid, validRegion, globalDimensions, step, event, rank, lastCall);
+            return;
+        }
+
+        SnapshotType *snapshot;
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            while (freeSnapshots.empty() && error.empty()) {
+                signal.wait(lock);
+            }
+            checkError();
+            snapshot = freeSnapshots.back();
+            freeSnapshots.pop_back();
+        }
+
+        // copying happens outside of the lock so the I/O thread may
+        // proceed concurrently:
+        if (!(snapshot->boundingBox() == box)) {
+            *snapshot = SnapshotType(box);
+        }
+        snapshot->paste(grid, validRegion);
+        snapshot->setEdge(grid.getEdge());
+
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            jobs.push_back(Job(snapshot, validRegion, globalDimensions, step, event, rank, lastCall));
+        }
+        signal.notify_all();
+    }
+
+    /**
+     * Blocks until the writer has processed all pending snapshots.
+     */
+    void drain()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while ((!jobs.empty() || busy) && error.empty()) {
+            signal.wait(lock);
+        }
+        checkError();
+    }
+
+private:
+    class Job
+    {
+    public:
+        Job(
+            SnapshotType *snapshot,
+            const Region<DIM>& validRegion,
+            const Coord<DIM>& globalDimensions,
+            const unsigned step,
+            const WriterEvent event,
+            const std::size_t rank,
+            const bool lastCall) :
+            snapshot(snapshot),
+            validRegion(validRegion),
+            globalDimensions(globalDimensions),
+            step(step),
+            event(event),
+            rank(rank),
+            lastCall(lastCall)
+        {}
+
+        SnapshotType *snapshot;
+        Region<DIM> validRegion;
+        Coord<DIM> globalDimensions;
+        unsigned step;
+        WriterEvent event;
+        std::size_t rank;
+        bool lastCall;
+    };
+
+    boost::shared_ptr<ParallelWriter<CELL_TYPE> > writer;
+    std::vector<SnapshotType> snapshots;
+    std::vector<SnapshotType*> freeSnapshots;
+    std::deque<Job> jobs;
+    CoordBox<DIM> box;
+    bool busy;
+    bool shutdown;
+    bool synchronous;
+    std::string error;
+    boost::mutex mutex;
+    boost::condition_variable signal;
+    boost::thread thread;
+
+    void run()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+
+        for (;;) {
+            while (jobs.empty() && !shutdown) {
+                signal.wait(lock);
+            }
+            if (jobs.empty()) {
+                return;
+            }
+
+            Job job = jobs.front();
+            jobs.pop_front();
+            busy = true;
+            lock.unlock();
+
+            std::string message;
+            try {
+                writer->stepFinished(
+                    *job.snapshot,
+                    job.validRegion,
+                    job.globalDimensions,
+                    job.step,
+                    job.event,
+                    job.rank,
+                    job.lastCall);
+            } catch (const std::exception& e) {
+                message = e.what();
+            }
+
+            lock.lock();
+            busy = false;
+            freeSnapshots.push_back(job.snapshot);
+            if (!message.empty() && error.empty()) {
+                error = message;
+            }
+            signal.notify_all();
+        }
+    }
+
+    static bool threadMultipleAvailable()
+    {
+#ifdef LIBGEODECOMP_WITH_MPI
+        int initialized;
+        MPI_Initialized(&initialized);
+        if (!initialized) {
+            return true;
+        }
+
+        int provided;
+        MPI_Query_thread(&provided);
+        return provided >= MPI_THREAD_MULTIPLE;
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * Exceptions can't cross thread boundaries, so errors raised by
+     * the writer are rethrown on the simulation's thread.
+     */
+    void checkError()
+    {
+        if (!error.empty()) {
+            throw std::runtime_error("asynchronous ParallelWriter failed: " + error);
+        }
+    }
+};
+
+}
+
+#endif
+
 template<typename CELL_TYPE, typename PARTITION, typename STEPPER>
 class HiParSimulator;
 
@@ -13,6 +288,11 @@ class HiParSimulator;
  * ParallelWriterAdapter translates the interface of a ParallelWriter
  * to a PatchAccepter, so that we can treat IO similarly to sending
  * ghost zones.
+ *
+ * If constructed with an AsyncWriterQueue, the writer will be
+ * invoked from the queue's I/O thread on a snapshot of the grid,
+ * so that stepping may continue while output is being written. The
+ * final call (WRITER_ALL_DONE) waits for all pending output.
  */
 template<typename GRID_TYPE, typename CELL_TYPE>
 class ParallelWriterAdapter : public PatchAccepter<GRID_TYPE>
@@ -41,8 +321,33 @@ public:
         pushRequest(lastNanoStep);
     }
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+    ParallelWriterAdapter(
+        boost::shared_ptr<ParallelWriterAdapterHelpers::AsyncWriterQueue<CELL_TYPE> > queue,
+        boost::shared_ptr<ParallelWriter<CELL_TYPE> > writer,
+        const std::size_t firstStep,
+        const std::size_t lastStep,
+        bool lastCall) :
+        writer(writer),
+        queue(queue),
+        firstNanoStep(firstStep * NANO_STEPS),
+        lastNanoStep(lastStep   * NANO_STEPS),
+        stride(writer->getPeriod() * NANO_STEPS),
+        lastCall(lastCall)
+    {
+        pushRequest(firstNanoStep);
+        pushRequest(lastNanoStep);
+    }
+#endif
+
     virtual void setRegion(const Region<GRID_TYPE::DIM>& region)
     {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if (queue) {
+            queue->setRegion(region);
+            return;
+        }
+#endif
         writer->setRegion(region);
     }
 
@@ -69,14 +374,7 @@ public:
             return;
         }
 
-        writer->stepFinished(
-            grid,
-            validRegion,
-            globalGridDimensions,
-            nanoStep / NANO_STEPS,
-            event,
-            rank,
-            lastCall);
+        notify(grid, validRegion, globalGridDimensions, nanoStep / NANO_STEPS, event, rank);
         erase_min(requestedNanoSteps);
         std::size_t nextNanoStep = nanoStep + stride;
         pushRequest(nextNanoStep);
@@ -84,10 +382,41 @@ public:
 
 private:
     boost::shared_ptr<ParallelWriter<CELL_TYPE> > writer;
+#ifdef LIBGEODECOMP_WITH_THREADS
+    boost::shared_ptr<ParallelWriterAdapterHelpers::AsyncWriterQueue<CELL_TYPE> > queue;
+#endif
     std::size_t firstNanoStep;
     std::size_t lastNanoStep;
     std::size_t stride;
     bool lastCall;
+
+    void notify(
+        const GRID_TYPE& grid,
+        const Region<GRID_TYPE::DIM>& validRegion,
+        const Coord<GRID_TYPE::DIM>& globalGridDimensions,
+        const unsigned step,
+        const WriterEvent event,
+        const std::size_t rank)
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if (queue) {
+            queue->push(grid, validRegion, globalGridDimensions, step, event, rank, lastCall);
+            if (event == WRITER_ALL_DONE) {
+                queue->drain();
+            }
+            return;
+        }
+#endif
+
+        writer->stepFinished(
+            grid,
+            validRegion,
+            globalGridDimensions,
+            step,
+            event,
+            rank,
+            lastCall);
+    }
 };
 
 }
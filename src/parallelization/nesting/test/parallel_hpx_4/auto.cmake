@@ -0,0 +1,5 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hpxupdategrouptest.h
+)
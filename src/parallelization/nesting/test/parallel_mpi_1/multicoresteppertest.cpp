@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MulticoreStepperTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/multicoresteppertest.h"
+
+static MulticoreStepperTest suite_MulticoreStepperTest;
+
+static CxxTest::List Tests_MulticoreStepperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MulticoreStepperTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/multicoresteppertest.h", 13, "MulticoreStepperTest", suite_MulticoreStepperTest, Tests_MulticoreStepperTest );
+
+static class TestDescription_suite_MulticoreStepperTest_testFoo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MulticoreStepperTest_testFoo() : CxxTest::RealTestDescription( Tests_MulticoreStepperTest, suiteDescription_MulticoreStepperTest, 39, "testFoo" ) {}
+ void runTest() { suite_MulticoreStepperTest.testFoo(); }
+} testDescription_suite_MulticoreStepperTest_testFoo;
+
@@ -0,0 +1,235 @@
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/parallelization/nesting/parallelwriteradapter.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ParallelWriterAdapterTestCell
+{
+public:
+    class API :
+        public APITraits::HasCubeTopology<2>
+    {};
+
+    explicit ParallelWriterAdapterTestCell(int value = 0) :
+        value(value)
+    {}
+
+    int value;
+};
+
+/**
+ * Records the sum of all cells of the valid region for each call.
+ * Optionally waits until released by the test, which allows us to
+ * check that the adapter doesn't block on the writer.
+ */
+class ParallelWriterAdapterTestWriter :
+        public Clonable<ParallelWriter<ParallelWriterAdapterTestCell>, ParallelWriterAdapterTestWriter>
+{
+public:
+    typedef ParallelWriter<ParallelWriterAdapterTestCell>::GridType GridType;
+
+    ParallelWriterAdapterTestWriter(bool blocking = false, bool failing = false) :
+        Clonable<ParallelWriter<ParallelWriterAdapterTestCell>, ParallelWriterAdapterTestWriter>("", 1),
+        blocking(blocking),
+        failing(failing),
+        released(false),
+        mutex(new boost::mutex),
+        signal(new boost::condition_variable)
+    {}
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<2>& validRegion,
+        const Coord<2>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if (failing) {
+            throw std::runtime_error("disk full");
+        }
+
+        {
+            boost::unique_lock<boost::mutex> lock(*mutex);
+            while (blocking && !released) {
+                signal->wait(lock);
+            }
+        }
+
+        int sum = 0;
+        for (Region<2>::Iterator i = validRegion.begin(); i != validRegion.end(); ++i) {
+            sum += grid.get(*i).value;
+        }
+
+        boost::unique_lock<boost::mutex> lock(*mutex);
+        steps << step;
+        events << event;
+        lastCalls << lastCall;
+        sums << sum;
+        regions << region;
+    }
+
+    void release()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(*mutex);
+            released = true;
+        }
+        signal->notify_all();
+    }
+
+    std::size_t numCalls()
+    {
+        boost::unique_lock<boost::mutex> lock(*mutex);
+        return steps.size();
+    }
+
+    std::vector<unsigned> steps;
+    std::vector<WriterEvent> events;
+    std::vector<bool> lastCalls;
+    std::vector<int> sums;
+    std::vector<Region<2> > regions;
+
+private:
+    bool blocking;
+    bool failing;
+    bool released;
+    boost::shared_ptr<boost::mutex> mutex;
+    boost::shared_ptr<boost::condition_variable> signal;
+};
+
+class ParallelWriterAdapterTest : public CxxTest::TestSuite
+{
+public:
+    typedef ParallelWriterAdapterTestCell CellType;
+    typedef DisplacedGrid<CellType, Topologies::Cube<2>::Topology> GridType;
+    typedef ParallelWriterAdapter<GridType, CellType> AdapterType;
+    typedef ParallelWriterAdapterHelpers::AsyncWriterQueue<CellType> QueueType;
+
+    void setUp()
+    {
+        box = CoordBox<2>(Coord<2>(10, 20), Coord<2>(4, 3));
+        region.clear();
+        region << box;
+        grid = GridType(box, CellType(1));
+    }
+
+    void testSynchronous()
+    {
+        boost::shared_ptr<ParallelWriterAdapterTestWriter> writer(new ParallelWriterAdapterTestWriter);
+        AdapterType adapter(writer, 0, 2, true);
+        adapter.setRegion(region);
+
+        for (std::size_t step = 0; step <= 2; ++step) {
+            adapter.put(grid, region, Coord<2>(100, 100), step, 0);
+            TS_ASSERT_EQUALS(step + 1, writer->steps.size());
+        }
+
+        TS_ASSERT_EQUALS(WRITER_INITIALIZED,   writer->events[0]);
+        TS_ASSERT_EQUALS(WRITER_STEP_FINISHED, writer->events[1]);
+        TS_ASSERT_EQUALS(WRITER_ALL_DONE,      writer->events[2]);
+    }
+
+    void testAsynchronousUsesSnapshots()
+    {
+        boost::shared_ptr<ParallelWriterAdapterTestWriter> writer(new ParallelWriterAdapterTestWriter(true));
+        boost::shared_ptr<QueueType> queue(new QueueType(writer, 3, false));
+        AdapterType adapterGhost(queue, writer, 0, 2, false);
+        AdapterType adapterInner(queue, writer, 0, 2, true);
+        adapterGhost.setRegion(region);
+        adapterInner.setRegion(region);
+
+        Region<2> ghostRegion;
+        ghostRegion << Streak<2>(Coord<2>(10, 20), 14);
+        Region<2> innerRegion = region - ghostRegion;
+
+        // the writer is blocked, yet put() returns...
+        adapterGhost.put(grid, ghostRegion, Coord<2>(100, 100), 0, 0);
+        adapterInner.put(grid, innerRegion, Coord<2>(100, 100), 0, 0);
+        grid.fill(box, CellType(2));
+        adapterGhost.put(grid, ghostRegion, Coord<2>(100, 100), 1, 0);
+        TS_ASSERT_EQUALS(std::size_t(0), writer->numCalls());
+
+        // ...and modifications to the grid after put() don't affect
+        // the output:
+        writer->release();
+        queue->drain();
+        TS_ASSERT_EQUALS(std::size_t(3), writer->numCalls());
+        TS_ASSERT_EQUALS( 4, writer->sums[0]);
+        TS_ASSERT_EQUALS( 8, writer->sums[1]);
+        TS_ASSERT_EQUALS( 8, writer->sums[2]);
+        TS_ASSERT_EQUALS(false, writer->lastCalls[0]);
+        TS_ASSERT_EQUALS(true,  writer->lastCalls[1]);
+        TS_ASSERT_EQUALS(region, writer->regions[0]);
+
+        adapterInner.put(grid, innerRegion, Coord<2>(100, 100), 1, 0);
+        adapterGhost.put(grid, ghostRegion, Coord<2>(100, 100), 2, 0);
+        // the final call waits for all pending output:
+        adapterInner.put(grid, innerRegion, Coord<2>(100, 100), 2, 0);
+        TS_ASSERT_EQUALS(std::size_t(6), writer->numCalls());
+        TS_ASSERT_EQUALS(16, writer->sums[3]);
+        TS_ASSERT_EQUALS(WRITER_ALL_DONE, writer->events[5]);
+    }
+
+    void testAsynchronousBackpressure()
+    {
+        boost::shared_ptr<ParallelWriterAdapterTestWriter> writer(new ParallelWriterAdapterTestWriter(true));
+        boost::shared_ptr<QueueType> queue(new QueueType(writer, 1, false));
+        queue->setRegion(region);
+
+        queue->push(grid, region, Coord<2>(100, 100), 0, WRITER_INITIALIZED, 0, true);
+        // the only buffer is taken, so this call has to wait until
+        // the writer returns it:
+        boost::thread releaser(&ParallelWriterAdapterTestWriter::release, writer.get());
+        queue->push(grid, region, Coord<2>(100, 100), 1, WRITER_STEP_FINISHED, 0, true);
+        releaser.join();
+        queue->drain();
+
+        TS_ASSERT_EQUALS(std::size_t(2), writer->numCalls());
+        TS_ASSERT_THROWS(QueueType(writer, 0), std::invalid_argument);
+    }
+
+    void testAsynchronousErrors()
+    {
+        boost::shared_ptr<ParallelWriterAdapterTestWriter> writer(new ParallelWriterAdapterTestWriter(false, true));
+        QueueType queue(writer, 2, false);
+        queue.setRegion(region);
+
+        queue.push(grid, region, Coord<2>(100, 100), 0, WRITER_INITIALIZED, 0, true);
+        TS_ASSERT_THROWS(queue.drain(), std::runtime_error);
+    }
+
+    void testSynchronousFallbackWithoutThreadMultiple()
+    {
+        int provided;
+        MPI_Query_thread(&provided);
+        boost::shared_ptr<ParallelWriterAdapterTestWriter> writer(new ParallelWriterAdapterTestWriter);
+        QueueType queue(writer, 2);
+        TS_ASSERT_EQUALS(provided < MPI_THREAD_MULTIPLE, queue.isSynchronous());
+        TS_ASSERT(!QueueType(writer, 2, false).isSynchronous());
+
+        queue.setRegion(region);
+        queue.push(grid, region, Coord<2>(100, 100), 0, WRITER_INITIALIZED, 0, true);
+        if (queue.isSynchronous()) {
+            // the writer has been invoked on the caller's thread:
+            TS_ASSERT_EQUALS(std::size_t(1), writer->numCalls());
+        }
+        queue.drain();
+        TS_ASSERT_EQUALS(std::size_t(1), writer->numCalls());
+        TS_ASSERT_EQUALS(12, writer->sums[0]);
+    }
+
+private:
+    CoordBox<2> box;
+    Region<2> region;
+    GridType grid;
+};
+
+}
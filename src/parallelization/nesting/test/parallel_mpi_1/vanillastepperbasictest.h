@@ -57,6 +57,28 @@ public:
         TS_ASSERT_EQUALS(std::size_t(3), patchAccepter->getOfferedNanoSteps().size());
     }
 
+    void testTiling()
+    {
+        // planes of this grid won't fit into the cache, so the
+        // stepper should resort to tiling:
+        typedef TestCell<3> TestCell3D;
+        typedef APITraits::SelectTopology<TestCell3D>::Value Topology;
+        typedef DisplacedGrid<TestCell3D, Topology, true> GridType3D;
+        typedef VanillaStepper<TestCell3D, UpdateFunctorHelpers::ConcurrencyNoP> StepperType3D;
+
+        boost::shared_ptr<TestInitializer<TestCell3D> > init3D(
+            new TestInitializer<TestCell3D>(Coord<3>(128, 64, 10)));
+        boost::shared_ptr<PartitionManager<Topology> > partitionManager3D(
+            new PartitionManager<Topology>(init3D->gridBox()));
+        StepperType3D stepper3D(partitionManager3D, init3D);
+
+        TS_ASSERT_EQUALS(std::size_t(2), stepper3D.innerSetTiles.size());
+        TS_ASSERT_LESS_THAN(std::size_t(1), stepper3D.innerSetTiles[1].size());
+
+        stepper3D.update(5);
+        TS_ASSERT_TEST_GRID(GridType3D, stepper3D.grid(), 5);
+    }
+
 private:
     boost::shared_ptr<TestInitializer<TestCell<2> > > init;
     boost::shared_ptr<PartitionManager<Topologies::Cube<2>::Topology> > partitionManager;
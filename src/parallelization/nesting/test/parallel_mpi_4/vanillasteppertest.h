@@ -126,8 +126,81 @@ public:
             }
         }
 
-        int tag = 4711;
+        addPatchLinks(ghostZoneWidth * 5);
+
+        // let's go
+        checkInnerSet(0, 0);
+
+        stepper->update(1);
+        checkInnerSet(1, 1);
+
+        stepper->update(3);
+        checkInnerSet(0, 4);
+        std::size_t allocations = SerializationBuffer<TestCell<3> >::allocations();
+
+        stepper->update(11);
+        checkInnerSet(3, 15);
+        // steady state stepping shouldn't allocate any buffers:
+        TS_ASSERT_EQUALS(allocations, SerializationBuffer<TestCell<3> >::allocations());
+    }
+
+    void testGhostZoneWidth1()
+    {
+        // steppers use a special code path for this width, which
+        // doesn't buffer the rim:
+        ghostZoneWidth = 1;
+        init.reset(new TestInitializer<TestCell<3> >(Coord<3>(31, 20, 24)));
+        CoordBox<3> box = init->gridBox();
+
+        std::vector<std::size_t> weights;
+        weights += 3000, 4000, 3000;
+        weights << box.dimensions.prod() - sum(weights);
+        boost::shared_ptr<Partition<3> > partition(
+            new StripingPartition<3>(Coord<3>(), box.dimensions, 0, weights));
+
+        partitionManager.reset(new PartitionManagerType());
+        partitionManager->resetRegions(
+            box,
+            partition,
+            mpiLayer->rank(),
+            ghostZoneWidth);
 
+        std::vector<CoordBox<3> > boundingBoxes;
+        for (int i = 0; i < 4; ++i) {
+            boundingBoxes << partitionManager->getRegion(i, 0).boundingBox();
+        }
+        partitionManager->resetGhostZones(boundingBoxes);
+
+        stepper.reset(new StepperType(partitionManager, init));
+        addPatchLinks(30);
+        checkInnerSet(0, 0);
+
+        stepper->update(1);
+        checkInnerSet(0, 1);
+        std::size_t allocations = SerializationBuffer<TestCell<3> >::allocations();
+
+        stepper->update(6);
+        checkInnerSet(0, 7);
+
+        stepper->update(13);
+        checkInnerSet(0, 20);
+        TS_ASSERT_EQUALS(allocations, SerializationBuffer<TestCell<3> >::allocations());
+    }
+
+private:
+    int ghostZoneWidth;
+    boost::shared_ptr<TestInitializer<TestCell<3> > > init;
+    boost::shared_ptr<PartitionManagerType> partitionManager;
+    boost::shared_ptr<StepperType> stepper;
+    boost::shared_ptr<MPILayer> mpiLayer;
+
+    /**
+     * Sets up PatchLinks for the ghost zone communication between
+     * all ranks and re-initializes the stepper.
+     */
+    void addPatchLinks(std::size_t lastNanoStep)
+    {
+        int tag = 4711;
         std::vector<PatchProviderPtrType> providers;
         std::vector<PatchAccepterPtrType> accepters;
 
@@ -171,13 +244,13 @@ public:
         for (std::vector<PatchProviderPtrType>::iterator i = providers.begin();
              i != providers.end();
              ++i) {
-            (*i)->charge(ghostZoneWidth, ghostZoneWidth * 5, ghostZoneWidth);
+            (*i)->charge(ghostZoneWidth, lastNanoStep, ghostZoneWidth);
         }
 
         for (std::vector<PatchAccepterPtrType>::iterator i = accepters.begin();
              i != accepters.end();
              ++i) {
-            (*i)->charge(ghostZoneWidth, ghostZoneWidth * 5, ghostZoneWidth);
+            (*i)->charge(ghostZoneWidth, lastNanoStep, ghostZoneWidth);
         }
 
         // need to re-init after PatchLinks have been added since
@@ -185,27 +258,8 @@ public:
         // update the patch accepters will be notified, which is
         // required to get the patch communication going.
         stepper->initGrids();
-
-        // let's go
-        checkInnerSet(0, 0);
-
-        stepper->update(1);
-        checkInnerSet(1, 1);
-
-        stepper->update(3);
-        checkInnerSet(0, 4);
-
-        stepper->update(11);
-        checkInnerSet(3, 15);
     }
 
-private:
-    int ghostZoneWidth;
-    boost::shared_ptr<TestInitializer<TestCell<3> > > init;
-    boost::shared_ptr<PartitionManagerType> partitionManager;
-    boost::shared_ptr<StepperType> stepper;
-    boost::shared_ptr<MPILayer> mpiLayer;
-
     void checkInnerSet(
         const unsigned& shrink,
         const unsigned& expectedStep)
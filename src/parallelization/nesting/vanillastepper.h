@@ -1,7 +1,9 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 
+#include <libgeodecomp/geometry/regiontiler.h>
 #include <libgeodecomp/parallelization/nesting/commonstepper.h>
+#include <libgeodecomp/storage/tiledupdatefunctor.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
 namespace LibGeoDecomp {
@@ -13,6 +15,9 @@ namespace LibGeoDecomp {
  * calculation and support wide halos (halos = ghostzones). Ghost
  * zones of width k mean that synchronization only needs to be done
  * every k'th (nano) step.
+ *
+ * If the planes of the local grid exceed the cache, the inner set
+ * is updated in cache-sized tiles (see RegionTiler).
  */
 template<typename CELL_TYPE, typename CONCURRENCY_SPEC>
 class VanillaStepper : public CommonStepper<CELL_TYPE>
@@ -83,6 +88,10 @@ public:
     }
 
 private:
+    std::vector<std::vector<Region<DIM> > > innerSetTiles;
+
+    // fixme: skip quiescent cells via ActivityTracker. This needs the
+    // activity fronts to be exchanged via the PatchLinks, too.
     inline void update1()
     {
         TimeTotal t(&chronometer);
@@ -91,14 +100,25 @@ private:
         {
             TimeComputeInner t(&chronometer);
 
-            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
-                region,
-                Coord<DIM>(),
-                Coord<DIM>(),
-                *oldGrid,
-                &*newGrid,
-                curNanoStep,
-                CONCURRENCY_SPEC(false));
+            if (innerSetTiles.empty()) {
+                UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+                    region,
+                    Coord<DIM>(),
+                    Coord<DIM>(),
+                    *oldGrid,
+                    &*newGrid,
+                    curNanoStep,
+                    CONCURRENCY_SPEC(false));
+            } else {
+                TiledUpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+                    innerSetTiles[index],
+                    Coord<DIM>(),
+                    Coord<DIM>(),
+                    *oldGrid,
+                    &*newGrid,
+                    curNanoStep,
+                    CONCURRENCY_SPEC(false));
+            }
             std::swap(oldGrid, newGrid);
 
             ++curNanoStep;
@@ -122,7 +142,8 @@ private:
 
     inline void initGrids()
     {
-        initGridsCommon();
+        CoordBox<DIM> gridBox = initGridsCommon(CONCURRENCY_SPEC(false).enableOpenMP());
+        initTiles(gridBox);
 
         notifyPatchAccepters(
             rim(),
@@ -133,10 +154,30 @@ private:
             ParentType::INNER_SET,
             globalNanoStep());
 
-        saveRim(globalNanoStep());
+        if (ghostZoneWidth() > 1) {
+            saveRim(globalNanoStep());
+        }
         updateGhost();
     }
 
+    /**
+     * Precomputes the tiles of all inner sets. The rim is updated
+     * plane-wise as it is usually too thin to benefit from tiling.
+     */
+    inline void initTiles(const CoordBox<DIM>& gridBox)
+    {
+        innerSetTiles.clear();
+        Coord<DIM> tileDimensions = RegionTiler<DIM>::autoTileDimensions(
+            gridBox.dimensions, sizeof(CELL_TYPE));
+        if (tileDimensions == Coord<DIM>()) {
+            return;
+        }
+
+        for (unsigned i = 0; i <= ghostZoneWidth(); ++i) {
+            innerSetTiles << RegionTiler<DIM>::tile(innerSet(i), tileDimensions);
+        }
+    }
+
     /**
      * computes the next ghost zone at time "t_1 = globalNanoStep() +
      * ghostZoneWidth()". Expects that oldGrid has its kernel and its
@@ -148,12 +189,14 @@ private:
      */
     inline void updateGhost()
     {
+        if (ghostZoneWidth() == 1) {
+            updateGhostDirect();
+            return;
+        }
+
         {
             TimeComputeGhost t(&chronometer);
 
-            // fixme: skip all this ghost zone buffering for
-            // ghostZoneWidth == 1?
-
             // 1: Prepare grid. The following update of the ghostzone will
             // destroy parts of the kernel, which is why we'll
             // save/restore those.
@@ -213,6 +256,58 @@ private:
             restoreKernel();
         }
     }
+
+    /**
+     * Specialization of updateGhost() for ghostZoneWidth() == 1: the
+     * rim is the only region updated within newGrid, and the
+     * following kernel update won't touch it. So instead of buffering
+     * kernel and rim, we can write the rim at time t_1 directly to
+     * newGrid, where it'll be picked up by the next swap of the
+     * grids. oldGrid remains unchanged except for the outer ghost
+     * zone, which is required at time globalNanoStep() by both, the
+     * rim and the kernel update.
+     *
+     * As nothing gets restored afterwards, PatchProviders (e.g.
+     * Steerers) may modify each cell only once: GHOST providers are
+     * restricted to the outer ghost zone and INNER_SET providers are
+     * applied before the rim update (update1() won't notify them
+     * again for the same nano step).
+     */
+    inline void updateGhostDirect()
+    {
+        std::size_t oldNanoStep = curNanoStep;
+        std::size_t oldStep = curStep;
+
+        notifyPatchProviders(partitionManager->getOuterRim(), ParentType::GHOST, globalNanoStep());
+        notifyPatchProviders(innerSet(0), ParentType::INNER_SET, globalNanoStep());
+
+        {
+            TimeComputeGhost timer(&chronometer);
+
+            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+                rim(1),
+                Coord<DIM>(),
+                Coord<DIM>(),
+                *oldGrid,
+                &*newGrid,
+                curNanoStep,
+                CONCURRENCY_SPEC(true));
+
+            ++curNanoStep;
+            if (curNanoStep == NANO_STEPS) {
+                curNanoStep = 0;
+                curStep++;
+            }
+        }
+
+        // accepters read from oldGrid, hence the temporary swap:
+        std::swap(oldGrid, newGrid);
+        notifyPatchAccepters(rim(1), ParentType::GHOST, globalNanoStep());
+        std::swap(oldGrid, newGrid);
+
+        curNanoStep = oldNanoStep;
+        curStep = oldStep;
+    }
 };
 
 }
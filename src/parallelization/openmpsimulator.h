@@ -4,12 +4,23 @@
 // include this file first to avoid clashes of Intel MPI with stdio.h.
 #include <libgeodecomp/misc/apitraits.h>
 
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
+#include <libgeodecomp/geometry/regiontiler.h>
+#include <libgeodecomp/io/parallelgridinitializer.h>
 #include <libgeodecomp/io/writer.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
+#include <libgeodecomp/storage/activitytracker.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
+#include <libgeodecomp/storage/tiledupdatefunctor.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
+#include <boost/type_traits/is_same.hpp>
+
 namespace LibGeoDecomp {
 
 /**
@@ -25,7 +36,8 @@ public:
     typedef typename MonolithicSimulator<CELL_TYPE>::Topology Topology;
     typedef typename MonolithicSimulator<CELL_TYPE>::WriterVector WriterVector;
     typedef typename APITraits::SelectSoA<CELL_TYPE>::Value SupportsSoA;
-    typedef typename GridTypeSelector<CELL_TYPE, Topology, false, SupportsSoA>::Value GridType;
+    typedef typename MonolithicGridTypeSelector<CELL_TYPE, Topology, SupportsSoA>::Value GridType;
+    typedef typename APITraits::SelectStencil<CELL_TYPE>::Value Stencil;
     typedef typename Steerer<CELL_TYPE>::SteererFeedback SteererFeedback;
 
     static const int DIM = Topology::DIM;
@@ -43,18 +55,23 @@ public:
      * creates a OpenMPSimulator with the given initializer.
      */
     explicit OpenMPSimulator(Initializer<CELL_TYPE> *initializer) :
-        MonolithicSimulator<CELL_TYPE>(initializer)
+        MonolithicSimulator<CELL_TYPE>(initializer),
+        persistentThreadTeam(false)
     {
         stepNum = initializer->startStep();
         Coord<DIM> dim = initializer->gridBox().dimensions;
         curGrid = new GridType(CoordBox<DIM>(Coord<DIM>(), dim));
         newGrid = new GridType(CoordBox<DIM>(Coord<DIM>(), dim));
-        initializer->grid(curGrid);
-        initializer->grid(newGrid);
+        ParallelGridInitializer<CELL_TYPE> gridInitializer;
+        gridInitializer(initializer, curGrid);
+        gridInitializer.replicate(initializer, *curGrid, newGrid);
 
         // fixme: refactor OpenMPSimulator, serialsim, cudasim to reduce code duplication
         CoordBox<DIM> box = curGrid->boundingBox();
         simArea << box;
+        updateRegion << box;
+
+        setTileDimensions(RegionTiler<DIM>::autoTileDimensions(dim, sizeof(CELL_TYPE)));
     }
 
     virtual ~OpenMPSimulator()
@@ -78,8 +95,12 @@ public:
 
         handleInput(STEERER_NEXT_STEP, feedback);
 
-        for (unsigned i = 0; i < NANO_STEPS; ++i) {
-            nanoStep(i);
+        if (persistentThreadTeam) {
+            nanoSteps(NANO_STEPS);
+        } else {
+            for (unsigned i = 0; i < NANO_STEPS; ++i) {
+                nanoStep(i);
+            }
         }
 
         ++stepNum;
@@ -91,7 +112,8 @@ public:
      */
     virtual void run()
     {
-        initializer->grid(curGrid);
+        ParallelGridInitializer<CELL_TYPE>()(&*initializer, curGrid);
+        activityTracker.reset();
         stepNum = initializer->startStep();
         setIORegions();
 
@@ -104,6 +126,19 @@ public:
                 break;
             }
 
+            // steps without any IO can be batched so that a
+            // persistent thread team doesn't need to be disbanded in
+            // between:
+            if (persistentThreadTeam) {
+                unsigned steps = quietSteps();
+                if (steps > 0) {
+                    TimeTotal t(&chronometer);
+                    nanoSteps(steps * NANO_STEPS);
+                    stepNum += steps;
+                    continue;
+                }
+            }
+
             step(&feedback);
         }
 
@@ -119,26 +154,266 @@ public:
         return curGrid;
     }
 
+    /**
+     * Enables spatial cache blocking: the grid will be updated in
+     * tiles of the given size (along the y- and z-axes, see
+     * RegionTiler), each of which is handled by a single thread.
+     * By default the tile size is derived from the grid and cell
+     * size. Passing a zero Coord disables tiling, so that threads
+     * work on full planes instead.
+     */
+    void setTileDimensions(const Coord<DIM>& newTileDimensions)
+    {
+        tileDimensions = newTileDimensions;
+        tiles.clear();
+
+        if (tileDimensions != Coord<DIM>()) {
+            tiles = RegionTiler<DIM>::tile(updateRegion, tileDimensions);
+        }
+
+        initChunks();
+    }
+
+    const Coord<DIM>& getTileDimensions() const
+    {
+        return tileDimensions;
+    }
+
+    /**
+     * By default each nano step forks and joins a team of threads.
+     * In persistent mode a single OpenMP parallel region spans all
+     * nano steps of a time step (and all time steps in between IO
+     * events). Each thread owns a fixed chunk of planes and only
+     * waits for the chunks adjacent to it to complete the previous
+     * nano step, instead of waiting at a barrier. This pays off for
+     * small grids, where fork/join overhead would dominate.
+     */
+    void setPersistentThreadTeam(const bool enable)
+    {
+        persistentThreadTeam = enable;
+        initChunks();
+    }
+
 protected:
     GridType *curGrid;
     GridType *newGrid;
     Region<DIM> simArea;
+    // see SerialSimulator::updateRegion
+    Region<DIM> updateRegion;
+    Coord<DIM> tileDimensions;
+    std::vector<Region<DIM> > tiles;
+    bool persistentThreadTeam;
+    std::vector<std::vector<Region<DIM> > > chunks;
+    ActivityTracker<CELL_TYPE> activityTracker;
 
     void nanoStep(const unsigned& nanoStep)
     {
         TimeCompute t(&chronometer);
 
-        UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
-            simArea,
-            Coord<DIM>(),
-            Coord<DIM>(),
-            *curGrid,
-            newGrid,
-            nanoStep,
-            UpdateFunctorHelpers::ConcurrencyEnableOpenMP(true));
+        // see SerialSimulator::nanoStep()
+        HaloPaddedGridHelpers::RefreshHalo<GridType>()(curGrid);
+        if (SparseBrickedGridHelpers::SyncBricks<GridType>()(curGrid, newGrid, &updateRegion, Stencil::RADIUS)) {
+            setTileDimensions(tileDimensions);
+        }
+
+        // static scheduling ensures that each thread updates the
+        // planes it has initialized (NUMA first touch):
+        if (ActivityTracker<CELL_TYPE>::ENABLED) {
+            // the active region changes with every nano step, so
+            // tiling it wouldn't pay off:
+            const Region<DIM>& activeRegion = activityTracker.updateRegion(updateRegion);
+            UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
+                activeRegion,
+                Coord<DIM>(),
+                Coord<DIM>(),
+                *curGrid,
+                newGrid,
+                nanoStep,
+                UpdateFunctorHelpers::ConcurrencyEnableOpenMP(false));
+            activityTracker.track(*newGrid, activeRegion, true);
+        } else if (tiles.empty()) {
+            UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
+                updateRegion,
+                Coord<DIM>(),
+                Coord<DIM>(),
+                *curGrid,
+                newGrid,
+                nanoStep,
+                UpdateFunctorHelpers::ConcurrencyEnableOpenMP(false));
+        } else {
+            TiledUpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
+                tiles,
+                Coord<DIM>(),
+                Coord<DIM>(),
+                *curGrid,
+                newGrid,
+                nanoStep,
+                UpdateFunctorHelpers::ConcurrencyEnableOpenMP(false));
+        }
         std::swap(curGrid, newGrid);
     }
 
+    /**
+     * Runs the given number of nano steps (starting at nano step 0)
+     * with a persistent thread team.
+     */
+    void nanoSteps(const unsigned count)
+    {
+        // the update region of sparse grids and of cells with
+        // activity tracking may change in between nano steps, which
+        // the chunks can't follow:
+        if (SparseBrickedGridHelpers::SyncBricks<GridType>::REQUIRED ||
+            ActivityTracker<CELL_TYPE>::ENABLED) {
+            for (unsigned i = 0; i < count; ++i) {
+                nanoStep(i % NANO_STEPS);
+            }
+            return;
+        }
+
+        TimeCompute t(&chronometer);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        // neighboring chunks can only be determined for structured
+        // grids, and halo-padded grids need to be refreshed as a
+        // whole, so these cases require barriers:
+        const bool pointToPoint =
+            !HaloPaddedGridHelpers::RefreshHalo<GridType>::REQUIRED &&
+            !boost::is_same<Topology, TopologiesHelpers::UnstructuredTopology>::value;
+        const long numChunks = chunks.size();
+        std::vector<unsigned> progress(numChunks, 0);
+        GridType *grids[] = { curGrid, newGrid };
+
+#pragma omp parallel
+        {
+            const long numThreads = omp_get_num_threads();
+            const long thread = omp_get_thread_num();
+
+            for (unsigned i = 0; i < count; ++i) {
+                if (!pointToPoint) {
+#pragma omp barrier
+#pragma omp single
+                    HaloPaddedGridHelpers::RefreshHalo<GridType>()(grids[i % 2]);
+                }
+
+                // chunks are assigned round-robin, which is
+                // deadlock-free as chunks only ever wait for the
+                // previous nano step:
+                for (long c = thread; c < numChunks; c += numThreads) {
+                    if (pointToPoint) {
+                        waitForChunk(progress, c - 1, i);
+                        waitForChunk(progress, c + 1, i);
+                    }
+
+                    TiledUpdateFunctor<CELL_TYPE>()(
+                        chunks[c],
+                        Coord<DIM>(),
+                        Coord<DIM>(),
+                        *grids[i % 2],
+                        grids[(i + 1) % 2],
+                        i % NANO_STEPS);
+
+                    if (pointToPoint) {
+#pragma omp flush
+#pragma omp atomic write
+                        progress[c] = i + 1;
+                    }
+                }
+            }
+        }
+
+        if (count % 2) {
+            std::swap(curGrid, newGrid);
+        }
+#else
+        for (unsigned i = 0; i < count; ++i) {
+            nanoStep(i % NANO_STEPS);
+        }
+#endif
+    }
+
+    /**
+     * Waits until the given chunk (wrapping around at the ends, as
+     * the grid may be periodic) has completed nanoSteps nano steps.
+     */
+    static void waitForChunk(std::vector<unsigned>& progress, long chunk, const unsigned nanoSteps)
+    {
+        long numChunks = progress.size();
+        chunk = (chunk + numChunks) % numChunks;
+
+        for (;;) {
+            unsigned chunkProgress;
+#pragma omp atomic read
+            chunkProgress = progress[chunk];
+
+            if (chunkProgress >= nanoSteps) {
+                break;
+            }
+        }
+
+#pragma omp flush
+    }
+
+    /**
+     * Splits the grid into one chunk of planes per thread. Chunks
+     * are at least as thick as the stencil's radius so that each
+     * chunk only depends on its immediate neighbors.
+     */
+    void initChunks()
+    {
+        chunks.clear();
+        if (!persistentThreadTeam) {
+            return;
+        }
+
+        std::size_t maxThreads = 1;
+#ifdef LIBGEODECOMP_WITH_THREADS
+        maxThreads = omp_get_max_threads();
+#endif
+        std::size_t numPlanes = updateRegion.numPlanes();
+        std::size_t minPlanes = (std::max)(1, int(Stencil::RADIUS));
+        std::size_t numChunks = (std::min)(maxThreads, numPlanes / minPlanes);
+        numChunks = (std::max)(numChunks, std::size_t(1));
+
+        for (std::size_t c = 0; c < numChunks; ++c) {
+            Region<DIM> chunk;
+            typename Region<DIM>::StreakIterator end = updateRegion.planeStreakIterator((c + 1) * numPlanes / numChunks);
+            for (typename Region<DIM>::StreakIterator i = updateRegion.planeStreakIterator(c * numPlanes / numChunks);
+                 i != end;
+                 ++i) {
+                chunk << *i;
+            }
+
+            if (tileDimensions == Coord<DIM>()) {
+                chunks << std::vector<Region<DIM> >(1, chunk);
+            } else {
+                chunks << RegionTiler<DIM>::tile(chunk, tileDimensions);
+            }
+        }
+    }
+
+    /**
+     * returns the number of upcoming steps for which neither
+     * Steerers nor Writers need to be notified.
+     */
+    unsigned quietSteps() const
+    {
+        unsigned ret = 0;
+        for (unsigned s = stepNum; s < initializer->maxSteps(); ++s, ++ret) {
+            for (std::size_t i = 0; i < steerers.size(); ++i) {
+                if ((s % steerers[i]->getPeriod()) == 0) {
+                    return ret;
+                }
+            }
+            for (std::size_t i = 0; i < writers.size(); ++i) {
+                if (((s + 1) % writers[i]->getPeriod()) == 0) {
+                    return ret;
+                }
+            }
+        }
+
+        return ret;
+    }
+
     /**
      * notifies all registered Writers
      */
@@ -167,6 +442,7 @@ protected:
         for (unsigned i = 0; i < steerers.size(); ++i) {
             if (stepNum % steerers[i]->getPeriod() == 0) {
                 steerers[i]->nextStep(curGrid, simArea, gridDim, getStep(), event, 0, true, feedback);
+                activityTracker.reset();
             }
         }
         // fixme: apply SteererFeedback!
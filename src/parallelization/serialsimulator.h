@@ -7,6 +7,7 @@
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
+#include <libgeodecomp/storage/activitytracker.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
@@ -28,7 +29,8 @@ public:
     typedef typename MonolithicSimulator<CELL_TYPE>::Topology Topology;
     typedef typename MonolithicSimulator<CELL_TYPE>::WriterVector WriterVector;
     typedef typename APITraits::SelectSoA<CELL_TYPE>::Value SupportsSoA;
-    typedef typename GridTypeSelector<CELL_TYPE, Topology, false, SupportsSoA>::Value GridType;
+    typedef typename MonolithicGridTypeSelector<CELL_TYPE, Topology, SupportsSoA>::Value GridType;
+    typedef typename APITraits::SelectStencil<CELL_TYPE>::Value Stencil;
     typedef typename Steerer<CELL_TYPE>::SteererFeedback SteererFeedback;
 
     static const int DIM = Topology::DIM;
@@ -58,6 +60,7 @@ public:
         // fixme: refactor serialsim, cudasim to reduce code duplication
         CoordBox<DIM> box = curGrid->boundingBox();
         simArea << box;
+        updateRegion << box;
     }
 
     virtual ~SerialSimulator()
@@ -95,6 +98,7 @@ public:
     virtual void run()
     {
         initializer->grid(curGrid);
+        activityTracker.reset();
         stepNum = initializer->startStep();
         setIORegions();
 
@@ -126,12 +130,24 @@ protected:
     GridType *curGrid;
     GridType *newGrid;
     Region<DIM> simArea;
+    // differs from simArea only for sparse grids, which update just
+    // their allocated bricks:
+    Region<DIM> updateRegion;
+    ActivityTracker<CELL_TYPE> activityTracker;
 
     void nanoStep(const unsigned& nanoStep)
     {
         TimeCompute t(&chronometer);
 
-        UpdateFunctor<CELL_TYPE>()(simArea, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
+        // initializers, steerers, and the previous nano step may have
+        // modified the grid, so a halo frame may need to be updated:
+        HaloPaddedGridHelpers::RefreshHalo<GridType>()(curGrid);
+        // ...and sparse grids may need to allocate bricks next to
+        // active cells:
+        SparseBrickedGridHelpers::SyncBricks<GridType>()(curGrid, newGrid, &updateRegion, Stencil::RADIUS);
+        const Region<DIM>& activeRegion = activityTracker.updateRegion(updateRegion);
+        UpdateFunctor<CELL_TYPE>()(activeRegion, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
+        activityTracker.track(*newGrid, activeRegion);
         std::swap(curGrid, newGrid);
     }
 
@@ -172,6 +188,7 @@ protected:
                     0,
                     true,
                     feedback);
+                activityTracker.reset();
             }
         }
         // fixme: apply SteererFeedback!
@@ -0,0 +1,14 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hiparsimulatortest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}serialsimulatortest.cpp
+  ${RELATIVE_PATH}simulatortest.cpp
+  ${RELATIVE_PATH}stripingsimulatortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hiparsimulatortest.h
+  ${RELATIVE_PATH}serialsimulatortest.h
+  ${RELATIVE_PATH}simulatortest.h
+  ${RELATIVE_PATH}stripingsimulatortest.h
+)
@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_1/hiparsimulatortest.h"
+
+static HiParSimulatorTest suite_HiParSimulatorTest;
+
+static CxxTest::List Tests_HiParSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_1/hiparsimulatortest.h", 21, "HiParSimulatorTest", suite_HiParSimulatorTest, Tests_HiParSimulatorTest );
+
+static class TestDescription_suite_HiParSimulatorTest_testInitialWeights : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testInitialWeights() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 57, "testInitialWeights" ) {}
+ void runTest() { suite_HiParSimulatorTest.testInitialWeights(); }
+} testDescription_suite_HiParSimulatorTest_testInitialWeights;
+
+static class TestDescription_suite_HiParSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 94, "testStep" ) {}
+ void runTest() { suite_HiParSimulatorTest.testStep(); }
+} testDescription_suite_HiParSimulatorTest_testStep;
+
+static class TestDescription_suite_HiParSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 120, "testRun" ) {}
+ void runTest() { suite_HiParSimulatorTest.testRun(); }
+} testDescription_suite_HiParSimulatorTest_testRun;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 147, "testSteererCallback" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererCallback(); }
+} testDescription_suite_HiParSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 169, "testSteererFunctionality" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality;
+
@@ -144,6 +144,21 @@ public:
         }
     }
 
+    void testAsyncWriter()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        TestInitializer<TestCell<2> > *init = new TestInitializer<TestCell<2> >(
+            dim, maxSteps, firstStep);
+        SimulatorType sim(init, 0, loadBalancingPeriod, ghostzZoneWidth);
+        boost::shared_ptr<MockWriter<>::EventsStore> asyncEvents(new MockWriter<>::EventsStore);
+        sim.addAsyncWriter(new MockWriter<>(asyncEvents), 3);
+        sim.run();
+
+        s->run();
+        TS_ASSERT_EQUALS(*events, *asyncEvents);
+#endif
+    }
+
     void testSteererCallback()
     {
         boost::shared_ptr<MockSteererType::EventsStore> events(new MockSteererType::EventsStore);
@@ -0,0 +1,104 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SerialSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_1/serialsimulatortest.h"
+
+static SerialSimulatorTest suite_SerialSimulatorTest;
+
+static CxxTest::List Tests_SerialSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SerialSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_1/serialsimulatortest.h", 20, "SerialSimulatorTest", suite_SerialSimulatorTest, Tests_SerialSimulatorTest );
+
+static class TestDescription_suite_SerialSimulatorTest_testInitialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testInitialization() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 45, "testInitialization" ) {}
+ void runTest() { suite_SerialSimulatorTest.testInitialization(); }
+} testDescription_suite_SerialSimulatorTest_testInitialization;
+
+static class TestDescription_suite_SerialSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 52, "testStep" ) {}
+ void runTest() { suite_SerialSimulatorTest.testStep(); }
+} testDescription_suite_SerialSimulatorTest_testStep;
+
+static class TestDescription_suite_SerialSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 63, "testRun" ) {}
+ void runTest() { suite_SerialSimulatorTest.testRun(); }
+} testDescription_suite_SerialSimulatorTest_testRun;
+
+static class TestDescription_suite_SerialSimulatorTest_testWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testWriterInvocation() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 73, "testWriterInvocation" ) {}
+ void runTest() { suite_SerialSimulatorTest.testWriterInvocation(); }
+} testDescription_suite_SerialSimulatorTest_testWriterInvocation;
+
+static class TestDescription_suite_SerialSimulatorTest_testDeleteInitializer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testDeleteInitializer() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 80, "testDeleteInitializer" ) {}
+ void runTest() { suite_SerialSimulatorTest.testDeleteInitializer(); }
+} testDescription_suite_SerialSimulatorTest_testDeleteInitializer;
+
+static class TestDescription_suite_SerialSimulatorTest_testRegisterWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testRegisterWriter() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 91, "testRegisterWriter" ) {}
+ void runTest() { suite_SerialSimulatorTest.testRegisterWriter(); }
+} testDescription_suite_SerialSimulatorTest_testRegisterWriter;
+
+static class TestDescription_suite_SerialSimulatorTest_testSerialSimulatorShouldCallBackWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testSerialSimulatorShouldCallBackWriter() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 100, "testSerialSimulatorShouldCallBackWriter" ) {}
+ void runTest() { suite_SerialSimulatorTest.testSerialSimulatorShouldCallBackWriter(); }
+} testDescription_suite_SerialSimulatorTest_testSerialSimulatorShouldCallBackWriter;
+
+static class TestDescription_suite_SerialSimulatorTest_testRunMustResetGridPriorToSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testRunMustResetGridPriorToSimulation() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 118, "testRunMustResetGridPriorToSimulation" ) {}
+ void runTest() { suite_SerialSimulatorTest.testRunMustResetGridPriorToSimulation(); }
+} testDescription_suite_SerialSimulatorTest_testRunMustResetGridPriorToSimulation;
+
+static class TestDescription_suite_SerialSimulatorTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_test3D() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 150, "test3D" ) {}
+ void runTest() { suite_SerialSimulatorTest.test3D(); }
+} testDescription_suite_SerialSimulatorTest_test3D;
+
+static class TestDescription_suite_SerialSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 165, "testSteererCallback" ) {}
+ void runTest() { suite_SerialSimulatorTest.testSteererCallback(); }
+} testDescription_suite_SerialSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_SerialSimulatorTest_testSteererCanTerminateSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testSteererCanTerminateSimulation() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 187, "testSteererCanTerminateSimulation" ) {}
+ void runTest() { suite_SerialSimulatorTest.testSteererCanTerminateSimulation(); }
+} testDescription_suite_SerialSimulatorTest_testSteererCanTerminateSimulation;
+
+static class TestDescription_suite_SerialSimulatorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerialSimulatorTest_testSoA() : CxxTest::RealTestDescription( Tests_SerialSimulatorTest, suiteDescription_SerialSimulatorTest, 203, "testSoA" ) {}
+ void runTest() { suite_SerialSimulatorTest.testSoA(); }
+} testDescription_suite_SerialSimulatorTest_testSoA;
+
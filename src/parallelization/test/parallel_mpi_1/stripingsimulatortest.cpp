@@ -0,0 +1,99 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StripingSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_1/stripingsimulatortest.h"
+
+static StripingSimulatorTest suite_StripingSimulatorTest;
+
+static CxxTest::List Tests_StripingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StripingSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_1/stripingsimulatortest.h", 38, "StripingSimulatorTest", suite_StripingSimulatorTest, Tests_StripingSimulatorTest );
+
+static class TestDescription_suite_StripingSimulatorTest_testBadInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBadInit() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 60, "testBadInit" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBadInit(); }
+} testDescription_suite_StripingSimulatorTest_testBadInit;
+
+static class TestDescription_suite_StripingSimulatorTest_testDeleteBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testDeleteBalancer() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 70, "testDeleteBalancer" ) {}
+ void runTest() { suite_StripingSimulatorTest.testDeleteBalancer(); }
+} testDescription_suite_StripingSimulatorTest_testDeleteBalancer;
+
+static class TestDescription_suite_StripingSimulatorTest_testPartition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testPartition() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 80, "testPartition" ) {}
+ void runTest() { suite_StripingSimulatorTest.testPartition(); }
+} testDescription_suite_StripingSimulatorTest_testPartition;
+
+static class TestDescription_suite_StripingSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 118, "testStep" ) {}
+ void runTest() { suite_StripingSimulatorTest.testStep(); }
+} testDescription_suite_StripingSimulatorTest_testStep;
+
+static class TestDescription_suite_StripingSimulatorTest_testStripeWidth : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testStripeWidth() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 137, "testStripeWidth" ) {}
+ void runTest() { suite_StripingSimulatorTest.testStripeWidth(); }
+} testDescription_suite_StripingSimulatorTest_testStripeWidth;
+
+static class TestDescription_suite_StripingSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 143, "testRun" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRun(); }
+} testDescription_suite_StripingSimulatorTest_testRun;
+
+static class TestDescription_suite_StripingSimulatorTest_testRunMustResetGridPriorToSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRunMustResetGridPriorToSimulation() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 153, "testRunMustResetGridPriorToSimulation" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRunMustResetGridPriorToSimulation(); }
+} testDescription_suite_StripingSimulatorTest_testRunMustResetGridPriorToSimulation;
+
+static class TestDescription_suite_StripingSimulatorTest_testPartitionsToWorkloadsAndBackAgain : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testPartitionsToWorkloadsAndBackAgain() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 164, "testPartitionsToWorkloadsAndBackAgain" ) {}
+ void runTest() { suite_StripingSimulatorTest.testPartitionsToWorkloadsAndBackAgain(); }
+} testDescription_suite_StripingSimulatorTest_testPartitionsToWorkloadsAndBackAgain;
+
+static class TestDescription_suite_StripingSimulatorTest_testBadBalancerSum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBadBalancerSum() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 188, "testBadBalancerSum" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBadBalancerSum(); }
+} testDescription_suite_StripingSimulatorTest_testBadBalancerSum;
+
+static class TestDescription_suite_StripingSimulatorTest_testBadBalancerNum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBadBalancerNum() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 195, "testBadBalancerNum" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBadBalancerNum(); }
+} testDescription_suite_StripingSimulatorTest_testBadBalancerNum;
+
+static class TestDescription_suite_StripingSimulatorTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_test3D() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 202, "test3D" ) {}
+ void runTest() { suite_StripingSimulatorTest.test3D(); }
+} testDescription_suite_StripingSimulatorTest_test3D;
+
@@ -515,6 +515,29 @@ public:
         sim->run();
     }
 
+    void testHierarchicalPartitionOnSubCommunicator()
+    {
+        typedef HierarchicalPartition<2, StripingPartition<2> > PartitionType;
+
+        // two simulators with two ranks each, the node IDs need to
+        // match the ranks of the simulator's communicator:
+        MPILayer world;
+        MPI_Comm half;
+        MPI_Comm_split(MPI_COMM_WORLD, world.rank() / 2, world.rank(), &half);
+
+        CoordBox<2> box(Coord<2>(), Coord<2>(20, 10));
+        std::vector<std::size_t> weights(2, 100);
+        boost::shared_ptr<PartitionType> partition =
+            HiParSimulatorHelpers::PartitionBuilder<PartitionType>()(box, weights, Adjacency(), half);
+
+        Region<2> expected;
+        expected << box;
+        TS_ASSERT_EQUALS(expected, partition->getRegion(0) + partition->getRegion(1));
+        TS_ASSERT_EQUALS(std::size_t(100), partition->getRegion(0).size());
+
+        MPI_Comm_free(&half);
+    }
+
 private:
     boost::shared_ptr<SimulatorType> sim;
     Coord<2> dim;
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OpenMPSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h"
+
+static OpenMPSimulatorTest suite_OpenMPSimulatorTest;
+
+static CxxTest::List Tests_OpenMPSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OpenMPSimulatorTest( "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h", 92, "OpenMPSimulatorTest", suite_OpenMPSimulatorTest, Tests_OpenMPSimulatorTest );
+
+static class TestDescription_suite_OpenMPSimulatorTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testBasic() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 96, "testBasic" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testBasic(); }
+} testDescription_suite_OpenMPSimulatorTest_testBasic;
+
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <libflatarray/short_vec.hpp>
 #include <libgeodecomp/io/simpleinitializer.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/io/testwriter.h>
 #include <libgeodecomp/io/tracingwriter.h>
 #include <libgeodecomp/parallelization/openmpsimulator.h>
 
@@ -105,6 +107,47 @@ public:
         sim.run();
 
     }
+
+    void testTiling()
+    {
+        Coord<3> dim(20, 30, 40);
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >(dim, 11);
+        OpenMPSimulator<TestCell<3> > sim(init);
+        TS_ASSERT_EQUALS(Coord<3>(), sim.getTileDimensions());
+
+        sim.setTileDimensions(Coord<3>(1, 7, 5));
+        TS_ASSERT_EQUALS(std::size_t(5 * 8), sim.tiles.size());
+
+        // TestWriter verifies that each cell has seen all of its
+        // neighbors at the correct time step:
+        sim.addWriter(new TestWriter<TestCell<3> >(3, init->startStep(), init->maxSteps()));
+        sim.run();
+    }
+
+    void testPersistentThreadTeam2D()
+    {
+        // cube topology, so threads synchronize point-to-point:
+        TestInitializer<TestCell<2> > *init = new TestInitializer<TestCell<2> >(Coord<2>(31, 23), 21);
+        OpenMPSimulator<TestCell<2> > sim(init);
+        sim.setPersistentThreadTeam(true);
+        TS_ASSERT_EQUALS(std::size_t(omp_get_max_threads()), sim.chunks.size());
+
+        sim.addWriter(new TestWriter<TestCell<2> >(5, init->startStep(), init->maxSteps()));
+        sim.run();
+    }
+
+    void testPersistentThreadTeam3D()
+    {
+        // torus topology, which results in a HaloPaddedGrid, so
+        // threads need to synchronize via barriers:
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >(Coord<3>(13, 12, 11), 11);
+        OpenMPSimulator<TestCell<3> > sim(init);
+        sim.setPersistentThreadTeam(true);
+        sim.setTileDimensions(Coord<3>(1, 5, 5));
+
+        sim.addWriter(new TestWriter<TestCell<3> >(3, init->startStep(), init->maxSteps()));
+        sim.run();
+    }
 };
 
 }
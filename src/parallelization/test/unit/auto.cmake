@@ -0,0 +1,10 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}autotuningsimulatorwithoutcudatest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}autotuningsimulatorwithcudatest.h
+  ${RELATIVE_PATH}autotuningsimulatorwithoutcudatest.h
+  ${RELATIVE_PATH}cudasimulatortest.h
+)
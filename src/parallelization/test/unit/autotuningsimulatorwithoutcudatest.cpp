@@ -0,0 +1,98 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AutotuningSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h"
+
+static AutotuningSimulatorTest suite_AutotuningSimulatorTest;
+
+static CxxTest::List Tests_AutotuningSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AutotuningSimulatorTest( "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h", 78, "AutotuningSimulatorTest", suite_AutotuningSimulatorTest, Tests_AutotuningSimulatorTest );
+
+static class TestDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 105, "testBasicSimplexOptimized" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testBasicSimplexOptimized(); }
+} testDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 120, "testAddOwnSimulations" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testAddOwnSimulations(); }
+} testDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testManuallyParamterized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testManuallyParamterized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 146, "testManuallyParamterized" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testManuallyParamterized(); }
+} testDescription_suite_AutotuningSimulatorTest_testManuallyParamterized;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testInvalidArguments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testInvalidArguments() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 170, "testInvalidArguments" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testInvalidArguments(); }
+} testDescription_suite_AutotuningSimulatorTest_testInvalidArguments;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testAddWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testAddWriter() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 196, "testAddWriter" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testAddWriter(); }
+} testDescription_suite_AutotuningSimulatorTest_testAddWriter;
+
+static SimulationFactoryTest suite_SimulationFactoryTest;
+
+static CxxTest::List Tests_SimulationFactoryTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SimulationFactoryTest( "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h", 215, "SimulationFactoryTest", suite_SimulationFactoryTest, Tests_SimulationFactoryTest );
+
+static class TestDescription_suite_SimulationFactoryTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testBasic() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 237, "testBasic" ) {}
+ void runTest() { suite_SimulationFactoryTest.testBasic(); }
+} testDescription_suite_SimulationFactoryTest_testBasic;
+
+static class TestDescription_suite_SimulationFactoryTest_testCacheBlockingFitness : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testCacheBlockingFitness() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 248, "testCacheBlockingFitness" ) {}
+ void runTest() { suite_SimulationFactoryTest.testCacheBlockingFitness(); }
+} testDescription_suite_SimulationFactoryTest_testCacheBlockingFitness;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToSimulator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToSimulator() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 262, "testAddWriterToSimulator" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToSimulator(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToSimulator;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 276, "testAddWriterToSerialSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToSerialSimulationFactory(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 286, "testAddWriterToCacheBlockingSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToCacheBlockingSimulationFactory(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory;
+
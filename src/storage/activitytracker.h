@@ -0,0 +1,176 @@
+#ifndef LIBGEODECOMP_STORAGE_ACTIVITYTRACKER_H
+#define LIBGEODECOMP_STORAGE_ACTIVITYTRACKER_H
+
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Simulators use this class to restrict updates to those cells
+ * which may actually change: only cells within the stencil's radius
+ * of a cell which changed during the previous nano step (as reported
+ * by the cell's hasChanged() member, see
+ * APITraits::HasActivityTracking) need to be updated. For
+ * front-propagation models this reduces the work per step from the
+ * size of the domain to the size of the front.
+ *
+ * Skipping a cell is sound even though Simulators flip between two
+ * grids: a cell which is skipped didn't change during the previous
+ * nano step, so the target grid still holds its current value.
+ *
+ * Only the SerialSimulator and the OpenMPSimulator make use of the
+ * tracker so far. The distributed Steppers (VanillaStepper et al.)
+ * still update their full inner sets and ghost zones: restricting
+ * their halos would require the neighbors to exchange their
+ * activity fronts alongside the ghost cells.
+ *
+ * This is the default implementation for cells which don't report
+ * changes, which always yields the whole simulation area.
+ */
+template<typename CELL, typename HAS_ACTIVITY_TRACKING = typename APITraits::SelectActivityTracking<CELL>::Value>
+class ActivityTracker
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    static const int DIM = Topology::DIM;
+    static const bool ENABLED = false;
+
+    inline void reset()
+    {}
+
+    inline const Region<DIM>& updateRegion(const Region<DIM>& simArea)
+    {
+        return simArea;
+    }
+
+    inline void track(
+        const GridBase<CELL, DIM>& /* unused: grid */,
+        const Region<DIM>& /* unused: updatedRegion */,
+        bool /* unused: enableOpenMP */ = false)
+    {}
+};
+
+/**
+ * see above
+ */
+template<typename CELL>
+class ActivityTracker<CELL, APITraits::TrueType>
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    typedef typename APITraits::SelectStencil<CELL>::Value Stencil;
+    static const int DIM = Topology::DIM;
+    static const bool ENABLED = true;
+
+    ActivityTracker() :
+        complete(true)
+    {}
+
+    /**
+     * Marks all cells as active. Needs to be called whenever cells
+     * are modified outside of the update (e.g. by Initializers or
+     * Steerers).
+     */
+    inline void reset()
+    {
+        complete = true;
+    }
+
+    /**
+     * The cells which need to be updated in the next nano step.
+     */
+    inline const Region<DIM>& updateRegion(const Region<DIM>& simArea)
+    {
+        if (complete) {
+            return simArea;
+        }
+
+        clippedRegion = activeRegion & simArea;
+        return clippedRegion;
+    }
+
+    /**
+     * Collects the cells within updatedRegion which have been
+     * changed by the nano step which just wrote them to grid. With
+     * enableOpenMP set, chunks of streaks are scanned in parallel,
+     * so that only the (usually much smaller) set of changed cells
+     * is processed serially.
+     */
+    void track(const GridBase<CELL, DIM>& grid, const Region<DIM>& updatedRegion, bool enableOpenMP = false)
+    {
+        long numChunks = (updatedRegion.numStreaks() + STREAKS_PER_CHUNK - 1) / STREAKS_PER_CHUNK;
+        std::vector<std::vector<Streak<DIM> > > changedRuns(numChunks);
+
+#pragma omp parallel for schedule(dynamic) if(enableOpenMP)
+        for (long chunk = 0; chunk < numChunks; ++chunk) {
+            scan(grid, updatedRegion, chunk, &changedRuns[chunk]);
+        }
+
+        // chunks and the runs within are ordered, so this only appends:
+        Region<DIM> changedCells;
+        for (long chunk = 0; chunk < numChunks; ++chunk) {
+            for (typename std::vector<Streak<DIM> >::iterator i = changedRuns[chunk].begin();
+                 i != changedRuns[chunk].end();
+                 ++i) {
+                changedCells << *i;
+            }
+        }
+
+        activeRegion = changedCells.expandWithTopology(
+            Stencil::RADIUS,
+            grid.boundingBox().dimensions,
+            Topology());
+        complete = false;
+    }
+
+private:
+    static const std::size_t STREAKS_PER_CHUNK = 256;
+
+    bool complete;
+    Region<DIM> activeRegion;
+    Region<DIM> clippedRegion;
+
+    /**
+     * Appends the runs of changed cells within the chunk'th block of
+     * streaks of region to runs.
+     */
+    static void scan(
+        const GridBase<CELL, DIM>& grid,
+        const Region<DIM>& region,
+        std::size_t chunk,
+        std::vector<Streak<DIM> > *runs)
+    {
+        std::vector<CELL> buffer;
+        typename Region<DIM>::StreakIterator i = region[chunk * STREAKS_PER_CHUNK];
+        typename Region<DIM>::StreakIterator end = region[(chunk + 1) * STREAKS_PER_CHUNK];
+
+        for (; i != end; ++i) {
+            buffer.resize(i->length());
+            grid.get(*i, &buffer[0]);
+
+            Streak<DIM> run(i->origin, i->origin.x());
+            for (int x = 0; x < i->length(); ++x) {
+                if (buffer[x].hasChanged()) {
+                    if (run.endX == run.origin.x()) {
+                        run.origin.x() = i->origin.x() + x;
+                    }
+                    run.endX = i->origin.x() + x + 1;
+                } else if (run.endX != run.origin.x()) {
+                    runs->push_back(run);
+                    run.origin.x() = run.endX;
+                }
+            }
+            if (run.endX != run.origin.x()) {
+                runs->push_back(run);
+            }
+        }
+    }
+};
+
+}
+
+#endif
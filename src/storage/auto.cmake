@@ -0,0 +1,69 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}image.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}activitytracker.h
+  ${RELATIVE_PATH}arrayfilter.h
+  ${RELATIVE_PATH}boxcell.h
+  ${RELATIVE_PATH}brickedgrid.h
+  ${RELATIVE_PATH}brickedneighborhood.h
+  ${RELATIVE_PATH}collectioninterface.h
+  ${RELATIVE_PATH}containercell.h
+  ${RELATIVE_PATH}coordmap.h
+  ${RELATIVE_PATH}copyregion.h
+  ${RELATIVE_PATH}cudaarray.h
+  ${RELATIVE_PATH}cudagrid.h
+  ${RELATIVE_PATH}cudagridtypeselector.h
+  ${RELATIVE_PATH}cudasoagrid.h
+  ${RELATIVE_PATH}cudaupdatefunctor.h
+  ${RELATIVE_PATH}dataaccessor.h
+  ${RELATIVE_PATH}defaultarrayfilter.h
+  ${RELATIVE_PATH}defaultcudaarrayfilter.h
+  ${RELATIVE_PATH}defaultcudafilter.h
+  ${RELATIVE_PATH}defaultfilter.h
+  ${RELATIVE_PATH}displacedgrid.h
+  ${RELATIVE_PATH}filter.h
+  ${RELATIVE_PATH}filterbase.h
+  ${RELATIVE_PATH}firsttouchallocator.h
+  ${RELATIVE_PATH}fixedarray.h
+  ${RELATIVE_PATH}fixedneighborhood.h
+  ${RELATIVE_PATH}fixedneighborhoodupdatefunctor.h
+  ${RELATIVE_PATH}grid.h
+  ${RELATIVE_PATH}gridbase.h
+  ${RELATIVE_PATH}gridtypeselector.h
+  ${RELATIVE_PATH}gridvecconv.h
+  ${RELATIVE_PATH}halopaddedgrid.h
+  ${RELATIVE_PATH}image.h
+  ${RELATIVE_PATH}linepointerassembly.h
+  ${RELATIVE_PATH}linepointerneighborhood.h
+  ${RELATIVE_PATH}linepointerupdatefunctor.h
+  ${RELATIVE_PATH}memorylocation.h
+  ${RELATIVE_PATH}meshlessadapter.h
+  ${RELATIVE_PATH}mockpatchaccepter.h
+  ${RELATIVE_PATH}multicontainercell.h
+  ${RELATIVE_PATH}neighborhoodadapter.h
+  ${RELATIVE_PATH}neighborhooditerator.h
+  ${RELATIVE_PATH}patchaccepter.h
+  ${RELATIVE_PATH}patchbuffer.h
+  ${RELATIVE_PATH}patchbufferfixed.h
+  ${RELATIVE_PATH}patchprovider.h
+  ${RELATIVE_PATH}pointerneighborhood.h
+  ${RELATIVE_PATH}proxygrid.h
+  ${RELATIVE_PATH}selector.h
+  ${RELATIVE_PATH}sellcsigmasparsematrixcontainer.h
+  ${RELATIVE_PATH}serializationbuffer.h
+  ${RELATIVE_PATH}simplearrayfilter.h
+  ${RELATIVE_PATH}simplefilter.h
+  ${RELATIVE_PATH}soagrid.h
+  ${RELATIVE_PATH}sparsebrickedgrid.h
+  ${RELATIVE_PATH}tiledupdatefunctor.h
+  ${RELATIVE_PATH}unstructuredgrid.h
+  ${RELATIVE_PATH}unstructuredneighborhood.h
+  ${RELATIVE_PATH}unstructuredsoagrid.h
+  ${RELATIVE_PATH}unstructuredsoaneighborhood.h
+  ${RELATIVE_PATH}unstructuredupdatefunctor.h
+  ${RELATIVE_PATH}updatefunctor.h
+  ${RELATIVE_PATH}updatefunctormacros.h
+  ${RELATIVE_PATH}updatefunctortestbase.h
+  ${RELATIVE_PATH}vanillaupdatefunctor.h
+)
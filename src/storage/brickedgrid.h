@@ -0,0 +1,352 @@
+#ifndef LIBGEODECOMP_STORAGE_BRICKEDGRID_H
+#define LIBGEODECOMP_STORAGE_BRICKEDGRID_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/storage/brickedneighborhood.h>
+#include <libgeodecomp/storage/firsttouchallocator.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace BrickedGridHelpers {
+
+/**
+ * Number of cells per brick.
+ */
+template<int DIM, int BRICK_SIZE>
+class BrickVolume
+{
+public:
+    static const int VALUE = BRICK_SIZE * BrickVolume<DIM - 1, BRICK_SIZE>::VALUE;
+};
+
+/**
+ * see above
+ */
+template<int BRICK_SIZE>
+class BrickVolume<0, BRICK_SIZE>
+{
+public:
+    static const int VALUE = 1;
+};
+
+}
+
+/**
+ * A grid which stores its cells in bricks of BRICK_SIZE^DIM cells
+ * (i.e. 8x8x8 by default). Each brick is stored contiguously and the
+ * bricks themselves are arranged along a Z-order curve (Morton
+ * order). For stencils which reach far along the Y and Z axes this
+ * keeps the neighbors of a cell within few pages and cache lines,
+ * whereas a row-major grid would spread them over
+ * dimensions.x() * dimensions.y() cells.
+ *
+ * The price is that rows are no longer contiguous: streak-wise
+ * accesses are split at brick boundaries and the grid can't be used
+ * with update paths which rely on pointer arithmetic along the X
+ * axis (i.e. FixedCoordsOnlyUpdate and SoA). Its
+ * neighborhood (BrickedNeighborhood) resolves all accesses within a
+ * brick via offsets from the center cell.
+ *
+ * Accesses outside of the bounding box are handled according to
+ * TOPOLOGY, just like in Grid: periodic axes wrap around, all others
+ * yield the edge cell.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, int BRICK_SIZE_PARAM = 8>
+class BrickedGrid : public GridBase<CELL_TYPE, TOPOLOGY::DIM>
+{
+public:
+    friend class BrickedGridTest;
+
+    const static int DIM = TOPOLOGY::DIM;
+    const static int BRICK_SIZE = BRICK_SIZE_PARAM;
+    const static int BRICK_VOLUME = BrickedGridHelpers::BrickVolume<DIM, BRICK_SIZE>::VALUE;
+
+    BOOST_STATIC_ASSERT((BRICK_SIZE > 0) && ((BRICK_SIZE & (BRICK_SIZE - 1)) == 0));
+
+    typedef CELL_TYPE Cell;
+    typedef TOPOLOGY Topology;
+    typedef BrickedNeighborhood<CELL_TYPE, BrickedGrid> NeighborhoodType;
+    typedef std::vector<CELL_TYPE, FirstTouchAllocator<CELL_TYPE, 64> > CellVector;
+
+    explicit BrickedGrid(
+        const CoordBox<DIM>& box = CoordBox<DIM>(),
+        const CELL_TYPE& defaultCell = CELL_TYPE(),
+        const CELL_TYPE& edgeCell = CELL_TYPE()) :
+        edgeCell(edgeCell)
+    {
+        resize(box);
+        std::fill(cells.begin(), cells.end(), defaultCell);
+    }
+
+    inline void resize(const CoordBox<DIM>& box)
+    {
+        origin = box.origin;
+        dimensions = box.dimensions;
+
+        std::size_t numBricks = 1;
+        for (int i = 0; i < DIM; ++i) {
+            bricks[i] = (dimensions[i] + BRICK_SIZE - 1) / BRICK_SIZE;
+            numBricks *= bricks[i];
+        }
+
+        initBrickSlots(numBricks);
+        cells.resize(numBricks * BRICK_VOLUME);
+    }
+
+    inline CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord)
+    {
+        Coord<DIM> relativeCoord = absoluteCoord - origin;
+        if (Topology::isOutOfBounds(relativeCoord, dimensions)) {
+            return edgeCell;
+        }
+
+        return cells[index(Topology::normalize(relativeCoord, dimensions))];
+    }
+
+    inline const CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord) const
+    {
+        return (const_cast<BrickedGrid&>(*this))[absoluteCoord];
+    }
+
+    /**
+     * Direct access to the storage of the cell at the given
+     * coordinate (relative to the grid's origin), which needs to be
+     * within the grid's bounds. Only the BRICK_SIZE - 1 - (coord %
+     * BRICK_SIZE) succeeding cells along the X axis are guaranteed
+     * to be stored behind it.
+     */
+    inline CELL_TYPE *cellAddress(const Coord<DIM>& relativeCoord)
+    {
+        return &cells[index(relativeCoord)];
+    }
+
+    inline const CELL_TYPE *cellAddress(const Coord<DIM>& relativeCoord) const
+    {
+        return &cells[index(relativeCoord)];
+    }
+
+    inline NeighborhoodType getNeighborhood(const Coord<DIM>& center) const
+    {
+        return NeighborhoodType(center, this);
+    }
+
+    virtual void set(const Coord<DIM>& coord, const CELL_TYPE& cell)
+    {
+        (*this)[coord] = cell;
+    }
+
+    virtual void set(const Streak<DIM>& streak, const CELL_TYPE *cells)
+    {
+        Coord<DIM> relativeCoord = streak.origin - origin;
+        int endX = streak.endX - origin.x();
+
+        while (relativeCoord.x() < endX) {
+            int length = segmentLength(relativeCoord, endX);
+            std::copy(cells, cells + length, cellAddress(relativeCoord));
+            cells += length;
+            relativeCoord.x() += length;
+        }
+    }
+
+    virtual CELL_TYPE get(const Coord<DIM>& coord) const
+    {
+        return (*this)[coord];
+    }
+
+    virtual void get(const Streak<DIM>& streak, CELL_TYPE *cells) const
+    {
+        Coord<DIM> relativeCoord = streak.origin - origin;
+        int endX = streak.endX - origin.x();
+
+        while (relativeCoord.x() < endX) {
+            int length = segmentLength(relativeCoord, endX);
+            const CELL_TYPE *source = cellAddress(relativeCoord);
+            std::copy(source, source + length, cells);
+            cells += length;
+            relativeCoord.x() += length;
+        }
+    }
+
+    virtual void setEdge(const CELL_TYPE& cell)
+    {
+        edgeCell = cell;
+    }
+
+    virtual const CELL_TYPE& getEdge() const
+    {
+        return edgeCell;
+    }
+
+    inline const Coord<DIM>& getOrigin() const
+    {
+        return origin;
+    }
+
+    inline const Coord<DIM>& getDimensions() const
+    {
+        return dimensions;
+    }
+
+    virtual CoordBox<DIM> boundingBox() const
+    {
+        return CoordBox<DIM>(origin, dimensions);
+    }
+
+    inline std::string toString() const
+    {
+        std::ostringstream message;
+        message << "BrickedGrid<" << DIM << ", " << BRICK_SIZE << ">(\n"
+                << "boundingBox: " << boundingBox()  << "\n"
+                << "edgeCell:\n"
+                << edgeCell << "\n";
+
+        CoordBox<DIM> box = boundingBox();
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            message << "Coord" << *i << ":\n" << (*this)[*i] << "\n";
+        }
+
+        message << ")";
+        return message.str();
+    }
+
+protected:
+    void saveMemberImplementation(
+        char *target,
+        MemoryLocation::Location targetLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region) const
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeCoord = i->origin - origin;
+            int endX = i->endX - origin.x();
+
+            while (relativeCoord.x() < endX) {
+                int length = segmentLength(relativeCoord, endX);
+                selector.copyMemberOut(
+                    cellAddress(relativeCoord),
+                    MemoryLocation::HOST,
+                    target,
+                    targetLocation,
+                    length);
+                target += selector.sizeOfExternal() * length;
+                relativeCoord.x() += length;
+            }
+        }
+    }
+
+    void loadMemberImplementation(
+        const char *source,
+        MemoryLocation::Location sourceLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region)
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeCoord = i->origin - origin;
+            int endX = i->endX - origin.x();
+
+            while (relativeCoord.x() < endX) {
+                int length = segmentLength(relativeCoord, endX);
+                selector.copyMemberIn(
+                    source,
+                    sourceLocation,
+                    cellAddress(relativeCoord),
+                    MemoryLocation::HOST,
+                    length);
+                source += selector.sizeOfExternal() * length;
+                relativeCoord.x() += length;
+            }
+        }
+    }
+
+private:
+    CellVector cells;
+    Coord<DIM> origin;
+    Coord<DIM> dimensions;
+    int bricks[DIM];
+    // maps the row-major index of each brick to its position along
+    // the Z-order curve:
+    std::vector<std::size_t> brickSlots;
+    CELL_TYPE edgeCell;
+
+    inline std::size_t index(const Coord<DIM>& relativeCoord) const
+    {
+        std::size_t brick = 0;
+        std::size_t offset = 0;
+        for (int i = DIM - 1; i >= 0; --i) {
+            unsigned c = relativeCoord[i];
+            brick  = brick  * bricks[i] + c / BRICK_SIZE;
+            offset = offset * BRICK_SIZE + c % BRICK_SIZE;
+        }
+
+        return brickSlots[brick] * BRICK_VOLUME + offset;
+    }
+
+    /**
+     * Number of cells from relativeCoord to either the end of its
+     * brick row or endX, whichever comes first.
+     */
+    inline int segmentLength(const Coord<DIM>& relativeCoord, int endX) const
+    {
+        int brickEnd = (relativeCoord.x() / BRICK_SIZE + 1) * BRICK_SIZE;
+        return (std::min)(brickEnd, endX) - relativeCoord.x();
+    }
+
+    void initBrickSlots(std::size_t numBricks)
+    {
+        std::vector<std::pair<boost::uint64_t, std::size_t> > codes;
+        codes.reserve(numBricks);
+
+        for (std::size_t i = 0; i < numBricks; ++i) {
+            int brickCoord[DIM];
+            std::size_t remainder = i;
+            for (int d = 0; d < DIM; ++d) {
+                brickCoord[d] = remainder % bricks[d];
+                remainder /= bricks[d];
+            }
+
+            codes.push_back(std::make_pair(mortonCode(brickCoord), i));
+        }
+
+        std::sort(codes.begin(), codes.end());
+        brickSlots.resize(numBricks);
+        for (std::size_t i = 0; i < numBricks; ++i) {
+            brickSlots[codes[i].second] = i;
+        }
+    }
+
+    static boost::uint64_t mortonCode(const int *brickCoord)
+    {
+        boost::uint64_t ret = 0;
+        for (int bit = 0; bit < (64 / DIM); ++bit) {
+            for (int d = 0; d < DIM; ++d) {
+                boost::uint64_t flag = (static_cast<boost::uint64_t>(brickCoord[d]) >> bit) & 1;
+                ret |= flag << (bit * DIM + d);
+            }
+        }
+
+        return ret;
+    }
+};
+
+template<typename _CharT, typename _Traits, typename _CellT, typename _TopologyT, int _BrickSize>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const BrickedGrid<_CellT, _TopologyT, _BrickSize>& grid)
+{
+    __os << grid.toString();
+    return __os;
+}
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef LIBGEODECOMP_STORAGE_BRICKEDNEIGHBORHOOD_H
+#define LIBGEODECOMP_STORAGE_BRICKEDNEIGHBORHOOD_H
+
+#include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/fixedcoord.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Neighborhood for the BrickedGrid: neighbors which reside within
+ * the center cell's brick are accessed via a (mostly compile-time)
+ * offset relative to the center cell. Only accesses which cross the
+ * brick's boundary (or the grid's boundary within partially filled
+ * bricks) need to fall back to the grid's (slower) index
+ * computation, which also takes care of the topology. The center
+ * needs to be located within the grid's bounding box.
+ */
+template<typename CELL, typename GRID>
+class BrickedNeighborhood
+{
+public:
+    const static int DIM = GRID::DIM;
+    const static int BRICK_SIZE = GRID::BRICK_SIZE;
+
+    typedef CELL Cell;
+
+    inline BrickedNeighborhood(const Coord<DIM>& center, const GRID *grid) :
+        center(center),
+        grid(grid)
+    {
+        Coord<DIM> relativeCoord = center - grid->getOrigin();
+        for (int i = 0; i < 3; ++i) {
+            local[i] = 0;
+            extent[i] = 1;
+        }
+        for (int i = 0; i < DIM; ++i) {
+            local[i] = relativeCoord[i] % BRICK_SIZE;
+            int remainder = grid->getDimensions()[i] - relativeCoord[i] + local[i];
+            extent[i] = (remainder < BRICK_SIZE) ? remainder : BRICK_SIZE;
+        }
+
+        centerCell = grid->cellAddress(relativeCoord);
+    }
+
+    template<int X, int Y, int Z>
+    inline const CELL& operator[](FixedCoord<X, Y, Z> relCoord) const
+    {
+        if (insideBrick(X, Y, Z)) {
+            return centerCell[X + Y * BRICK_SIZE + Z * BRICK_SIZE * BRICK_SIZE];
+        }
+
+        return (*grid)[center + Coord<DIM>(relCoord)];
+    }
+
+    inline const CELL& operator[](const Coord<DIM>& relCoord) const
+    {
+        int offsets[] = { 0, 0, 0 };
+        for (int i = 0; i < DIM; ++i) {
+            offsets[i] = relCoord[i];
+        }
+
+        if (insideBrick(offsets[0], offsets[1], offsets[2])) {
+            return centerCell[offsets[0] + offsets[1] * BRICK_SIZE + offsets[2] * BRICK_SIZE * BRICK_SIZE];
+        }
+
+        return (*grid)[center + relCoord];
+    }
+
+private:
+    Coord<DIM> center;
+    const GRID *grid;
+    const CELL *centerCell;
+    int local[3];
+    int extent[3];
+
+    inline bool insideBrick(int x, int y, int z) const
+    {
+        return
+            (static_cast<unsigned>(local[0] + x) < static_cast<unsigned>(extent[0])) &&
+            (static_cast<unsigned>(local[1] + y) < static_cast<unsigned>(extent[1])) &&
+            (static_cast<unsigned>(local[2] + z) < static_cast<unsigned>(extent[2]));
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef LIBGEODECOMP_STORAGE_COPYREGION_H
+#define LIBGEODECOMP_STORAGE_COPYREGION_H
+
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Copies all cells within region from source to target. Both grids
+ * may be of different types, but region should be contained within
+ * both bounding boxes. The copy is carried out per streak, using
+ * the fastest path available for the given pair of grids:
+ *
+ * - if either grid stores the streak contiguously (Grid,
+ *   DisplacedGrid, HaloPaddedGrid), the other grid reads from or
+ *   writes to that memory directly, which boils down to a memcpy for
+ *   AoS pairs and to a member-wise gather/scatter for SoAGrid,
+ *
+ * - two grids which share the same packed format (SoAGrid) exchange
+ *   data member-wise, plane by plane,
+ *
+ * - all others fall back to one pair of virtual get()/set() calls
+ *   per streak via an intermediate buffer.
+ */
+template<typename CELL, int DIM>
+void copyRegion(
+    const GridBase<CELL, DIM>& source,
+    GridBase<CELL, DIM> *target,
+    const Region<DIM>& region)
+{
+    std::size_t packedCellSize = source.packedCellSize();
+    if ((packedCellSize > 0) && (packedCellSize == target->packedCellSize())) {
+        std::vector<char> buffer;
+        for (std::size_t i = 0; i < region.numPlanes(); ++i) {
+            Region<DIM> plane;
+            typename Region<DIM>::StreakIterator end = region.planeStreakIterator(i + 1);
+            for (typename Region<DIM>::StreakIterator j = region.planeStreakIterator(i); j != end; ++j) {
+                plane << *j;
+            }
+
+            buffer.resize(plane.size() * packedCellSize);
+            source.saveRegion(&buffer[0], plane);
+            target->loadRegion(&buffer[0], plane);
+        }
+
+        return;
+    }
+
+    std::vector<CELL> buffer;
+    for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+        const CELL *sourceCells = source.streakAddress(*i);
+        if (sourceCells) {
+            target->set(*i, sourceCells);
+            continue;
+        }
+
+        CELL *targetCells = target->streakAddress(*i);
+        if (targetCells) {
+            source.get(*i, targetCells);
+            continue;
+        }
+
+        buffer.resize(i->length());
+        source.get(*i, &buffer[0]);
+        target->set(*i, &buffer[0]);
+    }
+}
+
+}
+
+#endif
@@ -130,6 +130,18 @@ public:
                      cells);
     }
 
+    virtual CELL_TYPE *streakAddress(const Streak<DIM>& streak)
+    {
+        return delegate.streakAddress(
+            Streak<DIM>(streak.origin - origin, streak.endX - origin.x()));
+    }
+
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        return delegate.streakAddress(
+            Streak<DIM>(streak.origin - origin, streak.endX - origin.x()));
+    }
+
     virtual void setEdge(const CELL_TYPE& cell)
     {
         getEdgeCell() = cell;
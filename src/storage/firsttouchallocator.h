@@ -0,0 +1,78 @@
+#ifndef LIBGEODECOMP_STORAGE_FIRSTTOUCHALLOCATOR_H
+#define LIBGEODECOMP_STORAGE_FIRSTTOUCHALLOCATOR_H
+
+#include <libgeodecomp/config.h>
+#include <libflatarray/aligned_allocator.hpp>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * An aligned allocator for NUMA systems: most operating systems map
+ * a page to the NUMA domain of the thread which first writes to it.
+ * Containers typically initialize their elements from a single
+ * thread, which places all memory on one domain. This allocator
+ * touches freshly allocated memory from all OpenMP threads, using a
+ * static schedule, before it's handed out. Thread i will thus own
+ * the i-th contiguous fraction of the array -- which matches the
+ * mapping of the UpdateFunctor's statically scheduled plane loop.
+ *
+ * Small allocations (and allocations from within a parallel region)
+ * are not touched to avoid the overhead of spawning threads.
+ */
+template<class T, std::size_t ALIGNMENT>
+class FirstTouchAllocator : public LibFlatArray::aligned_allocator<T, ALIGNMENT>
+{
+public:
+    typedef LibFlatArray::aligned_allocator<T, ALIGNMENT> ParentType;
+    typedef typename ParentType::pointer pointer;
+
+    static const std::size_t PAGE_SIZE = 4096;
+    static const std::size_t MIN_PAGES = 64;
+
+    template<typename OTHER>
+    struct rebind
+    {
+        typedef FirstTouchAllocator<OTHER, ALIGNMENT> other;
+    };
+
+    pointer allocate(std::size_t n, const void *hint = 0)
+    {
+        pointer ret = ParentType::allocate(n, hint);
+        if (ret == 0) {
+            return ret;
+        }
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        long numPages = (n * sizeof(T) + PAGE_SIZE - 1) / PAGE_SIZE;
+        if ((numPages < long(MIN_PAGES)) || omp_in_parallel() || (omp_get_max_threads() == 1)) {
+            return ret;
+        }
+
+        char *bytes = reinterpret_cast<char*>(ret);
+#pragma omp parallel for schedule(static)
+        for (long i = 0; i < numPages; ++i) {
+            bytes[i * PAGE_SIZE] = 0;
+        }
+#endif
+
+        return ret;
+    }
+
+    bool operator!=(const FirstTouchAllocator& /* other */) const
+    {
+        return false;
+    }
+
+    bool operator==(const FirstTouchAllocator& /* other */) const
+    {
+        return true;
+    }
+};
+
+}
+
+#endif
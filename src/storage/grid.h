@@ -1,12 +1,12 @@
 #ifndef LIBGEODECOMP_STORAGE_GRID_H
 #define LIBGEODECOMP_STORAGE_GRID_H
 
-#include <libflatarray/aligned_allocator.hpp>
 #include <libgeodecomp/geometry/coord.h>
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/storage/coordmap.h>
+#include <libgeodecomp/storage/firsttouchallocator.h>
 #include <libgeodecomp/storage/gridbase.h>
 #include <libgeodecomp/storage/selector.h>
 
@@ -16,6 +16,7 @@
 #include <boost/multi_array.hpp>
 #endif
 
+#include <algorithm>
 #include <iostream>
 
 namespace LibGeoDecomp {
@@ -110,7 +111,7 @@ public:
     typedef typename boost::detail::multi_array::const_sub_array<CELL_TYPE, 1> ConstSliceRef;
     typedef typename boost::multi_array<
         // always align on cache line boundaries
-        CELL_TYPE, DIM, LibFlatArray::aligned_allocator<CELL_TYPE, 64> > CellMatrix;
+        CELL_TYPE, DIM, FirstTouchAllocator<CELL_TYPE, 64> > CellMatrix;
     typedef typename CellMatrix::index Index;
 #else
     typedef std::vector<CELL_TYPE>& SliceRef;
@@ -145,8 +146,9 @@ public:
         edgeCell(base.getEdge())
     {
         CoordBox<DIM> box = base.boundingBox();
-        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
-            set(*i - box.origin, base.get(*i));
+        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            Streak<DIM> s = *i;
+            base.get(s, &(*this)[s.origin - box.origin]);
         }
     }
 
@@ -217,9 +219,16 @@ public:
             return true;
         }
 
+        // boost::multi_array inherits its allocator's operator==
+        // with recent Boost versions, which renders comparing the
+        // matrices directly ambiguous:
         return
             (edgeCell   == other.edgeCell) &&
-            (cellMatrix == other.cellMatrix);
+            (dimensions == other.dimensions) &&
+            std::equal(
+                cellMatrix.data(),
+                cellMatrix.data() + cellMatrix.num_elements(),
+                other.cellMatrix.data());
     }
 
     inline bool operator==(const GridBase<CELL_TYPE, TOPOLOGY::DIM>& other) const
@@ -259,6 +268,12 @@ public:
 
     virtual void set(const Streak<DIM>& streak, const CELL_TYPE *cells)
     {
+        CELL_TYPE *target = streakAddress(streak);
+        if (target) {
+            std::copy(cells, cells + streak.length(), target);
+            return;
+        }
+
         Coord<DIM> cursor = streak.origin;
         for (; cursor.x() < streak.endX; ++cursor.x()) {
             (*this)[cursor] = *cells;
@@ -273,6 +288,12 @@ public:
 
     virtual void get(const Streak<DIM>& streak, CELL_TYPE *cells) const
     {
+        const CELL_TYPE *source = streakAddress(streak);
+        if (source) {
+            std::copy(source, source + streak.length(), cells);
+            return;
+        }
+
         Coord<DIM> cursor = streak.origin;
         for (; cursor.x() < streak.endX; ++cursor.x()) {
             *cells = (*this)[cursor];
@@ -280,6 +301,28 @@ public:
         }
     }
 
+    /**
+     * Streaks which lie completely within the grid are stored
+     * contiguously, all others may wrap around or hit the edge cell.
+     */
+    virtual CELL_TYPE *streakAddress(const Streak<DIM>& streak)
+    {
+        if (!containsStreak(streak)) {
+            return 0;
+        }
+
+        return &(*this)[streak.origin];
+    }
+
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        if (!containsStreak(streak)) {
+            return 0;
+        }
+
+        return &(*this)[streak.origin];
+    }
+
     virtual void setEdge(const CELL_TYPE& cell)
     {
         getEdgeCell() = cell;
@@ -361,6 +404,14 @@ private:
     Coord<DIM> dimensions;
     CellMatrix cellMatrix;
     CELL_TYPE edgeCell;
+
+    inline bool containsStreak(const Streak<DIM>& streak) const
+    {
+        return
+            boundingBox().inBounds(streak.origin) &&
+            (streak.endX <= dimensions.x()) &&
+            (streak.endX > streak.origin.x());
+    }
 };
 
 template<typename _CharT, typename _Traits, typename _CellT, typename _TopologyT>
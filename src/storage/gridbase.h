@@ -8,6 +8,9 @@
 #include <libgeodecomp/storage/memorylocation.h>
 #include <libgeodecomp/storage/selector.h>
 
+#include <stdexcept>
+#include <vector>
+
 namespace LibGeoDecomp {
 
 /**
@@ -46,6 +49,44 @@ public:
         return boundingBox().dimensions;
     }
 
+    /**
+     * Grids which store their cells in an Array of Structs (AoS)
+     * layout may return the address of the streak's first cell if
+     * all of the streak's cells are stored contiguously. This allows
+     * copyRegion() to transfer data with a single copy per streak.
+     * Returns 0 otherwise.
+     */
+    virtual CELL *streakAddress(const Streak<DIM>& /* unused: streak */)
+    {
+        return 0;
+    }
+
+    virtual const CELL *streakAddress(const Streak<DIM>& /* unused: streak */) const
+    {
+        return 0;
+    }
+
+    /**
+     * Grids with a Struct of Arrays (SoA) layout return the size of a
+     * cell in their member-wise packed format here (0 for all other
+     * grids). Such grids implement saveRegion() and loadRegion(),
+     * which transfer cells in that format.
+     */
+    virtual std::size_t packedCellSize() const
+    {
+        return 0;
+    }
+
+    virtual void saveRegion(char * /* unused: target */, const Region<DIM>& /* unused: region */) const
+    {
+        throw std::logic_error("saveRegion() is only available for grids with a packed cell format");
+    }
+
+    virtual void loadRegion(const char * /* unused: source */, const Region<DIM>& /* unused: region */)
+    {
+        throw std::logic_error("loadRegion() is only available for grids with a packed cell format");
+    }
+
 
     bool operator==(const GridBase<CELL, DIMENSIONS>& other) const
     {
@@ -58,9 +99,19 @@ public:
             return false;
         }
 
-        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
-            if (get(*i) != other.get(*i)) {
-                return false;
+        std::vector<CELL> buffer;
+        std::vector<CELL> otherBuffer;
+        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            Streak<DIM> streak = *i;
+            buffer.resize(streak.length());
+            otherBuffer.resize(streak.length());
+            get(streak, &buffer[0]);
+            other.get(streak, &otherBuffer[0]);
+
+            for (std::size_t j = 0; j < buffer.size(); ++j) {
+                if (buffer[j] != otherBuffer[j]) {
+                    return false;
+                }
             }
         }
 
@@ -123,6 +174,19 @@ public:
         loadMemberImplementation(reinterpret_cast<const char*>(source), sourceLocation, selector, region);
     }
 
+    /**
+     * Same as loadMember(), but sans the type checking. Counterpart
+     * of saveMemberUnchecked() for readers and Initializers.
+     */
+    void loadMemberUnchecked(
+        const char *source,
+        MemoryLocation::Location sourceLocation,
+        const Selector<CELL>& selector,
+        const Region<DIM>& region)
+    {
+        loadMemberImplementation(source, sourceLocation, selector, region);
+    }
+
 protected:
     virtual void saveMemberImplementation(
         char *target,
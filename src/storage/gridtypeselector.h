@@ -3,8 +3,11 @@
 
 #include <libgeodecomp/config.h>
 
+#include <libgeodecomp/storage/brickedgrid.h>
 #include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/halopaddedgrid.h>
 #include <libgeodecomp/storage/soagrid.h>
+#include <libgeodecomp/storage/sparsebrickedgrid.h>
 #include <libgeodecomp/storage/unstructuredgrid.h>
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
 #include <libgeodecomp/geometry/topologies.h>
@@ -74,6 +77,172 @@ public:
 };
 #endif
 
+namespace GridTypeSelectorHelpers {
+
+/**
+ * Picks a HaloPaddedGrid if at least one axis is periodic.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, bool PERIODIC>
+class SelectHaloPaddedGrid
+{
+public:
+    typedef DisplacedGrid<CELL_TYPE, TOPOLOGY, false> Value;
+};
+
+/**
+ * see above.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY>
+class SelectHaloPaddedGrid<CELL_TYPE, TOPOLOGY, true>
+{
+public:
+    typedef HaloPaddedGrid<
+        CELL_TYPE,
+        TOPOLOGY,
+        APITraits::SelectStencil<CELL_TYPE>::Value::RADIUS> Value;
+};
+
+/**
+ * Replaces the grid type FALLBACK by a BrickedGrid if the cell asks
+ * for it and uses the vanilla API (i.e. doesn't depend on contiguous
+ * rows).
+ */
+template<
+    typename CELL_TYPE,
+    typename TOPOLOGY,
+    typename FALLBACK,
+    typename SUPPORTS_SOA,
+    typename FIXED_COORDS_ONLY_UPDATE,
+    typename SUPPORTS_BRICKED_GRID>
+class SelectBrickedGrid
+{
+public:
+    typedef FALLBACK Value;
+};
+
+/**
+ * see above.
+ */
+template<typename CELL_TYPE, int DIM, bool WRAP_DIM0, bool WRAP_DIM1, bool WRAP_DIM2, typename FALLBACK>
+class SelectBrickedGrid<
+    CELL_TYPE,
+    TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2>,
+    FALLBACK,
+    APITraits::FalseType,
+    APITraits::FalseType,
+    APITraits::TrueType>
+{
+public:
+    typedef BrickedGrid<CELL_TYPE, TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2> > Value;
+};
+
+/**
+ * Same as SelectBrickedGrid, but for the SparseBrickedGrid.
+ */
+template<
+    typename CELL_TYPE,
+    typename TOPOLOGY,
+    typename FALLBACK,
+    typename SUPPORTS_SOA,
+    typename FIXED_COORDS_ONLY_UPDATE,
+    typename SUPPORTS_SPARSE_BRICKED_GRID>
+class SelectSparseBrickedGrid
+{
+public:
+    typedef FALLBACK Value;
+};
+
+/**
+ * see above.
+ */
+template<typename CELL_TYPE, int DIM, bool WRAP_DIM0, bool WRAP_DIM1, bool WRAP_DIM2, typename FALLBACK>
+class SelectSparseBrickedGrid<
+    CELL_TYPE,
+    TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2>,
+    FALLBACK,
+    APITraits::FalseType,
+    APITraits::FalseType,
+    APITraits::TrueType>
+{
+public:
+    typedef SparseBrickedGrid<CELL_TYPE, TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2> > Value;
+};
+
+/**
+ * Applies SelectBrickedGrid and SelectSparseBrickedGrid (in this
+ * order, so the latter takes precedence) to FALLBACK.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, typename FALLBACK, typename SUPPORTS_SOA>
+class SelectBrickedGridTypes
+{
+private:
+    typedef typename APITraits::SelectFixedCoordsOnlyUpdate<CELL_TYPE>::Value FixedCoordsOnlyUpdate;
+    typedef typename SelectBrickedGrid<
+        CELL_TYPE,
+        TOPOLOGY,
+        FALLBACK,
+        SUPPORTS_SOA,
+        FixedCoordsOnlyUpdate,
+        typename APITraits::SelectBrickedGrid<CELL_TYPE>::Value>::Value BrickedType;
+
+public:
+    typedef typename SelectSparseBrickedGrid<
+        CELL_TYPE,
+        TOPOLOGY,
+        BrickedType,
+        SUPPORTS_SOA,
+        FixedCoordsOnlyUpdate,
+        typename APITraits::SelectSparseBrickedGrid<CELL_TYPE>::Value>::Value Value;
+};
+
+}
+
+/**
+ * Monolithic simulators (i.e. those which hold the whole simulation
+ * space in one grid) may resolve periodic boundary conditions via a
+ * HaloPaddedGrid instead of wrapping each neighbor access. As this
+ * requires all accesses to stay within the stencil's radius, it's
+ * limited to cells which explicitly declare their stencil. Cells
+ * may also request a BrickedGrid via APITraits::HasBrickedGrid or a
+ * SparseBrickedGrid via APITraits::HasSparseBrickedGrid, which take
+ * precedence.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, typename SUPPORTS_SOA, typename HAS_STENCIL = void>
+class MonolithicGridTypeSelector
+{
+public:
+    typedef typename GridTypeSelectorHelpers::SelectBrickedGridTypes<
+        CELL_TYPE,
+        TOPOLOGY,
+        typename GridTypeSelector<CELL_TYPE, TOPOLOGY, false, SUPPORTS_SOA>::Value,
+        SUPPORTS_SOA>::Value Value;
+};
+
+/**
+ * see above.
+ */
+template<typename CELL_TYPE, int DIM, bool WRAP_DIM0, bool WRAP_DIM1, bool WRAP_DIM2>
+class MonolithicGridTypeSelector<
+    CELL_TYPE,
+    TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2>,
+    APITraits::FalseType,
+    typename CELL_TYPE::API::SupportsStencil>
+{
+private:
+    typedef TopologiesHelpers::Topology<DIM, WRAP_DIM0, WRAP_DIM1, WRAP_DIM2> Topology;
+    typedef typename GridTypeSelectorHelpers::SelectHaloPaddedGrid<
+        CELL_TYPE,
+        Topology,
+        (WRAP_DIM0 || WRAP_DIM1 || WRAP_DIM2)>::Value PaddedGridType;
+
+public:
+    typedef typename GridTypeSelectorHelpers::SelectBrickedGridTypes<
+        CELL_TYPE,
+        Topology,
+        PaddedGridType,
+        APITraits::FalseType>::Value Value;
+};
+
 }
 
 #endif
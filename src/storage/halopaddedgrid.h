@@ -0,0 +1,362 @@
+#ifndef LIBGEODECOMP_STORAGE_HALOPADDEDGRID_H
+#define LIBGEODECOMP_STORAGE_HALOPADDEDGRID_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/storage/coordmap.h>
+#include <libgeodecomp/storage/firsttouchallocator.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A grid which is surrounded by a frame of RADIUS ghost cells. For
+ * axes with periodic boundary conditions the frame holds copies of
+ * the cells on the opposite face of the grid, for all other axes it
+ * holds the edge cell. This way neighbor accesses (within RADIUS)
+ * never need to be wrapped or checked, which makes the vanilla
+ * update path for periodic models considerably cheaper than using a
+ * Grid or DisplacedGrid.
+ *
+ * The downside is that the frame needs to be refreshed via
+ * refreshHalo() whenever the grid's interior has been modified and
+ * before its neighborhoods are accessed. Accesses beyond the frame
+ * are undefined.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, int RADIUS = 1>
+class HaloPaddedGrid : public GridBase<CELL_TYPE, TOPOLOGY::DIM>
+{
+public:
+    friend class HaloPaddedGridTest;
+
+    const static int DIM = TOPOLOGY::DIM;
+
+    typedef CELL_TYPE Cell;
+    typedef TOPOLOGY Topology;
+    typedef CoordMap<CELL_TYPE, HaloPaddedGrid> CoordMapType;
+    typedef std::vector<CELL_TYPE, FirstTouchAllocator<CELL_TYPE, 64> > CellVector;
+
+    explicit HaloPaddedGrid(
+        const CoordBox<DIM>& box = CoordBox<DIM>(),
+        const CELL_TYPE& defaultCell = CELL_TYPE(),
+        const CELL_TYPE& edgeCell = CELL_TYPE()) :
+        edgeCell(edgeCell)
+    {
+        resize(box);
+        std::fill(cells.begin(), cells.end(), defaultCell);
+    }
+
+    inline void resize(const CoordBox<DIM>& box)
+    {
+        origin = box.origin;
+        dimensions = box.dimensions;
+
+        std::size_t size = 1;
+        for (int i = 0; i < DIM; ++i) {
+            strides[i] = size;
+            size *= dimensions[i] + 2 * RADIUS;
+        }
+        cells.resize(size);
+
+        // precompute the offset of the origin so that accesses only
+        // need to add up the strides:
+        originOffset = 0;
+        for (int i = 0; i < DIM; ++i) {
+            originOffset += (RADIUS - origin[i]) * static_cast<long>(strides[i]);
+        }
+    }
+
+    /**
+     * Updates the ghost frame from the grid's interior (or sets it
+     * to the edge cell for non-periodic axes). The axes are
+     * processed in order, each copying whole (padded) layers of its
+     * predecessors, so that edges and corners of the frame are
+     * filled, too.
+     */
+    void refreshHalo()
+    {
+        if (dimensions.prod() == 0) {
+            return;
+        }
+
+        for (int axis = 0; axis < DIM; ++axis) {
+            refreshAxis(axis);
+        }
+    }
+
+    inline CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord)
+    {
+        return cells[offset(absoluteCoord)];
+    }
+
+    inline const CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord) const
+    {
+        return cells[offset(absoluteCoord)];
+    }
+
+    inline CoordMapType getNeighborhood(const Coord<DIM>& center) const
+    {
+        return CoordMapType(center, this);
+    }
+
+    virtual void set(const Coord<DIM>& coord, const CELL_TYPE& cell)
+    {
+        (*this)[coord] = cell;
+    }
+
+    virtual void set(const Streak<DIM>& streak, const CELL_TYPE *cells)
+    {
+        std::copy(cells, cells + streak.length(), &(*this)[streak.origin]);
+    }
+
+    virtual CELL_TYPE get(const Coord<DIM>& coord) const
+    {
+        return (*this)[coord];
+    }
+
+    virtual void get(const Streak<DIM>& streak, CELL_TYPE *cells) const
+    {
+        const CELL_TYPE *start = &(*this)[streak.origin];
+        std::copy(start, start + streak.length(), cells);
+    }
+
+    virtual CELL_TYPE *streakAddress(const Streak<DIM>& streak)
+    {
+        if (!containsStreak(streak)) {
+            return 0;
+        }
+
+        return &(*this)[streak.origin];
+    }
+
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        if (!containsStreak(streak)) {
+            return 0;
+        }
+
+        return &(*this)[streak.origin];
+    }
+
+    virtual void setEdge(const CELL_TYPE& cell)
+    {
+        edgeCell = cell;
+    }
+
+    virtual const CELL_TYPE& getEdge() const
+    {
+        return edgeCell;
+    }
+
+    inline CELL_TYPE& getEdgeCell()
+    {
+        return edgeCell;
+    }
+
+    inline const CELL_TYPE& getEdgeCell() const
+    {
+        return edgeCell;
+    }
+
+    void fill(const CoordBox<DIM>& box, const CELL_TYPE& cell)
+    {
+        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            Streak<DIM> streak = *i;
+            CELL_TYPE *start = &(*this)[streak.origin];
+            std::fill(start, start + streak.length(), cell);
+        }
+    }
+
+    inline const Coord<DIM>& getOrigin() const
+    {
+        return origin;
+    }
+
+    inline const Coord<DIM>& getDimensions() const
+    {
+        return dimensions;
+    }
+
+    virtual CoordBox<DIM> boundingBox() const
+    {
+        return CoordBox<DIM>(origin, dimensions);
+    }
+
+    inline std::string toString() const
+    {
+        std::ostringstream message;
+        message << "HaloPaddedGrid<" << DIM << ", " << RADIUS << ">(\n"
+                << "boundingBox: " << boundingBox()  << "\n"
+                << "edgeCell:\n"
+                << edgeCell << "\n";
+
+        CoordBox<DIM> box = boundingBox();
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            message << "Coord" << *i << ":\n" << (*this)[*i] << "\n";
+        }
+
+        message << ")";
+        return message.str();
+    }
+
+protected:
+    void saveMemberImplementation(
+        char *target,
+        MemoryLocation::Location targetLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region) const
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            selector.copyMemberOut(
+                &(*this)[i->origin],
+                MemoryLocation::HOST,
+                target,
+                targetLocation,
+                i->length());
+            target += selector.sizeOfExternal() * i->length();
+        }
+    }
+
+    void loadMemberImplementation(
+        const char *source,
+        MemoryLocation::Location sourceLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region)
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            selector.copyMemberIn(
+                source,
+                sourceLocation,
+                &(*this)[i->origin],
+                MemoryLocation::HOST,
+                i->length());
+            source += selector.sizeOfExternal() * i->length();
+        }
+    }
+
+private:
+    CellVector cells;
+    Coord<DIM> origin;
+    Coord<DIM> dimensions;
+    std::size_t strides[DIM];
+    long originOffset;
+    CELL_TYPE edgeCell;
+
+    inline bool containsStreak(const Streak<DIM>& streak) const
+    {
+        return
+            boundingBox().inBounds(streak.origin) &&
+            (streak.endX <= (origin.x() + dimensions.x())) &&
+            (streak.endX > streak.origin.x());
+    }
+
+    inline std::size_t offset(const Coord<DIM>& absoluteCoord) const
+    {
+        long ret = originOffset;
+        for (int i = 0; i < DIM; ++i) {
+            ret += absoluteCoord[i] * static_cast<long>(strides[i]);
+        }
+
+        return ret;
+    }
+
+    /**
+     * Fills the lower and upper frame layers along the given axis.
+     * Since all preceding axes have already been padded, each layer
+     * is a contiguous block of strides[axis] cells per coordinate of
+     * the succeeding axes, so copies boil down to memcpy for POD
+     * cells.
+     */
+    void refreshAxis(const int axis)
+    {
+        std::size_t layerSize = strides[axis];
+        bool periodic = Topology::wrapsAxis(axis);
+        int dim = dimensions[axis];
+
+        std::size_t outerCount = 1;
+        for (int i = axis + 1; i < DIM; ++i) {
+            outerCount *= dimensions[i];
+        }
+
+        for (std::size_t outer = 0; outer < outerCount; ++outer) {
+            std::size_t base = 0;
+            std::size_t remainder = outer;
+            for (int i = axis + 1; i < DIM; ++i) {
+                base += (remainder % dimensions[i] + RADIUS) * strides[i];
+                remainder /= dimensions[i];
+            }
+
+            for (int layer = 0; layer < RADIUS; ++layer) {
+                CELL_TYPE *lower = &cells[base + layer * layerSize];
+                CELL_TYPE *upper = &cells[base + (dim + RADIUS + layer) * layerSize];
+
+                if (!periodic) {
+                    std::fill(lower, lower + layerSize, edgeCell);
+                    std::fill(upper, upper + layerSize, edgeCell);
+                    continue;
+                }
+
+                // map the frame layers to their counterparts in the
+                // interior (modulo is only required if the grid is
+                // thinner than the frame):
+                int lowerSource = ((layer - RADIUS) % dim + dim) % dim + RADIUS;
+                int upperSource = layer % dim + RADIUS;
+                const CELL_TYPE *lowerSourcePointer = &cells[base + lowerSource * layerSize];
+                const CELL_TYPE *upperSourcePointer = &cells[base + upperSource * layerSize];
+                std::copy(lowerSourcePointer, lowerSourcePointer + layerSize, lower);
+                std::copy(upperSourcePointer, upperSourcePointer + layerSize, upper);
+            }
+        }
+    }
+};
+
+namespace HaloPaddedGridHelpers {
+
+/**
+ * Simulators which may use a HaloPaddedGrid call this before each
+ * update. It's a NOP for all other grid types.
+ */
+template<typename GRID_TYPE>
+class RefreshHalo
+{
+public:
+    static const bool REQUIRED = false;
+
+    inline void operator()(GRID_TYPE * /* unused: grid */) const
+    {}
+};
+
+/**
+ * see above
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, int RADIUS>
+class RefreshHalo<HaloPaddedGrid<CELL_TYPE, TOPOLOGY, RADIUS> >
+{
+public:
+    static const bool REQUIRED = true;
+
+    inline void operator()(HaloPaddedGrid<CELL_TYPE, TOPOLOGY, RADIUS> *grid) const
+    {
+        grid->refreshHalo();
+    }
+};
+
+}
+
+template<typename _CharT, typename _Traits, typename _CellT, typename _TopologyT, int _Radius>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const HaloPaddedGrid<_CellT, _TopologyT, _Radius>& grid)
+{
+    __os << grid.toString();
+    return __os;
+}
+
+}
+
+#endif
@@ -1,9 +1,12 @@
 #ifndef LIBGEODECOMP_STORAGE_PATCHBUFFER_H
 #define LIBGEODECOMP_STORAGE_PATCHBUFFER_H
 
-#include <deque>
 #include <libgeodecomp/storage/patchaccepter.h>
 #include <libgeodecomp/storage/patchprovider.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -13,6 +16,9 @@ namespace LibGeoDecomp {
  * implement overlapping communication and calculation (and hence need
  * to buffer certain parts of the grid which will be temporarily
  * overwritten).
+ *
+ * Buffers are recycled once their patch has been retrieved, so after
+ * the first few time steps put() won't allocate any memory.
  */
 template<class GRID_TYPE1, class GRID_TYPE2>
 class PatchBuffer :
@@ -31,7 +37,9 @@ public:
     using PatchProvider<GRID_TYPE2>::storedNanoSteps;
 
     explicit PatchBuffer(const Region<DIM>& region = Region<DIM>()) :
-        region(region)
+        region(region),
+        indexRead(0),
+        numStored(0)
     {}
 
     virtual void put(
@@ -48,11 +56,14 @@ public:
             return;
         }
 
-        storedRegions.push_back(BufferType());
-        BufferType& buffer = storedRegions.back();
-        buffer = SerializationBuffer<CellType>::create(region);
+        if (numStored == buffers.size()) {
+            grow();
+        }
 
+        BufferType& buffer = buffers[(indexRead + numStored) % buffers.size()];
+        SerializationBuffer<CellType>::resize(&buffer, region);
         GridVecConv::gridToVector(grid, &buffer, region);
+        ++numStored;
         storedNanoSteps << (min)(requestedNanoSteps);
         erase_min(requestedNanoSteps);
     }
@@ -66,15 +77,16 @@ public:
         const bool remove=true)
     {
         checkNanoStepGet(nanoStep);
-        if (storedRegions.empty()) {
+        if (numStored == 0) {
             throw std::logic_error("no region available");
         }
 
         GridVecConv::vectorToGrid(
-            storedRegions.front(), destinationGrid, region);
+            buffers[indexRead], destinationGrid, region);
 
         if (remove) {
-            storedRegions.pop_front();
+            indexRead = (indexRead + 1) % buffers.size();
+            --numStored;
             erase_min(storedNanoSteps);
         }
 
@@ -82,7 +94,18 @@ public:
 
 private:
     Region<DIM> region;
-    std::deque<BufferType> storedRegions;
+    // ring buffer: the stored patches start at indexRead, all other
+    // buffers are kept for reuse.
+    std::vector<BufferType> buffers;
+    std::size_t indexRead;
+    std::size_t numStored;
+
+    void grow()
+    {
+        std::rotate(buffers.begin(), buffers.begin() + indexRead, buffers.end());
+        indexRead = 0;
+        buffers.push_back(SerializationBuffer<CellType>::create(region));
+    }
 };
 
 }
@@ -54,6 +54,31 @@ public:
         return viewBox;
     }
 
+    virtual CELL *streakAddress(const Streak<DIM>& streak)
+    {
+        return delegate->streakAddress(streak);
+    }
+
+    virtual const CELL *streakAddress(const Streak<DIM>& streak) const
+    {
+        return static_cast<const GridBase<CELL, DIM>*>(delegate)->streakAddress(streak);
+    }
+
+    virtual std::size_t packedCellSize() const
+    {
+        return delegate->packedCellSize();
+    }
+
+    virtual void saveRegion(char *target, const Region<DIM>& region) const
+    {
+        delegate->saveRegion(target, region);
+    }
+
+    virtual void loadRegion(const char *source, const Region<DIM>& region)
+    {
+        delegate->loadRegion(source, region);
+    }
+
     void saveMemberImplementation(
         char *target,
         MemoryLocation::Location targetLocation,
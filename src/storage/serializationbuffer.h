@@ -1,12 +1,57 @@
 #ifndef LIBGEODECOMP_STORAGE_SERIALIZATIONBUFFER_H
 #define LIBGEODECOMP_STORAGE_SERIALIZATIONBUFFER_H
 
+#include <libgeodecomp/config.h>
 #include <libflatarray/flat_array.hpp>
 
 namespace LibGeoDecomp {
 
 namespace SerializationBufferHelpers {
 
+/**
+ * Counts how often buffers had to be allocated or grown by
+ * SerializationBuffer. Buffers are meant to be recycled, so this
+ * value should stay constant during steady-state time stepping --
+ * which is what the unit tests use this counter for.
+ */
+class AllocationCounter
+{
+public:
+    static void increment()
+    {
+        std::size_t& value = counter();
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp atomic
+#endif
+        ++value;
+    }
+
+    static std::size_t get()
+    {
+        return counter();
+    }
+
+private:
+    static std::size_t& counter()
+    {
+        static std::size_t value = 0;
+        return value;
+    }
+};
+
+/**
+ * Resizes buffer, but only counts an allocation if its capacity is
+ * exceeded.
+ */
+template<typename BUFFER>
+void resizeBuffer(BUFFER *buffer, std::size_t size)
+{
+    if (size > buffer->capacity()) {
+        AllocationCounter::increment();
+    }
+    buffer->resize(size);
+}
+
 /**
  * This is an n-way switch to allow other classes to select the
  * appropriate type to buffer regions of a grid; for use with GridVecConv.
@@ -22,9 +67,16 @@ public:
     template<typename REGION>
     static BufferType create(const REGION& region)
     {
+        AllocationCounter::increment();
         return BufferType(region.size());
     }
 
+    template<typename REGION>
+    static void resize(BufferType *buffer, const REGION& region)
+    {
+        resizeBuffer(buffer, region.size());
+    }
+
     static ElementType *getData(BufferType& buffer)
     {
         return &buffer.first();
@@ -49,9 +101,16 @@ public:
     template<typename REGION>
     static BufferType create(const REGION& region)
     {
+        AllocationCounter::increment();
         return BufferType(LibFlatArray::aggregated_member_size<CELL>::VALUE * region.size());
     }
 
+    template<typename REGION>
+    static void resize(BufferType *buffer, const REGION& region)
+    {
+        resizeBuffer(buffer, LibFlatArray::aggregated_member_size<CELL>::VALUE * region.size());
+    }
+
     static ElementType *getData(BufferType& buffer)
     {
         return &buffer.front();
@@ -79,6 +138,14 @@ public:
         return BufferType();
     }
 
+    /**
+     * The buffer's size depends on the serialized data, so
+     * GridVecConv will resize it, retaining its capacity.
+     */
+    template<typename REGION>
+    static void resize(BufferType * /* unused: buffer */, const REGION& /* unused: region */)
+    {}
+
     static ElementType *getData(BufferType& buffer)
     {
         return &buffer.front();
@@ -113,6 +180,26 @@ public:
         return Implementation::create(region);
     }
 
+    /**
+     * Adapts a previously created buffer to region. Recycling
+     * buffers this way avoids allocations unless the buffer has to
+     * grow.
+     */
+    template<typename REGION>
+    static inline void resize(BufferType *buffer, const REGION& region)
+    {
+        Implementation::resize(buffer, region);
+    }
+
+    /**
+     * Number of buffers allocated (or grown) so far, for all cell
+     * types.
+     */
+    static inline std::size_t allocations()
+    {
+        return SerializationBufferHelpers::AllocationCounter::get();
+    }
+
     static inline ElementType *getData(BufferType& buffer)
     {
         return Implementation::getData(buffer);
@@ -391,7 +391,12 @@ public:
         delegate.callback(&newGrid->delegate, functor);
     }
 
-    void saveRegion(char *target, const Region<DIM>& region) const
+    virtual std::size_t packedCellSize() const
+    {
+        return AGGREGATED_MEMBER_SIZE;
+    }
+
+    virtual void saveRegion(char *target, const Region<DIM>& region) const
     {
         char *dataIterator = target;
 
@@ -400,16 +405,17 @@ public:
              ++i) {
             Streak<DIM> s = *i;
             std::size_t length = s.length();
-            int x = s.origin.x() + edgeRadii.x() - box.origin.x();
-            int y = s.origin.y() + edgeRadii.y() - box.origin.y();
-            int z = s.origin.z() + edgeRadii.z() - box.origin.z();
-            delegate.save(x, y, z, dataIterator, length);
+            Coord<3> c = edgeRadii;
+            for (int d = 0; d < DIM; ++d) {
+                c[d] += s.origin[d] - box.origin[d];
+            }
+            delegate.save(c.x(), c.y(), c.z(), dataIterator, length);
             dataIterator += length * AGGREGATED_MEMBER_SIZE;
         }
 
     }
 
-    void loadRegion(const char *source, const Region<DIM>& region)
+    virtual void loadRegion(const char *source, const Region<DIM>& region)
     {
         const char *dataIterator = source;
 
@@ -418,10 +424,11 @@ public:
              ++i) {
             Streak<DIM> s = *i;
             std::size_t length = s.length();
-            int x = s.origin.x() + edgeRadii.x() - box.origin.x();
-            int y = s.origin.y() + edgeRadii.y() - box.origin.y();
-            int z = s.origin.z() + edgeRadii.z() - box.origin.z();
-            delegate.load(x, y, z, dataIterator, length);
+            Coord<3> c = edgeRadii;
+            for (int d = 0; d < DIM; ++d) {
+                c[d] += s.origin[d] - box.origin[d];
+            }
+            delegate.load(c.x(), c.y(), c.z(), dataIterator, length);
             dataIterator += length * AGGREGATED_MEMBER_SIZE;
         }
 
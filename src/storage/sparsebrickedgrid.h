@@ -0,0 +1,597 @@
+#ifndef LIBGEODECOMP_STORAGE_SPARSEBRICKEDGRID_H
+#define LIBGEODECOMP_STORAGE_SPARSEBRICKEDGRID_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/storage/brickedgrid.h>
+#include <libgeodecomp/storage/brickedneighborhood.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <boost/static_assert.hpp>
+#include <algorithm>
+#include <deque>
+#include <sstream>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A block-sparse variant of the BrickedGrid: the bounding box is
+ * divided into bricks of BRICK_SIZE^DIM cells, but only bricks which
+ * hold active cells (as reported by the cell's isActive() member)
+ * are backed by memory. All other bricks share a single background
+ * brick, filled with the default cell. Memory consumption thus
+ * scales with the active volume instead of the bounding box, which
+ * is what domains consisting mostly of "dead" cells (e.g. obstacles
+ * or dry land) need.
+ *
+ * Bricks are allocated on demand:
+ *
+ * - set() allocates the brick if the cell is active and silently
+ *   drops inactive cells headed for the background,
+ *
+ * - non-const operator[], cellAddress() and loadMember() always
+ *   allocate as the grid can't tell what will be written,
+ *
+ * - allocate() and growAroundActiveCells() allocate whole regions.
+ *
+ * Const accesses never allocate. Memory of allocated bricks stays
+ * valid until the brick is released via releaseInactiveBricks().
+ *
+ * allocatedRegion() describes all allocated cells and is meant to
+ * drive the update: cells outside of it keep the default cell. This
+ * is only correct if inactive cells are equivalent to the default
+ * cell and if a cell whose neighbors (within the stencil's radius)
+ * are all inactive stays inactive. Simulators keep the update
+ * region in sync via SparseBrickedGridHelpers::SyncBricks.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, int BRICK_SIZE_PARAM = 8>
+class SparseBrickedGrid : public GridBase<CELL_TYPE, TOPOLOGY::DIM>
+{
+public:
+    friend class SparseBrickedGridTest;
+
+    const static int DIM = TOPOLOGY::DIM;
+    const static int BRICK_SIZE = BRICK_SIZE_PARAM;
+    const static int BRICK_VOLUME = BrickedGridHelpers::BrickVolume<DIM, BRICK_SIZE>::VALUE;
+
+    BOOST_STATIC_ASSERT((BRICK_SIZE > 0) && ((BRICK_SIZE & (BRICK_SIZE - 1)) == 0));
+
+    typedef CELL_TYPE Cell;
+    typedef TOPOLOGY Topology;
+    typedef BrickedNeighborhood<CELL_TYPE, SparseBrickedGrid> NeighborhoodType;
+
+    explicit SparseBrickedGrid(
+        const CoordBox<DIM>& box = CoordBox<DIM>(),
+        const CELL_TYPE& defaultCell = CELL_TYPE(),
+        const CELL_TYPE& edgeCell = CELL_TYPE()) :
+        defaultCell(defaultCell),
+        edgeCell(edgeCell)
+    {
+        resize(box);
+    }
+
+    /**
+     * Resets the grid to the given bounding box, releasing all
+     * bricks.
+     */
+    inline void resize(const CoordBox<DIM>& box)
+    {
+        origin = box.origin;
+        dimensions = box.dimensions;
+
+        std::size_t numBricks = 1;
+        for (int i = 0; i < DIM; ++i) {
+            bricks[i] = (dimensions[i] + BRICK_SIZE - 1) / BRICK_SIZE;
+            numBricks *= bricks[i];
+        }
+
+        storage.clear();
+        storage.push_back(std::vector<CELL_TYPE>(BRICK_VOLUME, defaultCell));
+        brickSlots.assign(numBricks, 0);
+        freeSlots.clear();
+        allocated.clear();
+        frontierRadius = -1;
+    }
+
+    inline CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord)
+    {
+        Coord<DIM> relativeCoord = absoluteCoord - origin;
+        if (Topology::isOutOfBounds(relativeCoord, dimensions)) {
+            return edgeCell;
+        }
+
+        return *cellAddress(Topology::normalize(relativeCoord, dimensions));
+    }
+
+    inline const CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord) const
+    {
+        Coord<DIM> relativeCoord = absoluteCoord - origin;
+        if (Topology::isOutOfBounds(relativeCoord, dimensions)) {
+            return edgeCell;
+        }
+
+        return *cellAddress(Topology::normalize(relativeCoord, dimensions));
+    }
+
+    /**
+     * see BrickedGrid::cellAddress(). The non-const variant
+     * allocates the brick, the const variant points into the
+     * background brick if the brick isn't allocated.
+     */
+    inline CELL_TYPE *cellAddress(const Coord<DIM>& relativeCoord)
+    {
+        std::size_t brick;
+        std::size_t offset;
+        locate(relativeCoord, &brick, &offset);
+        if (brickSlots[brick] == 0) {
+            allocateBrick(brick);
+        }
+
+        return &storage[brickSlots[brick]][offset];
+    }
+
+    inline const CELL_TYPE *cellAddress(const Coord<DIM>& relativeCoord) const
+    {
+        std::size_t brick;
+        std::size_t offset;
+        locate(relativeCoord, &brick, &offset);
+        return &storage[brickSlots[brick]][offset];
+    }
+
+    inline NeighborhoodType getNeighborhood(const Coord<DIM>& center) const
+    {
+        return NeighborhoodType(center, this);
+    }
+
+    virtual void set(const Coord<DIM>& coord, const CELL_TYPE& cell)
+    {
+        Coord<DIM> relativeCoord = coord - origin;
+        if (Topology::isOutOfBounds(relativeCoord, dimensions)) {
+            edgeCell = cell;
+            return;
+        }
+
+        relativeCoord = Topology::normalize(relativeCoord, dimensions);
+        if (!cell.isActive() && !isAllocated(relativeCoord)) {
+            return;
+        }
+
+        *cellAddress(relativeCoord) = cell;
+    }
+
+    virtual void set(const Streak<DIM>& streak, const CELL_TYPE *cells)
+    {
+        Coord<DIM> relativeCoord = streak.origin - origin;
+        int endX = streak.endX - origin.x();
+
+        while (relativeCoord.x() < endX) {
+            int length = segmentLength(relativeCoord, endX);
+            if (isAllocated(relativeCoord) || anyActive(cells, length)) {
+                std::copy(cells, cells + length, cellAddress(relativeCoord));
+            }
+            cells += length;
+            relativeCoord.x() += length;
+        }
+    }
+
+    virtual CELL_TYPE get(const Coord<DIM>& coord) const
+    {
+        return (*this)[coord];
+    }
+
+    virtual void get(const Streak<DIM>& streak, CELL_TYPE *cells) const
+    {
+        Coord<DIM> relativeCoord = streak.origin - origin;
+        int endX = streak.endX - origin.x();
+
+        while (relativeCoord.x() < endX) {
+            int length = segmentLength(relativeCoord, endX);
+            const CELL_TYPE *source = cellAddress(relativeCoord);
+            std::copy(source, source + length, cells);
+            cells += length;
+            relativeCoord.x() += length;
+        }
+    }
+
+    virtual void setEdge(const CELL_TYPE& cell)
+    {
+        edgeCell = cell;
+    }
+
+    virtual const CELL_TYPE& getEdge() const
+    {
+        return edgeCell;
+    }
+
+    inline const Coord<DIM>& getOrigin() const
+    {
+        return origin;
+    }
+
+    inline const Coord<DIM>& getDimensions() const
+    {
+        return dimensions;
+    }
+
+    virtual CoordBox<DIM> boundingBox() const
+    {
+        return CoordBox<DIM>(origin, dimensions);
+    }
+
+    /**
+     * All cells which are backed by allocated bricks (clipped to the
+     * bounding box, in absolute coordinates).
+     */
+    inline const Region<DIM>& allocatedRegion() const
+    {
+        return allocated;
+    }
+
+    inline std::size_t numAllocatedBricks() const
+    {
+        return storage.size() - 1 - freeSlots.size();
+    }
+
+    /**
+     * Allocates all bricks which intersect the given region (in
+     * absolute coordinates, needs to be within the bounding box).
+     */
+    void allocate(const Region<DIM>& region)
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeCoord = i->origin - origin;
+            int endX = i->endX - origin.x();
+
+            while (relativeCoord.x() < endX) {
+                std::size_t brick;
+                std::size_t offset;
+                locate(relativeCoord, &brick, &offset);
+                if (brickSlots[brick] == 0) {
+                    allocateBrick(brick);
+                }
+                relativeCoord.x() += segmentLength(relativeCoord, endX);
+            }
+        }
+    }
+
+    /**
+     * Activity can spread by at most radius cells per update. This
+     * function checks the allocated cells within radius of the
+     * unallocated cells for activity and allocates the bricks within
+     * reach of any active ones. Returns true if any bricks were
+     * allocated.
+     */
+    bool growAroundActiveCells(int radius)
+    {
+        const Region<DIM>& frontier = getFrontier(radius);
+        const SparseBrickedGrid& constThis = *this;
+        Region<DIM> activeCells;
+
+        for (typename Region<DIM>::StreakIterator i = frontier.beginStreak(); i != frontier.endStreak(); ++i) {
+            Coord<DIM> c = i->origin - origin;
+            int endX = i->endX - origin.x();
+            int start = -1;
+
+            for (; c.x() < endX; ++c.x()) {
+                bool active = constThis.cellAddress(c)->isActive();
+                if (active && (start < 0)) {
+                    start = c.x();
+                }
+                if (!active && (start >= 0)) {
+                    activeCells << makeStreak(c, start);
+                    start = -1;
+                }
+            }
+            if (start >= 0) {
+                activeCells << makeStreak(c, start);
+            }
+        }
+
+        if (activeCells.empty()) {
+            return false;
+        }
+
+        std::size_t oldBricks = numAllocatedBricks();
+        allocate(translate(
+                     activeCells.expandWithTopology(radius, dimensions, Topology()),
+                     origin));
+        return numAllocatedBricks() != oldBricks;
+    }
+
+    /**
+     * Returns the bricks whose cells are all inactive to the
+     * background, freeing their memory. Returns the number of
+     * released bricks.
+     */
+    std::size_t releaseInactiveBricks()
+    {
+        std::size_t released = 0;
+
+        for (std::size_t brick = 0; brick < brickSlots.size(); ++brick) {
+            std::size_t slot = brickSlots[brick];
+            if ((slot == 0) || anyActive(&storage[slot][0], BRICK_VOLUME)) {
+                continue;
+            }
+
+            std::vector<CELL_TYPE>().swap(storage[slot]);
+            freeSlots.push_back(slot);
+            brickSlots[brick] = 0;
+            Region<DIM> brickRegion;
+            brickRegion << brickBox(brick);
+            allocated -= brickRegion;
+            frontierRadius = -1;
+            ++released;
+        }
+
+        return released;
+    }
+
+    inline std::string toString() const
+    {
+        std::ostringstream message;
+        message << "SparseBrickedGrid<" << DIM << ", " << BRICK_SIZE << ">(\n"
+                << "boundingBox: " << boundingBox()  << "\n"
+                << "allocatedBricks: " << numAllocatedBricks() << "\n"
+                << "edgeCell:\n"
+                << edgeCell << "\n";
+
+        for (typename Region<DIM>::Iterator i = allocated.begin(); i != allocated.end(); ++i) {
+            message << "Coord" << *i << ":\n" << (*this)[*i] << "\n";
+        }
+
+        message << ")";
+        return message.str();
+    }
+
+protected:
+    void saveMemberImplementation(
+        char *target,
+        MemoryLocation::Location targetLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region) const
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeCoord = i->origin - origin;
+            int endX = i->endX - origin.x();
+
+            while (relativeCoord.x() < endX) {
+                int length = segmentLength(relativeCoord, endX);
+                selector.copyMemberOut(
+                    cellAddress(relativeCoord),
+                    MemoryLocation::HOST,
+                    target,
+                    targetLocation,
+                    length);
+                target += selector.sizeOfExternal() * length;
+                relativeCoord.x() += length;
+            }
+        }
+    }
+
+    void loadMemberImplementation(
+        const char *source,
+        MemoryLocation::Location sourceLocation,
+        const Selector<CELL_TYPE>& selector,
+        const Region<DIM>& region)
+    {
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeCoord = i->origin - origin;
+            int endX = i->endX - origin.x();
+
+            while (relativeCoord.x() < endX) {
+                int length = segmentLength(relativeCoord, endX);
+                selector.copyMemberIn(
+                    source,
+                    sourceLocation,
+                    cellAddress(relativeCoord),
+                    MemoryLocation::HOST,
+                    length);
+                source += selector.sizeOfExternal() * length;
+                relativeCoord.x() += length;
+            }
+        }
+    }
+
+private:
+    // slot 0 is the background brick. A deque keeps the bricks in
+    // place when new ones are appended:
+    std::deque<std::vector<CELL_TYPE> > storage;
+    // maps the row-major index of each brick to its slot in storage:
+    std::vector<std::size_t> brickSlots;
+    std::vector<std::size_t> freeSlots;
+    Region<DIM> allocated;
+    Region<DIM> frontier;
+    int frontierRadius;
+    Coord<DIM> origin;
+    Coord<DIM> dimensions;
+    int bricks[DIM];
+    CELL_TYPE defaultCell;
+    CELL_TYPE edgeCell;
+
+    inline void locate(const Coord<DIM>& relativeCoord, std::size_t *brick, std::size_t *offset) const
+    {
+        *brick = 0;
+        *offset = 0;
+        for (int i = DIM - 1; i >= 0; --i) {
+            unsigned c = relativeCoord[i];
+            *brick  = *brick  * bricks[i] + c / BRICK_SIZE;
+            *offset = *offset * BRICK_SIZE + c % BRICK_SIZE;
+        }
+    }
+
+    inline bool isAllocated(const Coord<DIM>& relativeCoord) const
+    {
+        std::size_t brick;
+        std::size_t offset;
+        locate(relativeCoord, &brick, &offset);
+        return brickSlots[brick] != 0;
+    }
+
+    /**
+     * see BrickedGrid::segmentLength()
+     */
+    inline int segmentLength(const Coord<DIM>& relativeCoord, int endX) const
+    {
+        int brickEnd = (relativeCoord.x() / BRICK_SIZE + 1) * BRICK_SIZE;
+        return (std::min)(brickEnd, endX) - relativeCoord.x();
+    }
+
+    static bool anyActive(const CELL_TYPE *cells, int length)
+    {
+        for (int i = 0; i < length; ++i) {
+            if (cells[i].isActive()) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void allocateBrick(std::size_t brick)
+    {
+        std::size_t slot = storage.size();
+        if (freeSlots.empty()) {
+            storage.push_back(std::vector<CELL_TYPE>(BRICK_VOLUME, defaultCell));
+        } else {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+            storage[slot].assign(BRICK_VOLUME, defaultCell);
+        }
+
+        brickSlots[brick] = slot;
+        allocated << brickBox(brick);
+        frontierRadius = -1;
+    }
+
+    /**
+     * The cells of the given brick within the bounding box (in
+     * absolute coordinates).
+     */
+    CoordBox<DIM> brickBox(std::size_t brick) const
+    {
+        CoordBox<DIM> box;
+        for (int d = 0; d < DIM; ++d) {
+            int start = (brick % bricks[d]) * BRICK_SIZE;
+            brick /= bricks[d];
+            box.origin[d] = origin[d] + start;
+            box.dimensions[d] = (std::min)(BRICK_SIZE + start, dimensions[d]) - start;
+        }
+
+        return box;
+    }
+
+    /**
+     * Allocated cells within radius of unallocated cells (in absolute
+     * coordinates). Cached as it only changes along with the
+     * allocation.
+     */
+    const Region<DIM>& getFrontier(int radius)
+    {
+        if (frontierRadius == radius) {
+            return frontier;
+        }
+
+        Region<DIM> relativeAllocated = translate(allocated, -origin);
+        Region<DIM> unallocated;
+        unallocated << CoordBox<DIM>(Coord<DIM>(), dimensions);
+        unallocated -= relativeAllocated;
+
+        frontier = translate(
+            relativeAllocated & unallocated.expandWithTopology(radius, dimensions, Topology()),
+            origin);
+        frontierRadius = radius;
+        return frontier;
+    }
+
+    static Region<DIM> translate(const Region<DIM>& region, const Coord<DIM>& offset)
+    {
+        Region<DIM> ret;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            ret << Streak<DIM>(i->origin + offset, i->endX + offset.x());
+        }
+
+        return ret;
+    }
+
+    inline Streak<DIM> makeStreak(const Coord<DIM>& relativeEnd, int relativeStartX) const
+    {
+        Coord<DIM> start = relativeEnd + origin;
+        start.x() = relativeStartX + origin.x();
+        return Streak<DIM>(start, relativeEnd.x() + origin.x());
+    }
+};
+
+template<typename _CharT, typename _Traits, typename _CellT, typename _TopologyT, int _BrickSize>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const SparseBrickedGrid<_CellT, _TopologyT, _BrickSize>& grid)
+{
+    __os << grid.toString();
+    return __os;
+}
+
+namespace SparseBrickedGridHelpers {
+
+/**
+ * Simulators use this to keep their update region in sync with the
+ * bricks allocated in their grids. For all other grid types this is
+ * a NOP.
+ */
+template<typename GRID_TYPE>
+class SyncBricks
+{
+public:
+    static const bool REQUIRED = false;
+
+    template<int DIM>
+    inline bool operator()(
+        GRID_TYPE * /* unused: curGrid */,
+        GRID_TYPE * /* unused: newGrid */,
+        Region<DIM> * /* unused: updateRegion */,
+        int /* unused: radius */) const
+    {
+        return false;
+    }
+};
+
+/**
+ * Allocates the bricks which the next update may activate (given
+ * the stencil's radius) and makes sure both grids share the same
+ * allocation, which then becomes the update region. Returns true if
+ * the update region was changed.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, int BRICK_SIZE>
+class SyncBricks<SparseBrickedGrid<CELL_TYPE, TOPOLOGY, BRICK_SIZE> >
+{
+public:
+    static const bool REQUIRED = true;
+    static const int DIM = TOPOLOGY::DIM;
+
+    inline bool operator()(
+        SparseBrickedGrid<CELL_TYPE, TOPOLOGY, BRICK_SIZE> *curGrid,
+        SparseBrickedGrid<CELL_TYPE, TOPOLOGY, BRICK_SIZE> *newGrid,
+        Region<DIM> *updateRegion,
+        int radius) const
+    {
+        curGrid->growAroundActiveCells(radius);
+        if (!(newGrid->allocatedRegion() == curGrid->allocatedRegion())) {
+            newGrid->allocate(curGrid->allocatedRegion());
+            curGrid->allocate(newGrid->allocatedRegion());
+        }
+
+        if (*updateRegion == curGrid->allocatedRegion()) {
+            return false;
+        }
+
+        *updateRegion = curGrid->allocatedRegion();
+        return true;
+    }
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,6 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}fixedarraytest.h
+  ${RELATIVE_PATH}selectortest.h
+)
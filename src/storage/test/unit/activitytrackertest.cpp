@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ActivityTrackerTest_init = false;
+#include "/root/repo/src/storage/test/unit/activitytrackertest.h"
+
+static ActivityTrackerTest suite_ActivityTrackerTest;
+
+static CxxTest::List Tests_ActivityTrackerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ActivityTrackerTest( "/root/repo/src/storage/test/unit/activitytrackertest.h", 93, "ActivityTrackerTest", suite_ActivityTrackerTest, Tests_ActivityTrackerTest );
+
+static class TestDescription_suite_ActivityTrackerTest_testDisabled : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testDisabled() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 99, "testDisabled" ) {}
+ void runTest() { suite_ActivityTrackerTest.testDisabled(); }
+} testDescription_suite_ActivityTrackerTest_testDisabled;
+
+static class TestDescription_suite_ActivityTrackerTest_testTrack : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testTrack() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 111, "testTrack" ) {}
+ void runTest() { suite_ActivityTrackerTest.testTrack(); }
+} testDescription_suite_ActivityTrackerTest_testTrack;
+
+static class TestDescription_suite_ActivityTrackerTest_testParallelTrackMatchesSerial : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testParallelTrackMatchesSerial() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 160, "testParallelTrackMatchesSerial" ) {}
+ void runTest() { suite_ActivityTrackerTest.testParallelTrackMatchesSerial(); }
+} testDescription_suite_ActivityTrackerTest_testParallelTrackMatchesSerial;
+
+static class TestDescription_suite_ActivityTrackerTest_testSimulatorsMatchFullUpdates : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testSimulatorsMatchFullUpdates() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 187, "testSimulatorsMatchFullUpdates" ) {}
+ void runTest() { suite_ActivityTrackerTest.testSimulatorsMatchFullUpdates(); }
+} testDescription_suite_ActivityTrackerTest_testSimulatorsMatchFullUpdates;
+
@@ -0,0 +1,216 @@
+#include <libgeodecomp/io/simpleinitializer.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/parallelization/openmpsimulator.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/storage/activitytracker.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * A simple bush fire: unburnt cells (0) catch fire (1) if any of
+ * their neighbors is burning and burn down (2) in the next step.
+ */
+template<typename GRID_API>
+class ActivityTrackerTestCell
+{
+public:
+    class API :
+        public APITraits::HasTorusTopology<2>,
+        public GRID_API
+    {};
+
+    explicit ActivityTrackerTestCell(int state = 0) :
+        state(state),
+        changed(false)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, unsigned /* nanoStep */)
+    {
+        ++updates;
+        int oldState = hood[FixedCoord<0, 0>()].state;
+        state = oldState;
+
+        if (oldState == 1) {
+            state = 2;
+        }
+        if ((oldState == 0) &&
+            ((hood[FixedCoord< 0, -1>()].state == 1) ||
+             (hood[FixedCoord<-1,  0>()].state == 1) ||
+             (hood[FixedCoord< 1,  0>()].state == 1) ||
+             (hood[FixedCoord< 0,  1>()].state == 1))) {
+            state = 1;
+        }
+
+        changed = (state != oldState);
+    }
+
+    bool hasChanged() const
+    {
+        return changed;
+    }
+
+    int state;
+    bool changed;
+    static int updates;
+};
+
+template<typename GRID_API>
+int ActivityTrackerTestCell<GRID_API>::updates = 0;
+
+/**
+ * API mixin for reference cells which don't track their activity.
+ */
+class ActivityTrackerTestNoTracking
+{};
+
+template<typename CELL>
+class ActivityTrackerTestInitializer : public SimpleInitializer<CELL>
+{
+public:
+    ActivityTrackerTestInitializer() :
+        SimpleInitializer<CELL>(Coord<2>(64, 48), 30)
+    {}
+
+    virtual void grid(GridBase<CELL, 2> *target)
+    {
+        CoordBox<2> box = target->boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            target->set(*i, CELL());
+        }
+
+        target->set(Coord<2>(10, 20), CELL(1));
+        target->set(Coord<2>(62,  1), CELL(1));
+    }
+};
+
+class ActivityTrackerTest : public CxxTest::TestSuite
+{
+public:
+    typedef ActivityTrackerTestCell<APITraits::HasActivityTracking> TrackedCell;
+    typedef ActivityTrackerTestCell<ActivityTrackerTestNoTracking> PlainCell;
+
+    void testDisabled()
+    {
+        TS_ASSERT(!ActivityTracker<TestCell<2> >::ENABLED);
+        TS_ASSERT(!ActivityTracker<PlainCell>::ENABLED);
+
+        Region<2> simArea;
+        simArea << CoordBox<2>(Coord<2>(), Coord<2>(10, 10));
+        ActivityTracker<TestCell<2> > tracker;
+        tracker.track(Grid<TestCell<2> >(Coord<2>(10, 10)), simArea);
+        TS_ASSERT_EQUALS(&simArea, &tracker.updateRegion(simArea));
+    }
+
+    void testTrack()
+    {
+        TS_ASSERT(ActivityTracker<TrackedCell>::ENABLED);
+
+        Coord<2> dim(20, 10);
+        Region<2> simArea;
+        simArea << CoordBox<2>(Coord<2>(), dim);
+        Grid<TrackedCell, Topologies::Torus<2>::Topology> grid(dim);
+
+        ActivityTracker<TrackedCell> tracker;
+        TS_ASSERT_EQUALS(simArea, tracker.updateRegion(simArea));
+
+        grid[Coord<2>( 5, 5)].changed = true;
+        grid[Coord<2>( 6, 5)].changed = true;
+        grid[Coord<2>(19, 0)].changed = true;
+        tracker.track(grid, simArea);
+
+        // changed cells are dilated by the stencil's radius (wrapping
+        // around the torus):
+        Region<2> expected;
+        expected << CoordBox<2>(Coord<2>( 4, 4), Coord<2>(4, 3))
+                 << CoordBox<2>(Coord<2>(18, 0), Coord<2>(2, 2))
+                 << CoordBox<2>(Coord<2>( 0, 0), Coord<2>(1, 2))
+                 << Streak<2>(Coord<2>(18, 9), 20)
+                 << Streak<2>(Coord<2>( 0, 9),  1);
+        TS_ASSERT_EQUALS(expected, tracker.updateRegion(simArea));
+
+        // ...and clipped to the simulation area:
+        Region<2> smallArea;
+        smallArea << CoordBox<2>(Coord<2>(), Coord<2>(5, 10));
+        Region<2> expectedSmall;
+        expectedSmall << Streak<2>(Coord<2>(4, 4), 5)
+                      << Streak<2>(Coord<2>(4, 5), 5)
+                      << Streak<2>(Coord<2>(4, 6), 5)
+                      << Streak<2>(Coord<2>(0, 0), 1)
+                      << Streak<2>(Coord<2>(0, 1), 1)
+                      << Streak<2>(Coord<2>(0, 9), 1);
+        TS_ASSERT_EQUALS(expectedSmall, tracker.updateRegion(smallArea));
+
+        grid[Coord<2>( 5, 5)].changed = false;
+        grid[Coord<2>( 6, 5)].changed = false;
+        grid[Coord<2>(19, 0)].changed = false;
+        tracker.track(grid, simArea);
+        TS_ASSERT(tracker.updateRegion(simArea).empty());
+
+        tracker.reset();
+        TS_ASSERT_EQUALS(simArea, tracker.updateRegion(simArea));
+    }
+
+    void testParallelTrackMatchesSerial()
+    {
+        // two streaks per row yield a multitude of chunks:
+        Coord<2> dim(300, 700);
+        Region<2> simArea;
+        for (int y = 0; y < dim.y(); ++y) {
+            simArea << Streak<2>(Coord<2>(  0, y), 140)
+                    << Streak<2>(Coord<2>(150, y), 300);
+        }
+        Grid<TrackedCell, Topologies::Torus<2>::Topology> grid(dim);
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                grid[Coord<2>(x, y)].changed = ((x * 7 + y * 13) % 97 < 3);
+            }
+        }
+
+        ActivityTracker<TrackedCell> serial;
+        ActivityTracker<TrackedCell> parallel;
+        serial.track(grid, simArea);
+        parallel.track(grid, simArea, true);
+
+        Region<2> whole;
+        whole << CoordBox<2>(Coord<2>(), dim);
+        TS_ASSERT(!serial.updateRegion(whole).empty());
+        TS_ASSERT_EQUALS(serial.updateRegion(whole), parallel.updateRegion(whole));
+    }
+
+    void testSimulatorsMatchFullUpdates()
+    {
+        SerialSimulator<PlainCell> reference(new ActivityTrackerTestInitializer<PlainCell>());
+        SerialSimulator<TrackedCell> serial(new ActivityTrackerTestInitializer<TrackedCell>());
+        OpenMPSimulator<TrackedCell> openMP(new ActivityTrackerTestInitializer<TrackedCell>());
+        openMP.setPersistentThreadTeam(true);
+
+        PlainCell::updates = 0;
+        reference.run();
+        TrackedCell::updates = 0;
+        serial.run();
+        int trackedUpdates = TrackedCell::updates;
+        openMP.run();
+
+        CoordBox<2> box = reference.getGrid()->boundingBox();
+        int burnt = 0;
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).state, serial.getGrid()->get(*i).state);
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).state, openMP.getGrid()->get(*i).state);
+            burnt += (reference.getGrid()->get(*i).state == 2);
+        }
+
+        // the fire has spread, but only the front has been updated:
+        TS_ASSERT_LESS_THAN(100, burnt);
+        TS_ASSERT_EQUALS(int(box.size() * 30), PlainCell::updates);
+        TS_ASSERT_LESS_THAN(trackedUpdates * 3, PlainCell::updates);
+    }
+};
+
+}
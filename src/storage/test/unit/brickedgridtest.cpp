@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BrickedGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/brickedgridtest.h"
+
+static BrickedGridTest suite_BrickedGridTest;
+
+static CxxTest::List Tests_BrickedGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BrickedGridTest( "/root/repo/src/storage/test/unit/brickedgridtest.h", 52, "BrickedGridTest", suite_BrickedGridTest, Tests_BrickedGridTest );
+
+static class TestDescription_suite_BrickedGridTest_testSetGet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testSetGet() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 58, "testSetGet" ) {}
+ void runTest() { suite_BrickedGridTest.testSetGet(); }
+} testDescription_suite_BrickedGridTest_testSetGet;
+
+static class TestDescription_suite_BrickedGridTest_testBrickLayout : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testBrickLayout() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 99, "testBrickLayout" ) {}
+ void runTest() { suite_BrickedGridTest.testBrickLayout(); }
+} testDescription_suite_BrickedGridTest_testBrickLayout;
+
+static class TestDescription_suite_BrickedGridTest_testTopology : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testTopology() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 123, "testTopology" ) {}
+ void runTest() { suite_BrickedGridTest.testTopology(); }
+} testDescription_suite_BrickedGridTest_testTopology;
+
+static class TestDescription_suite_BrickedGridTest_testNeighborhood : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testNeighborhood() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 136, "testNeighborhood" ) {}
+ void runTest() { suite_BrickedGridTest.testNeighborhood(); }
+} testDescription_suite_BrickedGridTest_testNeighborhood;
+
+static class TestDescription_suite_BrickedGridTest_testSaveLoadMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testSaveLoadMember() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 142, "testSaveLoadMember" ) {}
+ void runTest() { suite_BrickedGridTest.testSaveLoadMember(); }
+} testDescription_suite_BrickedGridTest_testSaveLoadMember;
+
+static class TestDescription_suite_BrickedGridTest_testUpdateMatchesGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testUpdateMatchesGrid() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 176, "testUpdateMatchesGrid" ) {}
+ void runTest() { suite_BrickedGridTest.testUpdateMatchesGrid(); }
+} testDescription_suite_BrickedGridTest_testUpdateMatchesGrid;
+
+static class TestDescription_suite_BrickedGridTest_testMonolithicGridTypeSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BrickedGridTest_testMonolithicGridTypeSelector() : CxxTest::RealTestDescription( Tests_BrickedGridTest, suiteDescription_BrickedGridTest, 182, "testMonolithicGridTypeSelector" ) {}
+ void runTest() { suite_BrickedGridTest.testMonolithicGridTypeSelector(); }
+} testDescription_suite_BrickedGridTest_testMonolithicGridTypeSelector;
+
@@ -0,0 +1,272 @@
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/brickedgrid.h>
+#include <libgeodecomp/storage/grid.h>
+#include <libgeodecomp/storage/gridtypeselector.h>
+#include <libgeodecomp/storage/vanillaupdatefunctor.h>
+
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Sums up a 3D stencil with a reach of 2 along all axes, so that
+ * many neighbor accesses cross brick boundaries.
+ */
+template<typename TOPOLOGY_API>
+class BrickedGridTestCell
+{
+public:
+    class API :
+        public TOPOLOGY_API,
+        public APITraits::HasStencil<Stencils::VonNeumann<3, 2> >,
+        public APITraits::HasBrickedGrid
+    {};
+
+    explicit BrickedGridTestCell(int value = 0) :
+        value(value)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, unsigned /* nanoStep */)
+    {
+        value =
+            1 * hood[FixedCoord< 0,  0, -2>()].value +
+            2 * hood[FixedCoord< 0, -1,  0>()].value +
+            3 * hood[FixedCoord<-2,  0,  0>()].value +
+            4 * hood[FixedCoord< 0,  0,  0>()].value +
+            5 * hood[FixedCoord< 1,  0,  0>()].value +
+            6 * hood[FixedCoord< 0,  2,  0>()].value +
+            7 * hood[FixedCoord< 0,  0,  1>()].value +
+            8 * hood[Coord<3>(1, 1, 1)].value;
+        value %= 1000003;
+    }
+
+    int value;
+};
+
+class BrickedGridTest : public CxxTest::TestSuite
+{
+public:
+    typedef Topologies::Cube<3>::Topology Cube;
+    typedef Topologies::Torus<3>::Topology Torus;
+
+    void testSetGet()
+    {
+        // dimensions are deliberately no multiples of the brick size:
+        CoordBox<3> box(Coord<3>(-3, 2, 1), Coord<3>(19, 10, 17));
+        BrickedGrid<int, Cube> grid(box, 1, -1);
+        TS_ASSERT_EQUALS(box, grid.boundingBox());
+        TS_ASSERT_EQUALS(1, grid.get(Coord<3>(0, 5, 5)));
+        TS_ASSERT_EQUALS(-1, grid.get(Coord<3>(-4, 5, 5)));
+        TS_ASSERT_EQUALS(-1, grid.get(Coord<3>(0, 5, 18)));
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid.set(*i, value(*i));
+        }
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(value(*i), grid.get(*i));
+        }
+
+        // streaks which span several bricks:
+        std::vector<int> buffer(19);
+        Streak<3> streak(Coord<3>(-3, 7, 12), 16);
+        grid.get(streak, &buffer[0]);
+        for (int x = -3; x < 16; ++x) {
+            TS_ASSERT_EQUALS(value(Coord<3>(x, 7, 12)), buffer[x + 3]);
+        }
+
+        for (int i = 0; i < 15; ++i) {
+            buffer[i] = -100 - i;
+        }
+        grid.set(Streak<3>(Coord<3>(0, 7, 12), 15), &buffer[0]);
+        TS_ASSERT_EQUALS(value(Coord<3>(-1, 7, 12)), grid.get(Coord<3>(-1, 7, 12)));
+        TS_ASSERT_EQUALS(-100, grid.get(Coord<3>( 0, 7, 12)));
+        TS_ASSERT_EQUALS(-104, grid.get(Coord<3>( 4, 7, 12)));
+        TS_ASSERT_EQUALS(-105, grid.get(Coord<3>( 5, 7, 12)));
+        TS_ASSERT_EQUALS(-114, grid.get(Coord<3>(14, 7, 12)));
+        TS_ASSERT_EQUALS(value(Coord<3>(15, 7, 12)), grid.get(Coord<3>(15, 7, 12)));
+
+        grid.setEdge(47);
+        TS_ASSERT_EQUALS(47, grid.getEdge());
+        TS_ASSERT_EQUALS(47, grid[Coord<3>(16, 7, 12)]);
+    }
+
+    void testBrickLayout()
+    {
+        BrickedGrid<int, Cube> grid(CoordBox<3>(Coord<3>(), Coord<3>(16, 16, 16)));
+        const int *base = grid.cellAddress(Coord<3>(0, 0, 0));
+
+        // cells within a brick are stored in row-major order...
+        TS_ASSERT_EQUALS(1,  grid.cellAddress(Coord<3>(1, 0, 0)) - base);
+        TS_ASSERT_EQUALS(8,  grid.cellAddress(Coord<3>(0, 1, 0)) - base);
+        TS_ASSERT_EQUALS(64, grid.cellAddress(Coord<3>(0, 0, 1)) - base);
+        TS_ASSERT_EQUALS(511, grid.cellAddress(Coord<3>(7, 7, 7)) - base);
+
+        // ...while the bricks follow the Z-order curve:
+        TS_ASSERT_EQUALS(1 * 512, grid.cellAddress(Coord<3>(8, 0, 0)) - base);
+        TS_ASSERT_EQUALS(2 * 512, grid.cellAddress(Coord<3>(0, 8, 0)) - base);
+        TS_ASSERT_EQUALS(3 * 512, grid.cellAddress(Coord<3>(8, 8, 0)) - base);
+        TS_ASSERT_EQUALS(4 * 512, grid.cellAddress(Coord<3>(0, 0, 8)) - base);
+        TS_ASSERT_EQUALS(7 * 512, grid.cellAddress(Coord<3>(8, 8, 8)) - base);
+
+        // bricks are padded if the grid's dimensions aren't multiples
+        // of the brick size:
+        BrickedGrid<int, Cube, 4> smallBricks(CoordBox<3>(Coord<3>(), Coord<3>(9, 4, 5)));
+        TS_ASSERT_EQUALS(std::size_t(3 * 1 * 2 * 64), smallBricks.cells.size());
+    }
+
+    void testTopology()
+    {
+        CoordBox<3> box(Coord<3>(10, 20, 30), Coord<3>(9, 10, 11));
+        BrickedGrid<int, Torus> grid(box, 0, -1);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid.set(*i, value(*i));
+        }
+
+        TS_ASSERT_EQUALS(value(Coord<3>(18, 20, 30)), grid[Coord<3>( 9, 20, 30)]);
+        TS_ASSERT_EQUALS(value(Coord<3>(10, 20, 30)), grid[Coord<3>(19, 30, 41)]);
+        TS_ASSERT_EQUALS(value(Coord<3>(11, 29, 40)), grid[Coord<3>(11, 19, 29)]);
+    }
+
+    void testNeighborhood()
+    {
+        checkNeighborhood<Cube>();
+        checkNeighborhood<Torus>();
+    }
+
+    void testSaveLoadMember()
+    {
+        CoordBox<3> box(Coord<3>(), Coord<3>(12, 11, 10));
+        BrickedGrid<TestCell<3>, Cube> grid(box);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TestCell<3> cell;
+            cell.testValue = value(*i);
+            grid.set(*i, cell);
+        }
+
+        Region<3> region;
+        region << Streak<3>(Coord<3>(0, 1, 2), 12)
+               << Streak<3>(Coord<3>(5, 9, 9), 10);
+        std::vector<double> buffer(region.size());
+        Selector<TestCell<3> > selector(&TestCell<3>::testValue, "testValue");
+
+        grid.saveMember(&buffer[0], MemoryLocation::HOST, selector, region);
+        std::vector<double>::iterator iter = buffer.begin();
+        for (Region<3>::Iterator i = region.begin(); i != region.end(); ++i) {
+            TS_ASSERT_EQUALS(value(*i), *iter);
+            *iter = -*iter;
+            ++iter;
+        }
+
+        grid.loadMember(&buffer[0], MemoryLocation::HOST, selector, region);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            double expected = value(*i);
+            if (region.count(*i)) {
+                expected = -expected;
+            }
+            TS_ASSERT_EQUALS(expected, grid.get(*i).testValue);
+        }
+    }
+
+    void testUpdateMatchesGrid()
+    {
+        checkUpdate<APITraits::HasCubeTopology<3> >();
+        checkUpdate<APITraits::HasTorusTopology<3> >();
+    }
+
+    void testMonolithicGridTypeSelector()
+    {
+        typedef BrickedGridTestCell<APITraits::HasTorusTopology<3> > CellType;
+        typedef MonolithicGridTypeSelector<
+            CellType,
+            Torus,
+            APITraits::FalseType>::Value BrickedType;
+        BOOST_STATIC_ASSERT((boost::is_same<
+                             BrickedType,
+                             BrickedGrid<CellType, Torus> >::value));
+
+        // TestCell doesn't ask for bricks:
+        typedef MonolithicGridTypeSelector<
+            TestCell<3>,
+            Cube,
+            APITraits::FalseType>::Value PlainType;
+        BOOST_STATIC_ASSERT((boost::is_same<
+                             PlainType,
+                             DisplacedGrid<TestCell<3>, Cube, false> >::value));
+    }
+
+private:
+    static int value(const Coord<3>& c)
+    {
+        return c.x() * 10000 + c.y() * 100 + c.z();
+    }
+
+    template<typename TOPOLOGY>
+    void checkNeighborhood()
+    {
+        CoordBox<3> box(Coord<3>(-1, -2, -3), Coord<3>(11, 13, 10));
+        BrickedGrid<int, TOPOLOGY> grid(box, 0, -1);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid.set(*i, value(*i));
+        }
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            typename BrickedGrid<int, TOPOLOGY>::NeighborhoodType hood = grid.getNeighborhood(*i);
+
+            for (int z = -2; z <= 2; ++z) {
+                for (int y = -2; y <= 2; ++y) {
+                    for (int x = -2; x <= 2; ++x) {
+                        Coord<3> offset(x, y, z);
+                        TS_ASSERT_EQUALS(grid[*i + offset], hood[offset]);
+                    }
+                }
+            }
+
+            TS_ASSERT_EQUALS(grid[*i + Coord<3>(-1,  0,  0)], (hood[FixedCoord<-1,  0,  0>()]));
+            TS_ASSERT_EQUALS(grid[*i + Coord<3>( 1,  1,  0)], (hood[FixedCoord< 1,  1,  0>()]));
+            TS_ASSERT_EQUALS(grid[*i + Coord<3>( 0, -2,  2)], (hood[FixedCoord< 0, -2,  2>()]));
+        }
+    }
+
+    template<typename TOPOLOGY_API>
+    void checkUpdate()
+    {
+        typedef BrickedGridTestCell<TOPOLOGY_API> CellType;
+        typedef typename APITraits::SelectTopology<CellType>::Value Topology;
+
+        Coord<3> dim(19, 10, 12);
+        CoordBox<3> box(Coord<3>(), dim);
+
+        Grid<CellType, Topology> referenceOld(dim, CellType(), CellType(-5));
+        Grid<CellType, Topology> referenceNew(dim, CellType(), CellType(-5));
+        BrickedGrid<CellType, Topology> brickedOld(box, CellType(), CellType(-5));
+        BrickedGrid<CellType, Topology> brickedNew(box, CellType(), CellType(-5));
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            CellType cell(i->x() * 31 + i->y() * 7 + i->z() * 3);
+            referenceOld[*i] = cell;
+            brickedOld[*i] = cell;
+        }
+
+        for (int step = 0; step < 4; ++step) {
+            for (CoordBox<3>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+                Streak<3> streak = *i;
+                VanillaUpdateFunctor<CellType>()(streak, streak.origin, referenceOld, &referenceNew, 0);
+                VanillaUpdateFunctor<CellType>()(streak, streak.origin, brickedOld, &brickedNew, 0);
+            }
+            std::swap(referenceOld, referenceNew);
+            std::swap(brickedOld, brickedNew);
+        }
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(referenceOld[*i].value, brickedOld[*i].value);
+        }
+    }
+};
+
+}
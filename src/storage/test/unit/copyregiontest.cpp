@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CopyRegionTest_init = false;
+#include "/root/repo/src/storage/test/unit/copyregiontest.h"
+
+static CopyRegionTest suite_CopyRegionTest;
+
+static CxxTest::List Tests_CopyRegionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CopyRegionTest( "/root/repo/src/storage/test/unit/copyregiontest.h", 59, "CopyRegionTest", suite_CopyRegionTest, Tests_CopyRegionTest );
+
+static class TestDescription_suite_CopyRegionTest_testAoSToAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testAoSToAoS() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 76, "testAoSToAoS" ) {}
+ void runTest() { suite_CopyRegionTest.testAoSToAoS(); }
+} testDescription_suite_CopyRegionTest_testAoSToAoS;
+
+static class TestDescription_suite_CopyRegionTest_testAoSToSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testAoSToSoA() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 86, "testAoSToSoA" ) {}
+ void runTest() { suite_CopyRegionTest.testAoSToSoA(); }
+} testDescription_suite_CopyRegionTest_testAoSToSoA;
+
+static class TestDescription_suite_CopyRegionTest_testSoAToAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testSoAToAoS() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 96, "testSoAToAoS" ) {}
+ void runTest() { suite_CopyRegionTest.testSoAToAoS(); }
+} testDescription_suite_CopyRegionTest_testSoAToAoS;
+
+static class TestDescription_suite_CopyRegionTest_testSoAToSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testSoAToSoA() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 106, "testSoAToSoA" ) {}
+ void runTest() { suite_CopyRegionTest.testSoAToSoA(); }
+} testDescription_suite_CopyRegionTest_testSoAToSoA;
+
+static class TestDescription_suite_CopyRegionTest_testOneCallPerStreak : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testOneCallPerStreak() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 121, "testOneCallPerStreak" ) {}
+ void runTest() { suite_CopyRegionTest.testOneCallPerStreak(); }
+} testDescription_suite_CopyRegionTest_testOneCallPerStreak;
+
+static class TestDescription_suite_CopyRegionTest_testFallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testFallback() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 134, "testFallback" ) {}
+ void runTest() { suite_CopyRegionTest.testFallback(); }
+} testDescription_suite_CopyRegionTest_testFallback;
+
+static class TestDescription_suite_CopyRegionTest_testStreakAddress : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testStreakAddress() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 147, "testStreakAddress" ) {}
+ void runTest() { suite_CopyRegionTest.testStreakAddress(); }
+} testDescription_suite_CopyRegionTest_testStreakAddress;
+
+static class TestDescription_suite_CopyRegionTest_testGridFromSoAGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CopyRegionTest_testGridFromSoAGrid() : CxxTest::RealTestDescription( Tests_CopyRegionTest, suiteDescription_CopyRegionTest, 162, "testGridFromSoAGrid" ) {}
+ void runTest() { suite_CopyRegionTest.testGridFromSoAGrid(); }
+} testDescription_suite_CopyRegionTest_testGridFromSoAGrid;
+
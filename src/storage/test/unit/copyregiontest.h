@@ -0,0 +1,201 @@
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/copyregion.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/grid.h>
+#include <libgeodecomp/storage/soagrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+typedef DisplacedGrid<TestCellSoA, Topologies::Cube<3>::Topology> DisplacedGridType;
+
+/**
+ * Counts the streak-wise accesses and optionally hides its memory
+ * layout from copyRegion().
+ */
+class CountingGrid : public DisplacedGridType
+{
+public:
+    explicit CountingGrid(const CoordBox<3>& box, bool exposeStreaks) :
+        DisplacedGridType(box),
+        exposeStreaks(exposeStreaks),
+        streakGets(0),
+        streakSets(0)
+    {}
+
+    using DisplacedGridType::get;
+    using DisplacedGridType::set;
+
+    virtual void set(const Streak<3>& streak, const TestCellSoA *cells)
+    {
+        ++streakSets;
+        DisplacedGridType::set(streak, cells);
+    }
+
+    virtual void get(const Streak<3>& streak, TestCellSoA *cells) const
+    {
+        ++streakGets;
+        DisplacedGridType::get(streak, cells);
+    }
+
+    virtual TestCellSoA *streakAddress(const Streak<3>& streak)
+    {
+        return exposeStreaks ? DisplacedGridType::streakAddress(streak) : 0;
+    }
+
+    virtual const TestCellSoA *streakAddress(const Streak<3>& streak) const
+    {
+        return exposeStreaks ? DisplacedGridType::streakAddress(streak) : 0;
+    }
+
+    bool exposeStreaks;
+    mutable int streakGets;
+    int streakSets;
+};
+
+class CopyRegionTest : public CxxTest::TestSuite
+{
+public:
+    typedef Topologies::Cube<3>::Topology Topology;
+
+    void setUp()
+    {
+        box = CoordBox<3>(Coord<3>(-2, -3, -4), Coord<3>(13, 12, 11));
+        dim = Coord<3>(20, 20, 20);
+
+        region.clear();
+        region << Streak<3>(Coord<3>(-2, -3, -4), 11)
+               << Streak<3>(Coord<3>( 0,  5,  0), 3)
+               << Streak<3>(Coord<3>( 5,  5,  0), 9)
+               << CoordBox<3>(Coord<3>(1, 0, 2), Coord<3>(7, 4, 3));
+    }
+
+    void testAoSToAoS()
+    {
+        DisplacedGridType source(box);
+        DisplacedGridType target(box);
+        fill(&source);
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+    }
+
+    void testAoSToSoA()
+    {
+        DisplacedGridType source(box);
+        SoAGrid<TestCellSoA, Topology> target(box);
+        fill(&source);
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+    }
+
+    void testSoAToAoS()
+    {
+        SoAGrid<TestCellSoA, Topology> source(box);
+        DisplacedGridType target(box);
+        fill(&source);
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+    }
+
+    void testSoAToSoA()
+    {
+        // target may have a different bounding box as long as it
+        // contains the region:
+        SoAGrid<TestCellSoA, Topology> source(box);
+        SoAGrid<TestCellSoA, Topology> target(CoordBox<3>(Coord<3>(-5, -5, -5), Coord<3>(20, 20, 20)));
+        fill(&source);
+
+        TS_ASSERT_EQUALS(source.packedCellSize(), target.packedCellSize());
+        TS_ASSERT_EQUALS(std::size_t(0), DisplacedGridType().packedCellSize());
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+    }
+
+    void testOneCallPerStreak()
+    {
+        CountingGrid source(box, true);
+        CountingGrid target(box, true);
+        fill(&source);
+        source.streakSets = 0;
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+        TS_ASSERT_EQUALS(0, source.streakGets);
+        TS_ASSERT_EQUALS(int(region.numStreaks()), target.streakSets);
+    }
+
+    void testFallback()
+    {
+        CountingGrid source(box, false);
+        CountingGrid target(box, false);
+        fill(&source);
+        source.streakSets = 0;
+
+        copyRegion<TestCellSoA, 3>(source, &target, region);
+        checkCopy(target);
+        TS_ASSERT_EQUALS(int(region.numStreaks()), source.streakGets);
+        TS_ASSERT_EQUALS(int(region.numStreaks()), target.streakSets);
+    }
+
+    void testStreakAddress()
+    {
+        Grid<int> grid(Coord<2>(10, 5));
+        TS_ASSERT_EQUALS(&grid[Coord<2>(2, 3)], grid.streakAddress(Streak<2>(Coord<2>(2, 3), 10)));
+        TS_ASSERT_EQUALS((int*)0, grid.streakAddress(Streak<2>(Coord<2>(2, 3), 11)));
+        TS_ASSERT_EQUALS((int*)0, grid.streakAddress(Streak<2>(Coord<2>(-1, 3), 5)));
+        TS_ASSERT_EQUALS((int*)0, grid.streakAddress(Streak<2>(Coord<2>(2, 5), 5)));
+
+        DisplacedGrid<int> displacedGrid(CoordBox<2>(Coord<2>(-5, -5), Coord<2>(10, 10)));
+        TS_ASSERT_EQUALS(
+            &displacedGrid[Coord<2>(-5, 4)],
+            displacedGrid.streakAddress(Streak<2>(Coord<2>(-5, 4), 5)));
+        TS_ASSERT_EQUALS((int*)0, displacedGrid.streakAddress(Streak<2>(Coord<2>(-5, 5), 5)));
+    }
+
+    void testGridFromSoAGrid()
+    {
+        SoAGrid<TestCellSoA, Topology> source(box);
+        fill(&source);
+        source.setEdge(TestCellSoA(Coord<3>(-1, -1, -1), dim));
+
+        Grid<TestCellSoA, Topology> grid(source);
+        TS_ASSERT_EQUALS(box.dimensions, grid.getDimensions());
+        TS_ASSERT_EQUALS(source.getEdge(), grid.getEdge());
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(source.get(*i), grid[*i - box.origin]);
+        }
+    }
+
+private:
+    CoordBox<3> box;
+    Coord<3> dim;
+    Region<3> region;
+
+    void fill(GridBase<TestCellSoA, 3> *grid)
+    {
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid->set(*i, TestCellSoA(*i, dim, 0, i->x() * 100 + i->y()));
+        }
+    }
+
+    void checkCopy(const GridBase<TestCellSoA, 3>& grid)
+    {
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TestCellSoA expected;
+            if (region.count(*i)) {
+                expected = TestCellSoA(*i, dim, 0, i->x() * 100 + i->y());
+            }
+
+            TS_ASSERT_EQUALS(expected, grid.get(*i));
+        }
+    }
+};
+
+}
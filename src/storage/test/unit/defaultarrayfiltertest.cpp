@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DefaultArrayFilterTest_init = false;
+#include "/root/repo/src/storage/test/unit/defaultarrayfiltertest.h"
+
+static DefaultArrayFilterTest suite_DefaultArrayFilterTest;
+
+static CxxTest::List Tests_DefaultArrayFilterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DefaultArrayFilterTest( "/root/repo/src/storage/test/unit/defaultarrayfiltertest.h", 40, "DefaultArrayFilterTest", suite_DefaultArrayFilterTest, Tests_DefaultArrayFilterTest );
+
+static class TestDescription_suite_DefaultArrayFilterTest_testHostAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultArrayFilterTest_testHostAoS() : CxxTest::RealTestDescription( Tests_DefaultArrayFilterTest, suiteDescription_DefaultArrayFilterTest, 43, "testHostAoS" ) {}
+ void runTest() { suite_DefaultArrayFilterTest.testHostAoS(); }
+} testDescription_suite_DefaultArrayFilterTest_testHostAoS;
+
+static class TestDescription_suite_DefaultArrayFilterTest_testHostSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultArrayFilterTest_testHostSoA() : CxxTest::RealTestDescription( Tests_DefaultArrayFilterTest, suiteDescription_DefaultArrayFilterTest, 92, "testHostSoA" ) {}
+ void runTest() { suite_DefaultArrayFilterTest.testHostSoA(); }
+} testDescription_suite_DefaultArrayFilterTest_testHostSoA;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FirstTouchAllocatorTest_init = false;
+#include "/root/repo/src/storage/test/unit/firsttouchallocatortest.h"
+
+static FirstTouchAllocatorTest suite_FirstTouchAllocatorTest;
+
+static CxxTest::List Tests_FirstTouchAllocatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FirstTouchAllocatorTest( "/root/repo/src/storage/test/unit/firsttouchallocatortest.h", 11, "FirstTouchAllocatorTest", suite_FirstTouchAllocatorTest, Tests_FirstTouchAllocatorTest );
+
+static class TestDescription_suite_FirstTouchAllocatorTest_testSmallAndLargeVectors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchAllocatorTest_testSmallAndLargeVectors() : CxxTest::RealTestDescription( Tests_FirstTouchAllocatorTest, suiteDescription_FirstTouchAllocatorTest, 14, "testSmallAndLargeVectors" ) {}
+ void runTest() { suite_FirstTouchAllocatorTest.testSmallAndLargeVectors(); }
+} testDescription_suite_FirstTouchAllocatorTest_testSmallAndLargeVectors;
+
+static class TestDescription_suite_FirstTouchAllocatorTest_testRebind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchAllocatorTest_testRebind() : CxxTest::RealTestDescription( Tests_FirstTouchAllocatorTest, suiteDescription_FirstTouchAllocatorTest, 31, "testRebind" ) {}
+ void runTest() { suite_FirstTouchAllocatorTest.testRebind(); }
+} testDescription_suite_FirstTouchAllocatorTest_testRebind;
+
+static class TestDescription_suite_FirstTouchAllocatorTest_testGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchAllocatorTest_testGrid() : CxxTest::RealTestDescription( Tests_FirstTouchAllocatorTest, suiteDescription_FirstTouchAllocatorTest, 40, "testGrid" ) {}
+ void runTest() { suite_FirstTouchAllocatorTest.testGrid(); }
+} testDescription_suite_FirstTouchAllocatorTest_testGrid;
+
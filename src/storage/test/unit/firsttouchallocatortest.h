@@ -0,0 +1,48 @@
+#include <libgeodecomp/storage/firsttouchallocator.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+#include <vector>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class FirstTouchAllocatorTest : public CxxTest::TestSuite
+{
+public:
+    void testSmallAndLargeVectors()
+    {
+        // small vectors won't be touched in parallel, large ones will:
+        std::size_t sizes[] = { 1, 100, 1 << 20 };
+
+        for (int i = 0; i < 3; ++i) {
+            std::vector<double, FirstTouchAllocator<double, 64> > vec(sizes[i], 1.5);
+            TS_ASSERT_EQUALS(std::size_t(0), reinterpret_cast<std::size_t>(&vec[0]) % 64);
+
+            double sum = 0;
+            for (std::size_t j = 0; j < vec.size(); ++j) {
+                sum += vec[j];
+            }
+            TS_ASSERT_EQUALS(1.5 * sizes[i], sum);
+        }
+    }
+
+    void testRebind()
+    {
+        typedef FirstTouchAllocator<double, 64>::rebind<char>::other CharAllocator;
+        CharAllocator allocator;
+        char *buffer = allocator.allocate(1 << 22);
+        TS_ASSERT_EQUALS(std::size_t(0), reinterpret_cast<std::size_t>(buffer) % 64);
+        allocator.deallocate(buffer, 1 << 22);
+    }
+
+    void testGrid()
+    {
+        Grid<int, Topologies::Cube<3>::Topology> grid(Coord<3>(200, 100, 50), 47);
+        TS_ASSERT_EQUALS(47, grid[Coord<3>(0, 0, 0)]);
+        TS_ASSERT_EQUALS(47, grid[Coord<3>(199, 99, 49)]);
+    }
+};
+
+}
@@ -0,0 +1,81 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FixedArrayTest_init = false;
+#include "/root/repo/src/storage/test/unit/fixedarraytest.h"
+
+static FixedArrayTest suite_FixedArrayTest;
+
+static CxxTest::List Tests_FixedArrayTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedArrayTest( "/root/repo/src/storage/test/unit/fixedarraytest.h", 8, "FixedArrayTest", suite_FixedArrayTest, Tests_FixedArrayTest );
+
+static class TestDescription_suite_FixedArrayTest_testInsertDelete : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testInsertDelete() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 12, "testInsertDelete" ) {}
+ void runTest() { suite_FixedArrayTest.testInsertDelete(); }
+} testDescription_suite_FixedArrayTest_testInsertDelete;
+
+static class TestDescription_suite_FixedArrayTest_testConstructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testConstructors() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 47, "testConstructors" ) {}
+ void runTest() { suite_FixedArrayTest.testConstructors(); }
+} testDescription_suite_FixedArrayTest_testConstructors;
+
+static class TestDescription_suite_FixedArrayTest_testAddition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testAddition() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 81, "testAddition" ) {}
+ void runTest() { suite_FixedArrayTest.testAddition(); }
+} testDescription_suite_FixedArrayTest_testAddition;
+
+static class TestDescription_suite_FixedArrayTest_testSubstraction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testSubstraction() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 97, "testSubstraction" ) {}
+ void runTest() { suite_FixedArrayTest.testSubstraction(); }
+} testDescription_suite_FixedArrayTest_testSubstraction;
+
+static class TestDescription_suite_FixedArrayTest_testDivision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testDivision() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 115, "testDivision" ) {}
+ void runTest() { suite_FixedArrayTest.testDivision(); }
+} testDescription_suite_FixedArrayTest_testDivision;
+
+static class TestDescription_suite_FixedArrayTest_testMultiplication : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testMultiplication() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 128, "testMultiplication" ) {}
+ void runTest() { suite_FixedArrayTest.testMultiplication(); }
+} testDescription_suite_FixedArrayTest_testMultiplication;
+
+static class TestDescription_suite_FixedArrayTest_testComparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testComparison() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 141, "testComparison" ) {}
+ void runTest() { suite_FixedArrayTest.testComparison(); }
+} testDescription_suite_FixedArrayTest_testComparison;
+
+static class TestDescription_suite_FixedArrayTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testToString() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 188, "testToString" ) {}
+ void runTest() { suite_FixedArrayTest.testToString(); }
+} testDescription_suite_FixedArrayTest_testToString;
+
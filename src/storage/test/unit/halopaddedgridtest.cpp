@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HaloPaddedGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/halopaddedgridtest.h"
+
+static HaloPaddedGridTest suite_HaloPaddedGridTest;
+
+static CxxTest::List Tests_HaloPaddedGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HaloPaddedGridTest( "/root/repo/src/storage/test/unit/halopaddedgridtest.h", 56, "HaloPaddedGridTest", suite_HaloPaddedGridTest, Tests_HaloPaddedGridTest );
+
+static class TestDescription_suite_HaloPaddedGridTest_testSetGet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testSetGet() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 59, "testSetGet" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testSetGet(); }
+} testDescription_suite_HaloPaddedGridTest_testSetGet;
+
+static class TestDescription_suite_HaloPaddedGridTest_testRefreshHaloTorus3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testRefreshHaloTorus3D() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 86, "testRefreshHaloTorus3D" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testRefreshHaloTorus3D(); }
+} testDescription_suite_HaloPaddedGridTest_testRefreshHaloTorus3D;
+
+static class TestDescription_suite_HaloPaddedGridTest_testRefreshHaloMixedTopology : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testRefreshHaloMixedTopology() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 101, "testRefreshHaloMixedTopology" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testRefreshHaloMixedTopology(); }
+} testDescription_suite_HaloPaddedGridTest_testRefreshHaloMixedTopology;
+
+static class TestDescription_suite_HaloPaddedGridTest_testThinGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testThinGrid() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 127, "testThinGrid" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testThinGrid(); }
+} testDescription_suite_HaloPaddedGridTest_testThinGrid;
+
+static class TestDescription_suite_HaloPaddedGridTest_testUpdateMatchesWrappingGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testUpdateMatchesWrappingGrid() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 144, "testUpdateMatchesWrappingGrid" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testUpdateMatchesWrappingGrid(); }
+} testDescription_suite_HaloPaddedGridTest_testUpdateMatchesWrappingGrid;
+
+static class TestDescription_suite_HaloPaddedGridTest_testMonolithicGridTypeSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HaloPaddedGridTest_testMonolithicGridTypeSelector() : CxxTest::RealTestDescription( Tests_HaloPaddedGridTest, suiteDescription_HaloPaddedGridTest, 177, "testMonolithicGridTypeSelector" ) {}
+ void runTest() { suite_HaloPaddedGridTest.testMonolithicGridTypeSelector(); }
+} testDescription_suite_HaloPaddedGridTest_testMonolithicGridTypeSelector;
+
@@ -0,0 +1,219 @@
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/storage/grid.h>
+#include <libgeodecomp/storage/gridtypeselector.h>
+#include <libgeodecomp/storage/halopaddedgrid.h>
+#include <libgeodecomp/storage/vanillaupdatefunctor.h>
+
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Sums up its Moore neighborhood on a 2D torus, which makes it
+ * sensitive to any wrap-around errors.
+ */
+class HaloPaddedGridTestCell
+{
+public:
+    class API :
+        public APITraits::HasTorusTopology<2>,
+        public APITraits::HasStencil<Stencils::Moore<2, 1> >
+    {};
+
+    explicit HaloPaddedGridTestCell(int value = 0) :
+        value(value)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, unsigned /* nanoStep */)
+    {
+        value = 0;
+        for (int y = -1; y <= 1; ++y) {
+            for (int x = -1; x <= 1; ++x) {
+                value += (3 * y + x + 5) * hood[Coord<2>(x, y)].value;
+            }
+        }
+        value %= 1000003;
+    }
+
+    bool operator==(const HaloPaddedGridTestCell& other) const
+    {
+        return value == other.value;
+    }
+
+    bool operator!=(const HaloPaddedGridTestCell& other) const
+    {
+        return !(*this == other);
+    }
+
+    int value;
+};
+
+class HaloPaddedGridTest : public CxxTest::TestSuite
+{
+public:
+    void testSetGet()
+    {
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(5, 4));
+        HaloPaddedGrid<double, Topologies::Torus<2>::Topology, 2> grid(box, 1.5, -1);
+        TS_ASSERT_EQUALS(box, grid.boundingBox());
+        TS_ASSERT_EQUALS(1.5, grid.get(Coord<2>(12, 21)));
+
+        grid.fill(CoordBox<2>(Coord<2>(11, 21), Coord<2>(2, 2)), 2.5);
+        TS_ASSERT_EQUALS(2.5, grid.get(Coord<2>(12, 22)));
+        TS_ASSERT_EQUALS(1.5, grid.get(Coord<2>(13, 22)));
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid.set(*i, i->x() * 100 + i->y());
+        }
+
+        std::vector<double> buffer(3);
+        grid.get(Streak<2>(Coord<2>(11, 22), 14), &buffer[0]);
+        TS_ASSERT_EQUALS(1122, buffer[0]);
+        TS_ASSERT_EQUALS(1222, buffer[1]);
+        TS_ASSERT_EQUALS(1322, buffer[2]);
+
+        buffer[1] = 47;
+        grid.set(Streak<2>(Coord<2>(11, 23), 14), &buffer[0]);
+        TS_ASSERT_EQUALS(47, grid[Coord<2>(12, 23)]);
+        TS_ASSERT_EQUALS(-1, grid.getEdge());
+    }
+
+    void testRefreshHaloTorus3D()
+    {
+        CoordBox<3> box(Coord<3>(-3, 4, 7), Coord<3>(5, 4, 3));
+        HaloPaddedGrid<int, Topologies::Torus<3>::Topology, 2> grid(box);
+        fill(&grid);
+        grid.refreshHalo();
+
+        CoordBox<3> frame(box.origin - Coord<3>::diagonal(2), box.dimensions + Coord<3>::diagonal(4));
+        for (CoordBox<3>::Iterator i = frame.begin(); i != frame.end(); ++i) {
+            Coord<3> wrapped = box.origin + Topologies::Torus<3>::Topology::normalize(
+                *i - box.origin, box.dimensions);
+            TS_ASSERT_EQUALS(grid[wrapped], grid[*i]);
+        }
+    }
+
+    void testRefreshHaloMixedTopology()
+    {
+        // periodic along the x-axis only:
+        typedef TopologiesHelpers::Topology<2, true, false, false> Topology;
+        CoordBox<2> box(Coord<2>(), Coord<2>(6, 5));
+        HaloPaddedGrid<int, Topology, 1> grid(box, 0, -1);
+        fill(&grid);
+        grid.refreshHalo();
+
+        CoordBox<2> frame(Coord<2>(-1, -1), Coord<2>(8, 7));
+        for (CoordBox<2>::Iterator i = frame.begin(); i != frame.end(); ++i) {
+            if ((i->y() < 0) || (i->y() >= 5)) {
+                TS_ASSERT_EQUALS(-1, grid[*i]);
+            } else {
+                Coord<2> wrapped((i->x() + 6) % 6, i->y());
+                TS_ASSERT_EQUALS(grid[wrapped], grid[*i]);
+            }
+        }
+
+        // a new edge cell needs to be propagated, too:
+        grid.setEdge(-2);
+        grid.refreshHalo();
+        TS_ASSERT_EQUALS(-2, grid[Coord<2>(-1, -1)]);
+        TS_ASSERT_EQUALS(-2, grid[Coord<2>(3, 5)]);
+    }
+
+    void testThinGrid()
+    {
+        // the frame is wider than the grid, so some cells need to be
+        // replicated multiple times:
+        CoordBox<2> box(Coord<2>(), Coord<2>(2, 1));
+        HaloPaddedGrid<int, Topologies::Torus<2>::Topology, 3> grid(box);
+        grid.set(Coord<2>(0, 0), 10);
+        grid.set(Coord<2>(1, 0), 11);
+        grid.refreshHalo();
+
+        for (int y = -3; y < 4; ++y) {
+            for (int x = -3; x < 5; ++x) {
+                TS_ASSERT_EQUALS(10 + ((x + 6) % 2), grid[Coord<2>(x, y)]);
+            }
+        }
+    }
+
+    void testUpdateMatchesWrappingGrid()
+    {
+        typedef Topologies::Torus<2>::Topology Topology;
+        Coord<2> dim(17, 12);
+        CoordBox<2> box(Coord<2>(), dim);
+
+        Grid<HaloPaddedGridTestCell, Topology> referenceOld(dim);
+        Grid<HaloPaddedGridTestCell, Topology> referenceNew(dim);
+        HaloPaddedGrid<HaloPaddedGridTestCell, Topology> paddedOld(box);
+        HaloPaddedGrid<HaloPaddedGridTestCell, Topology> paddedNew(box);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            HaloPaddedGridTestCell cell(i->x() * 31 + i->y() * 7);
+            referenceOld[*i] = cell;
+            paddedOld[*i] = cell;
+        }
+
+        for (int step = 0; step < 5; ++step) {
+            paddedOld.refreshHalo();
+            for (CoordBox<2>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+                Streak<2> streak = *i;
+                VanillaUpdateFunctor<HaloPaddedGridTestCell>()(streak, streak.origin, referenceOld, &referenceNew, 0);
+                VanillaUpdateFunctor<HaloPaddedGridTestCell>()(streak, streak.origin, paddedOld, &paddedNew, 0);
+            }
+            std::swap(referenceOld, referenceNew);
+            std::swap(paddedOld, paddedNew);
+        }
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(referenceOld[*i].value, paddedOld[*i].value);
+        }
+    }
+
+    void testMonolithicGridTypeSelector()
+    {
+        typedef MonolithicGridTypeSelector<
+            HaloPaddedGridTestCell,
+            Topologies::Torus<2>::Topology,
+            APITraits::FalseType>::Value PaddedType;
+        BOOST_STATIC_ASSERT((boost::is_same<
+                             PaddedType,
+                             HaloPaddedGrid<HaloPaddedGridTestCell, Topologies::Torus<2>::Topology, 1> >::value));
+
+        // no padding for constant boundaries:
+        typedef MonolithicGridTypeSelector<
+            HaloPaddedGridTestCell,
+            Topologies::Cube<2>::Topology,
+            APITraits::FalseType>::Value CubeType;
+        BOOST_STATIC_ASSERT((boost::is_same<
+                             CubeType,
+                             DisplacedGrid<HaloPaddedGridTestCell, Topologies::Cube<2>::Topology, false> >::value));
+
+        // cells without an explicit stencil might access arbitrary
+        // neighbors, so wrapping is mandatory:
+        typedef MonolithicGridTypeSelector<
+            int,
+            Topologies::Torus<2>::Topology,
+            APITraits::FalseType>::Value PlainType;
+        BOOST_STATIC_ASSERT((boost::is_same<
+                             PlainType,
+                             DisplacedGrid<int, Topologies::Torus<2>::Topology, false> >::value));
+    }
+
+private:
+    template<typename GRID>
+    void fill(GRID *grid)
+    {
+        CoordBox<GRID::DIM> box = grid->boundingBox();
+        int counter = 0;
+        for (typename CoordBox<GRID::DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid->set(*i, ++counter);
+        }
+    }
+};
+
+}
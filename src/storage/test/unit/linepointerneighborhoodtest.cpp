@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_LinePointerNeighborhoodTest_init = false;
+#include "/root/repo/src/storage/test/unit/linepointerneighborhoodtest.h"
+
+static LinePointerNeighborhoodTest suite_LinePointerNeighborhoodTest;
+
+static CxxTest::List Tests_LinePointerNeighborhoodTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LinePointerNeighborhoodTest( "/root/repo/src/storage/test/unit/linepointerneighborhoodtest.h", 13, "LinePointerNeighborhoodTest", suite_LinePointerNeighborhoodTest, Tests_LinePointerNeighborhoodTest );
+
+static class TestDescription_suite_LinePointerNeighborhoodTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerNeighborhoodTest_testBasic() : CxxTest::RealTestDescription( Tests_LinePointerNeighborhoodTest, suiteDescription_LinePointerNeighborhoodTest, 16, "testBasic" ) {}
+ void runTest() { suite_LinePointerNeighborhoodTest.testBasic(); }
+} testDescription_suite_LinePointerNeighborhoodTest_testBasic;
+
+static class TestDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyMiddle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyMiddle() : CxxTest::RealTestDescription( Tests_LinePointerNeighborhoodTest, suiteDescription_LinePointerNeighborhoodTest, 58, "test2DCubeTopologyMiddle" ) {}
+ void runTest() { suite_LinePointerNeighborhoodTest.test2DCubeTopologyMiddle(); }
+} testDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyMiddle;
+
+static class TestDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyTotal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyTotal() : CxxTest::RealTestDescription( Tests_LinePointerNeighborhoodTest, suiteDescription_LinePointerNeighborhoodTest, 134, "test2DCubeTopologyTotal" ) {}
+ void runTest() { suite_LinePointerNeighborhoodTest.test2DCubeTopologyTotal(); }
+} testDescription_suite_LinePointerNeighborhoodTest_test2DCubeTopologyTotal;
+
+static class TestDescription_suite_LinePointerNeighborhoodTest_test3DTorusTopologyTotal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerNeighborhoodTest_test3DTorusTopologyTotal() : CxxTest::RealTestDescription( Tests_LinePointerNeighborhoodTest, suiteDescription_LinePointerNeighborhoodTest, 172, "test3DTorusTopologyTotal" ) {}
+ void runTest() { suite_LinePointerNeighborhoodTest.test3DTorusTopologyTotal(); }
+} testDescription_suite_LinePointerNeighborhoodTest_test3DTorusTopologyTotal;
+
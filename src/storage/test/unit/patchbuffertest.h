@@ -105,6 +105,40 @@ public:
         TS_ASSERT_EQUALS(testGrid2, compGrid);
     }
 
+    void testRecycling()
+    {
+        PatchBufferType patchBuffer(region1);
+        for (int i = 0; i < 30; ++i) {
+            patchBuffer.pushRequest(i);
+        }
+
+        // only the first puts need to allocate buffers...
+        for (int i = 0; i < 3; ++i) {
+            patchBuffer.put(baseGrid, validRegion, dimensions.dimensions, i, 0);
+        }
+        std::size_t allocations = SerializationBuffer<int>::allocations();
+
+        // ...which get recycled after retrieval:
+        for (int i = 3; i < 30; ++i) {
+            compGrid = zeroGrid;
+            patchBuffer.get(&compGrid, validRegion, dimensions.dimensions, i - 3, 0);
+            TS_ASSERT_EQUALS(testGrid1, compGrid);
+
+            patchBuffer.put(baseGrid, validRegion, dimensions.dimensions, i, 0);
+        }
+        TS_ASSERT_EQUALS(allocations, SerializationBuffer<int>::allocations());
+        TS_ASSERT_EQUALS(std::size_t(3), patchBuffer.buffers.size());
+
+        for (int i = 27; i < 30; ++i) {
+            compGrid = zeroGrid;
+            patchBuffer.get(&compGrid, validRegion, dimensions.dimensions, i, 0);
+            TS_ASSERT_EQUALS(testGrid1, compGrid);
+        }
+        TS_ASSERT_THROWS(
+            patchBuffer.get(&compGrid, validRegion, dimensions.dimensions, 30, 0),
+            std::logic_error&);
+    }
+
 private:
     CoordBox<2> dimensions;
     GridType baseGrid;
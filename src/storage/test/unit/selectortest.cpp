@@ -0,0 +1,117 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SelectorTest_init = false;
+#include "/root/repo/src/storage/test/unit/selectortest.h"
+
+static SelectorTest suite_SelectorTest;
+
+static CxxTest::List Tests_SelectorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SelectorTest( "/root/repo/src/storage/test/unit/selectortest.h", 63, "SelectorTest", suite_SelectorTest, Tests_SelectorTest );
+
+static class TestDescription_suite_SelectorTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testBasic() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 66, "testBasic" ) {}
+ void runTest() { suite_SelectorTest.testBasic(); }
+} testDescription_suite_SelectorTest_testBasic;
+
+static class TestDescription_suite_SelectorTest_testCopyMemberOut : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testCopyMemberOut() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 97, "testCopyMemberOut" ) {}
+ void runTest() { suite_SelectorTest.testCopyMemberOut(); }
+} testDescription_suite_SelectorTest_testCopyMemberOut;
+
+static class TestDescription_suite_SelectorTest_testCopyMemberIn : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testCopyMemberIn() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 123, "testCopyMemberIn" ) {}
+ void runTest() { suite_SelectorTest.testCopyMemberIn(); }
+} testDescription_suite_SelectorTest_testCopyMemberIn;
+
+static class TestDescription_suite_SelectorTest_testLocalFilter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testLocalFilter() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 221, "testLocalFilter" ) {}
+ void runTest() { suite_SelectorTest.testLocalFilter(); }
+} testDescription_suite_SelectorTest_testLocalFilter;
+
+static class TestDescription_suite_SelectorTest_testFilterAoS1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testFilterAoS1() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 278, "testFilterAoS1" ) {}
+ void runTest() { suite_SelectorTest.testFilterAoS1(); }
+} testDescription_suite_SelectorTest_testFilterAoS1;
+
+static class TestDescription_suite_SelectorTest_testFilterAoS2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testFilterAoS2() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 317, "testFilterAoS2" ) {}
+ void runTest() { suite_SelectorTest.testFilterAoS2(); }
+} testDescription_suite_SelectorTest_testFilterAoS2;
+
+static class TestDescription_suite_SelectorTest_testFilterSoA1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testFilterSoA1() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 358, "testFilterSoA1" ) {}
+ void runTest() { suite_SelectorTest.testFilterSoA1(); }
+} testDescription_suite_SelectorTest_testFilterSoA1;
+
+static class TestDescription_suite_SelectorTest_testFilterSoA2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testFilterSoA2() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 399, "testFilterSoA2" ) {}
+ void runTest() { suite_SelectorTest.testFilterSoA2(); }
+} testDescription_suite_SelectorTest_testFilterSoA2;
+
+static class TestDescription_suite_SelectorTest_testFilterSoA3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testFilterSoA3() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 443, "testFilterSoA3" ) {}
+ void runTest() { suite_SelectorTest.testFilterSoA3(); }
+} testDescription_suite_SelectorTest_testFilterSoA3;
+
+static class TestDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter1() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 481, "testArrayMemberWithDefaultFilter1" ) {}
+ void runTest() { suite_SelectorTest.testArrayMemberWithDefaultFilter1(); }
+} testDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter1;
+
+static class TestDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter2() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 539, "testArrayMemberWithDefaultFilter2" ) {}
+ void runTest() { suite_SelectorTest.testArrayMemberWithDefaultFilter2(); }
+} testDescription_suite_SelectorTest_testArrayMemberWithDefaultFilter2;
+
+static class TestDescription_suite_SelectorTest_testSimpleArrayFilter1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testSimpleArrayFilter1() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 618, "testSimpleArrayFilter1" ) {}
+ void runTest() { suite_SelectorTest.testSimpleArrayFilter1(); }
+} testDescription_suite_SelectorTest_testSimpleArrayFilter1;
+
+static class TestDescription_suite_SelectorTest_testSimpleArrayFilter2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testSimpleArrayFilter2() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 660, "testSimpleArrayFilter2" ) {}
+ void runTest() { suite_SelectorTest.testSimpleArrayFilter2(); }
+} testDescription_suite_SelectorTest_testSimpleArrayFilter2;
+
+static class TestDescription_suite_SelectorTest_testWithTestCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testWithTestCell() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 726, "testWithTestCell" ) {}
+ void runTest() { suite_SelectorTest.testWithTestCell(); }
+} testDescription_suite_SelectorTest_testWithTestCell;
+
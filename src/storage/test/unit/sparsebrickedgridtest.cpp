@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SparseBrickedGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/sparsebrickedgridtest.h"
+
+static SparseBrickedGridTest suite_SparseBrickedGridTest;
+
+static CxxTest::List Tests_SparseBrickedGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SparseBrickedGridTest( "/root/repo/src/storage/test/unit/sparsebrickedgridtest.h", 95, "SparseBrickedGridTest", suite_SparseBrickedGridTest, Tests_SparseBrickedGridTest );
+
+static class TestDescription_suite_SparseBrickedGridTest_testSetGet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testSetGet() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 103, "testSetGet" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testSetGet(); }
+} testDescription_suite_SparseBrickedGridTest_testSetGet;
+
+static class TestDescription_suite_SparseBrickedGridTest_testMemoryScalesWithActiveVolume : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testMemoryScalesWithActiveVolume() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 151, "testMemoryScalesWithActiveVolume" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testMemoryScalesWithActiveVolume(); }
+} testDescription_suite_SparseBrickedGridTest_testMemoryScalesWithActiveVolume;
+
+static class TestDescription_suite_SparseBrickedGridTest_testNeighborhood : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testNeighborhood() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 165, "testNeighborhood" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testNeighborhood(); }
+} testDescription_suite_SparseBrickedGridTest_testNeighborhood;
+
+static class TestDescription_suite_SparseBrickedGridTest_testGrowAndRelease : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testGrowAndRelease() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 171, "testGrowAndRelease" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testGrowAndRelease(); }
+} testDescription_suite_SparseBrickedGridTest_testGrowAndRelease;
+
+static class TestDescription_suite_SparseBrickedGridTest_testUpdateMatchesGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testUpdateMatchesGrid() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 202, "testUpdateMatchesGrid" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testUpdateMatchesGrid(); }
+} testDescription_suite_SparseBrickedGridTest_testUpdateMatchesGrid;
+
+static class TestDescription_suite_SparseBrickedGridTest_testSimulators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testSimulators() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 208, "testSimulators" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testSimulators(); }
+} testDescription_suite_SparseBrickedGridTest_testSimulators;
+
+static class TestDescription_suite_SparseBrickedGridTest_testMonolithicGridTypeSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SparseBrickedGridTest_testMonolithicGridTypeSelector() : CxxTest::RealTestDescription( Tests_SparseBrickedGridTest, suiteDescription_SparseBrickedGridTest, 233, "testMonolithicGridTypeSelector" ) {}
+ void runTest() { suite_SparseBrickedGridTest.testMonolithicGridTypeSelector(); }
+} testDescription_suite_SparseBrickedGridTest_testMonolithicGridTypeSelector;
+
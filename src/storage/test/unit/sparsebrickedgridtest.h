@@ -0,0 +1,389 @@
+#include <libgeodecomp/io/simpleinitializer.h>
+#include <libgeodecomp/io/steerer.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/parallelization/openmpsimulator.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/storage/grid.h>
+#include <libgeodecomp/storage/gridtypeselector.h>
+#include <libgeodecomp/storage/sparsebrickedgrid.h>
+#include <libgeodecomp/storage/vanillaupdatefunctor.h>
+
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Cells with a zero value are inactive. Activity spreads by one
+ * cell per step, just like a wave front.
+ */
+template<typename TOPOLOGY_API, typename GRID_API>
+class SparseBrickedGridTestCell
+{
+public:
+    class API :
+        public TOPOLOGY_API,
+        public APITraits::HasStencil<Stencils::Moore<3, 1> >,
+        public GRID_API
+    {};
+
+    explicit SparseBrickedGridTestCell(int value = 0) :
+        value(value)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, unsigned /* nanoStep */)
+    {
+        value =
+            1 * hood[FixedCoord< 0,  0, -1>()].value +
+            2 * hood[FixedCoord< 0, -1,  0>()].value +
+            3 * hood[FixedCoord<-1,  0,  0>()].value +
+            4 * hood[FixedCoord< 0,  0,  0>()].value +
+            5 * hood[FixedCoord< 1,  0,  0>()].value +
+            6 * hood[FixedCoord< 0,  1,  0>()].value +
+            7 * hood[FixedCoord< 0,  0,  1>()].value +
+            8 * hood[Coord<3>(1, 1, 1)].value;
+        value %= 1009;
+    }
+
+    bool isActive() const
+    {
+        return value != 0;
+    }
+
+    int value;
+};
+
+/**
+ * API mixin for reference cells which don't ask for a special grid
+ * type.
+ */
+class SparseBrickedGridTestDense
+{};
+
+/**
+ * API mixin for cells which ask for both, sparse and dense bricks.
+ */
+class SparseBrickedGridTestBoth :
+        public APITraits::HasBrickedGrid,
+        public APITraits::HasSparseBrickedGrid
+{};
+
+template<typename CELL>
+class SparseBrickedGridTestInitializer : public SimpleInitializer<CELL>
+{
+public:
+    SparseBrickedGridTestInitializer() :
+        SimpleInitializer<CELL>(Coord<3>(37, 29, 23), 7)
+    {}
+
+    virtual void grid(GridBase<CELL, 3> *target)
+    {
+        CoordBox<3> box = target->boundingBox();
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            target->set(*i, CELL());
+        }
+
+        target->set(Coord<3>( 3,  4,  5), CELL(1));
+        target->set(Coord<3>(30, 20, 17), CELL(2));
+        target->set(Coord<3>(36,  0, 22), CELL(3));
+    }
+};
+
+/**
+ * Ignites a cell in the midst of empty space, as long as the
+ * Simulator reports that cell as part of the simulation domain.
+ */
+template<typename CELL>
+class SparseBrickedGridTestSteerer : public Steerer<CELL>
+{
+public:
+    typedef typename Steerer<CELL>::SteererFeedback SteererFeedback;
+    typedef typename Steerer<CELL>::GridType GridType;
+    typedef typename Steerer<CELL>::CoordType CoordType;
+
+    explicit SparseBrickedGridTestSteerer(const Coord<3>& target) :
+        Steerer<CELL>(1),
+        target(target)
+    {}
+
+    Steerer<CELL> *clone()
+    {
+        return new SparseBrickedGridTestSteerer(*this);
+    }
+
+    virtual void nextStep(
+        GridType *grid,
+        const Region<3>& validRegion,
+        const CoordType& /* unused: globalDimensions */,
+        unsigned step,
+        SteererEvent /* unused: event */,
+        std::size_t /* unused: rank */,
+        bool /* unused: lastCall */,
+        SteererFeedback * /* unused: feedback */)
+    {
+        if ((step == 3) && validRegion.count(target)) {
+            grid->set(target, CELL(5));
+        }
+    }
+
+private:
+    Coord<3> target;
+};
+
+class SparseBrickedGridTest : public CxxTest::TestSuite
+{
+public:
+    typedef Topologies::Cube<3>::Topology Cube;
+    typedef Topologies::Torus<3>::Topology Torus;
+    typedef SparseBrickedGridTestCell<APITraits::HasCubeTopology<3>, APITraits::HasSparseBrickedGrid> CubeCell;
+    typedef SparseBrickedGridTestCell<APITraits::HasTorusTopology<3>, APITraits::HasSparseBrickedGrid> TorusCell;
+
+    void testSetGet()
+    {
+        CoordBox<3> box(Coord<3>(-3, 2, 1), Coord<3>(19, 10, 17));
+        SparseBrickedGrid<CubeCell, Cube> grid(box, CubeCell(), CubeCell(-1));
+        TS_ASSERT_EQUALS(box, grid.boundingBox());
+        TS_ASSERT_EQUALS(std::size_t(0), grid.numAllocatedBricks());
+
+        // inactive cells don't allocate memory...
+        grid.set(Coord<3>(0, 5, 5), CubeCell(0));
+        TS_ASSERT_EQUALS(std::size_t(0), grid.numAllocatedBricks());
+        TS_ASSERT_EQUALS(0, grid.get(Coord<3>(0, 5, 5)).value);
+        TS_ASSERT_EQUALS(-1, grid.get(Coord<3>(-4, 5, 5)).value);
+
+        // ...but active ones do:
+        grid.set(Coord<3>(0, 5, 5), CubeCell(7));
+        TS_ASSERT_EQUALS(std::size_t(1), grid.numAllocatedBricks());
+        TS_ASSERT_EQUALS(7, grid.get(Coord<3>(0, 5, 5)).value);
+        TS_ASSERT_EQUALS(0, grid.get(Coord<3>(1, 5, 5)).value);
+
+        Region<3> expected;
+        expected << CoordBox<3>(Coord<3>(-3, 2, 1), Coord<3>(8, 8, 8));
+        TS_ASSERT_EQUALS(expected, grid.allocatedRegion());
+
+        // bricks at the edge are clipped to the bounding box:
+        grid.set(Coord<3>(15, 11, 17), CubeCell(8));
+        TS_ASSERT_EQUALS(std::size_t(2), grid.numAllocatedBricks());
+        expected << CoordBox<3>(Coord<3>(13, 10, 17), Coord<3>(3, 2, 1));
+        TS_ASSERT_EQUALS(expected, grid.allocatedRegion());
+
+        // const accesses don't allocate:
+        const SparseBrickedGrid<CubeCell, Cube>& constGrid = grid;
+        TS_ASSERT_EQUALS(0, constGrid[Coord<3>(10, 5, 5)].value);
+        TS_ASSERT_EQUALS(std::size_t(2), grid.numAllocatedBricks());
+
+        // streaks only allocate bricks which receive active cells:
+        std::vector<CubeCell> buffer(19);
+        buffer[17] = CubeCell(4);
+        grid.set(Streak<3>(Coord<3>(-3, 7, 12), 16), &buffer[0]);
+        TS_ASSERT_EQUALS(std::size_t(3), grid.numAllocatedBricks());
+        TS_ASSERT_EQUALS(4, grid.get(Coord<3>(14, 7, 12)).value);
+
+        buffer[17] = CubeCell();
+        grid.get(Streak<3>(Coord<3>(-3, 5, 5), 16), &buffer[0]);
+        for (int x = -3; x < 16; ++x) {
+            TS_ASSERT_EQUALS((x == 0) ? 7 : 0, buffer[x + 3].value);
+        }
+    }
+
+    void testMemoryScalesWithActiveVolume()
+    {
+        CoordBox<3> box(Coord<3>(), Coord<3>(256, 256, 256));
+        SparseBrickedGrid<CubeCell, Cube> grid(box);
+        grid.set(Coord<3>(100, 100, 100), CubeCell(1));
+        grid.set(Coord<3>(101, 100, 100), CubeCell(1));
+        grid.set(Coord<3>(200,  10,  30), CubeCell(1));
+
+        TS_ASSERT_EQUALS(std::size_t(2), grid.numAllocatedBricks());
+        // the background brick plus two allocated ones:
+        TS_ASSERT_EQUALS(std::size_t(3), grid.storage.size());
+        TS_ASSERT_EQUALS(std::size_t(2 * 512), grid.allocatedRegion().size());
+    }
+
+    void testNeighborhood()
+    {
+        checkNeighborhood<Cube>();
+        checkNeighborhood<Torus>();
+    }
+
+    void testGrowAndRelease()
+    {
+        CoordBox<3> box(Coord<3>(), Coord<3>(32, 32, 32));
+        SparseBrickedGrid<CubeCell, Cube> grid(box);
+        grid.set(Coord<3>(12, 12, 12), CubeCell(1));
+        TS_ASSERT_EQUALS(std::size_t(1), grid.numAllocatedBricks());
+
+        // no active cell is next to unallocated bricks:
+        TS_ASSERT(!grid.growAroundActiveCells(1));
+        TS_ASSERT_EQUALS(std::size_t(1), grid.numAllocatedBricks());
+
+        grid.set(Coord<3>(15, 12, 12), CubeCell(1));
+        TS_ASSERT(grid.growAroundActiveCells(1));
+        TS_ASSERT_EQUALS(std::size_t(2), grid.numAllocatedBricks());
+        grid.set(Coord<3>(15, 15, 15), CubeCell(1));
+        TS_ASSERT(grid.growAroundActiveCells(1));
+        TS_ASSERT_EQUALS(std::size_t(8), grid.numAllocatedBricks());
+
+        grid.set(Coord<3>(12, 12, 12), CubeCell(0));
+        grid.set(Coord<3>(15, 15, 15), CubeCell(0));
+        TS_ASSERT_EQUALS(std::size_t(7), grid.releaseInactiveBricks());
+        TS_ASSERT_EQUALS(std::size_t(1), grid.numAllocatedBricks());
+        TS_ASSERT_EQUALS(1, grid.get(Coord<3>(15, 12, 12)).value);
+
+        // released slots are recycled:
+        grid.set(Coord<3>(30, 30, 30), CubeCell(5));
+        TS_ASSERT_EQUALS(std::size_t(9), grid.storage.size());
+        TS_ASSERT_EQUALS(5, grid.get(Coord<3>(30, 30, 30)).value);
+        TS_ASSERT_EQUALS(0, grid.get(Coord<3>(31, 30, 30)).value);
+    }
+
+    void testUpdateMatchesGrid()
+    {
+        checkUpdate<APITraits::HasCubeTopology<3> >();
+        checkUpdate<APITraits::HasTorusTopology<3> >();
+    }
+
+    void testSimulators()
+    {
+        typedef SparseBrickedGridTestCell<APITraits::HasCubeTopology<3>, SparseBrickedGridTestDense> DenseCell;
+
+        SerialSimulator<DenseCell> reference(new SparseBrickedGridTestInitializer<DenseCell>());
+        SerialSimulator<CubeCell> serial(new SparseBrickedGridTestInitializer<CubeCell>());
+        OpenMPSimulator<CubeCell> openMP(new SparseBrickedGridTestInitializer<CubeCell>());
+        openMP.setPersistentThreadTeam(true);
+
+        reference.run();
+        serial.run();
+        openMP.run();
+
+        CoordBox<3> box = reference.getGrid()->boundingBox();
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, serial.getGrid()->get(*i).value);
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, openMP.getGrid()->get(*i).value);
+        }
+
+        const SerialSimulator<CubeCell>::GridType *grid =
+            dynamic_cast<const SerialSimulator<CubeCell>::GridType*>(serial.getGrid());
+        TS_ASSERT(grid != 0);
+        TS_ASSERT_LESS_THAN(grid->allocatedRegion().size(), box.size());
+    }
+
+    void testSteerersSeeWholeDomain()
+    {
+        typedef SparseBrickedGridTestCell<APITraits::HasCubeTopology<3>, SparseBrickedGridTestDense> DenseCell;
+        // far away from all cells which are active at step 3:
+        Coord<3> target(20, 15, 2);
+
+        SerialSimulator<DenseCell> reference(new SparseBrickedGridTestInitializer<DenseCell>());
+        SerialSimulator<CubeCell> serial(new SparseBrickedGridTestInitializer<CubeCell>());
+        OpenMPSimulator<CubeCell> openMP(new SparseBrickedGridTestInitializer<CubeCell>());
+        reference.addSteerer(new SparseBrickedGridTestSteerer<DenseCell>(target));
+        serial.addSteerer(new SparseBrickedGridTestSteerer<CubeCell>(target));
+        openMP.addSteerer(new SparseBrickedGridTestSteerer<CubeCell>(target));
+
+        reference.run();
+        serial.run();
+        openMP.run();
+
+        TS_ASSERT_DIFFERS(0, reference.getGrid()->get(target).value);
+        CoordBox<3> box = reference.getGrid()->boundingBox();
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, serial.getGrid()->get(*i).value);
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, openMP.getGrid()->get(*i).value);
+        }
+    }
+
+    void testMonolithicGridTypeSelector()
+    {
+        typedef MonolithicGridTypeSelector<TorusCell, Torus, APITraits::FalseType>::Value SparseType;
+        BOOST_STATIC_ASSERT((boost::is_same<SparseType, SparseBrickedGrid<TorusCell, Torus> >::value));
+
+        // takes precedence over the dense bricked grid:
+        typedef SparseBrickedGridTestCell<
+            APITraits::HasCubeTopology<3>,
+            SparseBrickedGridTestBoth> BothCell;
+        typedef MonolithicGridTypeSelector<BothCell, Cube, APITraits::FalseType>::Value BothType;
+        BOOST_STATIC_ASSERT((boost::is_same<BothType, SparseBrickedGrid<BothCell, Cube> >::value));
+    }
+
+private:
+    template<typename TOPOLOGY>
+    void checkNeighborhood()
+    {
+        typedef SparseBrickedGrid<CubeCell, TOPOLOGY> GridType;
+        CoordBox<3> box(Coord<3>(-1, -2, -3), Coord<3>(19, 13, 10));
+        GridType grid(box, CubeCell(), CubeCell(-1));
+
+        // allocate every other brick:
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            Coord<3> relativeCoord = *i - box.origin;
+            if (((relativeCoord.x() / 8 + relativeCoord.y() / 8) % 2) == 0) {
+                grid[*i] = CubeCell(i->x() * 10000 + i->y() * 100 + i->z());
+            }
+        }
+
+        const GridType& constGrid = grid;
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            typename GridType::NeighborhoodType hood = grid.getNeighborhood(*i);
+
+            for (int z = -1; z <= 1; ++z) {
+                for (int y = -1; y <= 1; ++y) {
+                    for (int x = -1; x <= 1; ++x) {
+                        Coord<3> offset(x, y, z);
+                        TS_ASSERT_EQUALS(constGrid[*i + offset].value, hood[offset].value);
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename TOPOLOGY_API>
+    void checkUpdate()
+    {
+        typedef SparseBrickedGridTestCell<TOPOLOGY_API, APITraits::HasSparseBrickedGrid> CellType;
+        typedef typename APITraits::SelectTopology<CellType>::Value Topology;
+        typedef SparseBrickedGrid<CellType, Topology> SparseGridType;
+
+        Coord<3> dim(37, 29, 23);
+        CoordBox<3> box(Coord<3>(), dim);
+
+        Grid<CellType, Topology> referenceOld(dim, CellType(), CellType(0));
+        Grid<CellType, Topology> referenceNew(dim, CellType(), CellType(0));
+        SparseGridType sparseOld(box, CellType(), CellType(0));
+        SparseGridType sparseNew(box, CellType(), CellType(0));
+
+        Coord<3> seeds[] = { Coord<3>(3, 4, 5), Coord<3>(30, 20, 17), Coord<3>(36, 0, 22) };
+        for (int i = 0; i < 3; ++i) {
+            referenceOld[seeds[i]] = CellType(i + 1);
+            sparseOld.set(seeds[i], CellType(i + 1));
+        }
+
+        Region<3> updateRegion;
+        for (int step = 0; step < 6; ++step) {
+            SparseBrickedGridHelpers::SyncBricks<SparseGridType>()(&sparseOld, &sparseNew, &updateRegion, 1);
+
+            for (CoordBox<3>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+                Streak<3> streak = *i;
+                VanillaUpdateFunctor<CellType>()(streak, streak.origin, referenceOld, &referenceNew, 0);
+            }
+            for (Region<3>::StreakIterator i = updateRegion.beginStreak(); i != updateRegion.endStreak(); ++i) {
+                Streak<3> streak = *i;
+                VanillaUpdateFunctor<CellType>()(streak, streak.origin, sparseOld, &sparseNew, 0);
+            }
+
+            std::swap(referenceOld, referenceNew);
+            std::swap(sparseOld, sparseNew);
+        }
+
+        TS_ASSERT_LESS_THAN(updateRegion.size(), box.size());
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(referenceOld[*i].value, sparseOld.get(*i).value);
+        }
+    }
+};
+
+}
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UntructuredNeighborhoodTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredneighborhoodtest.h"
+
+static UntructuredNeighborhoodTest suite_UntructuredNeighborhoodTest;
+
+static CxxTest::List Tests_UntructuredNeighborhoodTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UntructuredNeighborhoodTest( "/root/repo/src/storage/test/unit/unstructuredneighborhoodtest.h", 31, "UntructuredNeighborhoodTest", suite_UntructuredNeighborhoodTest, Tests_UntructuredNeighborhoodTest );
+
+static class TestDescription_suite_UntructuredNeighborhoodTest_testSquareBracketsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UntructuredNeighborhoodTest_testSquareBracketsOperator() : CxxTest::RealTestDescription( Tests_UntructuredNeighborhoodTest, suiteDescription_UntructuredNeighborhoodTest, 34, "testSquareBracketsOperator" ) {}
+ void runTest() { suite_UntructuredNeighborhoodTest.testSquareBracketsOperator(); }
+} testDescription_suite_UntructuredNeighborhoodTest_testSquareBracketsOperator;
+
+static class TestDescription_suite_UntructuredNeighborhoodTest_testNeighborhoodSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UntructuredNeighborhoodTest_testNeighborhoodSimple() : CxxTest::RealTestDescription( Tests_UntructuredNeighborhoodTest, suiteDescription_UntructuredNeighborhoodTest, 56, "testNeighborhoodSimple" ) {}
+ void runTest() { suite_UntructuredNeighborhoodTest.testNeighborhoodSimple(); }
+} testDescription_suite_UntructuredNeighborhoodTest_testNeighborhoodSimple;
+
+static class TestDescription_suite_UntructuredNeighborhoodTest_testNeighborhood : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UntructuredNeighborhoodTest_testNeighborhood() : CxxTest::RealTestDescription( Tests_UntructuredNeighborhoodTest, suiteDescription_UntructuredNeighborhoodTest, 113, "testNeighborhood" ) {}
+ void runTest() { suite_UntructuredNeighborhoodTest.testNeighborhood(); }
+} testDescription_suite_UntructuredNeighborhoodTest_testNeighborhood;
+
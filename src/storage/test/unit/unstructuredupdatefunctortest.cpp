@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredUpdateFuncturTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h"
+
+static UnstructuredUpdateFuncturTest suite_UnstructuredUpdateFuncturTest;
+
+static CxxTest::List Tests_UnstructuredUpdateFuncturTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredUpdateFuncturTest( "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h", 142, "UnstructuredUpdateFuncturTest", suite_UnstructuredUpdateFuncturTest, Tests_UnstructuredUpdateFuncturTest );
+
+static class TestDescription_suite_UnstructuredUpdateFuncturTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFuncturTest_testBasic() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFuncturTest, suiteDescription_UnstructuredUpdateFuncturTest, 145, "testBasic" ) {}
+ void runTest() { suite_UnstructuredUpdateFuncturTest.testBasic(); }
+} testDescription_suite_UnstructuredUpdateFuncturTest_testBasic;
+
+static class TestDescription_suite_UnstructuredUpdateFuncturTest_testBasicWithSIGMA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFuncturTest_testBasicWithSIGMA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFuncturTest, suiteDescription_UnstructuredUpdateFuncturTest, 189, "testBasicWithSIGMA" ) {}
+ void runTest() { suite_UnstructuredUpdateFuncturTest.testBasicWithSIGMA(); }
+} testDescription_suite_UnstructuredUpdateFuncturTest_testBasicWithSIGMA;
+
+static class TestDescription_suite_UnstructuredUpdateFuncturTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFuncturTest_testSoA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFuncturTest, suiteDescription_UnstructuredUpdateFuncturTest, 239, "testSoA" ) {}
+ void runTest() { suite_UnstructuredUpdateFuncturTest.testSoA(); }
+} testDescription_suite_UnstructuredUpdateFuncturTest_testSoA;
+
+static class TestDescription_suite_UnstructuredUpdateFuncturTest_testSoAWithSIGMA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFuncturTest_testSoAWithSIGMA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFuncturTest, suiteDescription_UnstructuredUpdateFuncturTest, 291, "testSoAWithSIGMA" ) {}
+ void runTest() { suite_UnstructuredUpdateFuncturTest.testSoAWithSIGMA(); }
+} testDescription_suite_UnstructuredUpdateFuncturTest_testSoAWithSIGMA;
+
@@ -0,0 +1,66 @@
+#ifndef LIBGEODECOMP_STORAGE_TILEDUPDATEFUNCTOR_H
+#define LIBGEODECOMP_STORAGE_TILEDUPDATEFUNCTOR_H
+
+#include <libgeodecomp/geometry/regiontiler.h>
+#include <libgeodecomp/storage/updatefunctor.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Variant of the UpdateFunctor which processes a Region that has
+ * been chopped into tiles by RegionTiler. If the CONCURRENCY_FUNCTOR
+ * requests OpenMP, each tile is updated by a single thread (tiles
+ * are distributed among threads), otherwise tiles are updated one
+ * after another. Either way the working set of each update is
+ * limited to a tile, which is what makes spatial cache blocking
+ * effective.
+ */
+template<typename CELL, typename CONCURRENCY_FUNCTOR = UpdateFunctorHelpers::ConcurrencyNoP>
+class TiledUpdateFunctor
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    typedef typename APITraits::SelectThreadedUpdate<CELL>::Value ThreadedUpdate;
+
+    static const int DIM = Topology::DIM;
+
+    template<typename GRID1, typename GRID2>
+    void operator()(
+        const std::vector<Region<DIM> >& tiles,
+        const Coord<DIM>& sourceOffset,
+        const Coord<DIM>& targetOffset,
+        const GRID1& gridOld,
+        GRID2 *gridNew,
+        unsigned nanoStep,
+        const CONCURRENCY_FUNCTOR& concurrencySpec = UpdateFunctorHelpers::ConcurrencyNoP())
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        ThreadedUpdate modelThreadingSpec;
+        if (concurrencySpec.enableOpenMP() && !modelThreadingSpec.hasOpenMP()) {
+            long numTiles = tiles.size();
+            if (concurrencySpec.preferStaticScheduling()) {
+#pragma omp parallel for schedule(static)
+                for (long i = 0; i < numTiles; ++i) {
+                    UpdateFunctor<CELL>()(tiles[i], sourceOffset, targetOffset, gridOld, gridNew, nanoStep);
+                }
+            } else {
+#pragma omp parallel for schedule(dynamic)
+                for (long i = 0; i < numTiles; ++i) {
+                    UpdateFunctor<CELL>()(tiles[i], sourceOffset, targetOffset, gridOld, gridNew, nanoStep);
+                }
+            }
+
+            return;
+        }
+#endif
+
+        for (std::size_t i = 0; i < tiles.size(); ++i) {
+            UpdateFunctor<CELL, CONCURRENCY_FUNCTOR>()(
+                tiles[i], sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec);
+        }
+    }
+};
+
+}
+
+#endif
@@ -4,12 +4,14 @@
 #include <libgeodecomp/communication/patchlink.h>
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 #include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
 #include <libgeodecomp/geometry/partitionmanager.h>
 #include <libgeodecomp/io/collectingwriter.h>
 #include <libgeodecomp/io/memorywriter.h>
 #include <libgeodecomp/misc/chronometer.h>
 #include <libgeodecomp/parallelization/nesting/stepper.h>
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
 #include <libgeodecomp/testbed/performancetests/cpubenchmark.h>
 #include <libgeodecomp/testbed/parallelperformancetests/mysimplecell.h>
 #include <libflatarray/testbed/cpu_benchmark.hpp>
@@ -250,6 +252,104 @@ private:
     std::string partitionName;
 };
 
+template<typename CELL_TYPE>
+class ConstantInitializer : public SimpleInitializer<CELL_TYPE>
+{
+public:
+    ConstantInitializer(const Coord<3>& dimensions, unsigned steps) :
+        SimpleInitializer<CELL_TYPE>(dimensions, steps)
+    {}
+
+    virtual void grid(GridBase<CELL_TYPE, 3> *target)
+    {
+        CoordBox<3> box = target->boundingBox();
+        std::vector<CELL_TYPE> buffer(box.dimensions.x(), CELL_TYPE(1.0));
+        for (CoordBox<3>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            target->set(*i, &buffer[0]);
+        }
+    }
+};
+
+/**
+ * Measures the node-local throughput of the VanillaStepper. Each rank
+ * owns a slab of the given dimensions and is followed by another
+ * slab, so even a single rank needs to update its ghost zone.
+ * Ghost zones aren't actually exchanged, so this benchmark captures
+ * the cost of updating and buffering the rim, but not the network.
+ */
+template<typename CELL_TYPE>
+class VanillaStepperPerfTest : public CPUBenchmark
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    typedef VanillaStepper<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+
+    VanillaStepperPerfTest(const std::string& modelName, unsigned ghostZoneWidth) :
+        modelName(modelName),
+        ghostZoneWidth(ghostZoneWidth)
+    {}
+
+    std::string family()
+    {
+        std::stringstream buf;
+        buf << "VanillaStepper<" << modelName << ", " << ghostZoneWidth << ">";
+        return buf.str();
+    }
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        MPILayer mpiLayer;
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int numSlabs = mpiLayer.size() + 1;
+        Coord<3> gridDim(dim.x(), dim.y(), dim.z() * numSlabs);
+        CoordBox<3> box(Coord<3>(), gridDim);
+
+        std::vector<std::size_t> weights(numSlabs, dim.prod());
+        boost::shared_ptr<Partition<3> > partition(
+            new StripingPartition<3>(Coord<3>(), gridDim, 0, weights));
+        boost::shared_ptr<PartitionManager<Topology> > partitionManager(
+            new PartitionManager<Topology>());
+        partitionManager->resetRegions(box, partition, mpiLayer.rank(), ghostZoneWidth);
+
+        std::vector<CoordBox<3> > boundingBoxes;
+        for (int i = 0; i < numSlabs; ++i) {
+            boundingBoxes << partitionManager->getRegion(i, 0).boundingBox();
+        }
+        partitionManager->resetGhostZones(boundingBoxes);
+
+        boost::shared_ptr<Initializer<CELL_TYPE> > init(
+            new ConstantInitializer<CELL_TYPE>(gridDim, repeats()));
+        StepperType stepper(partitionManager, init);
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+            stepper.update(repeats());
+        }
+
+        return 1e-9 * dim.prod() * repeats() / seconds;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+
+private:
+    std::string modelName;
+    unsigned ghostZoneWidth;
+
+    int repeats()
+    {
+        return 20;
+    }
+};
+
 int main(int argc, char **argv)
 {
     MPI_Init(&argc, &argv);
@@ -288,6 +388,8 @@ int main(int argc, char **argv)
     eval(CollectingWriterPerfTest<TestCell<3> >("TestCell<3> "),                               toVector(Coord<3>::diagonal(64)),  output);
     eval(PatchLinkPerfTest<MySimpleCell>("MySimpleCell"),                                      toVector(Coord<3>::diagonal(200)), output);
     eval(PatchLinkPerfTest<TestCell<3> >("TestCell<3> "),                                      toVector(Coord<3>::diagonal(64)),  output);
+    eval(VanillaStepperPerfTest<MySimpleCell>("MySimpleCell", 1),                              toVector(Coord<3>(256, 256, 32)),  output);
+    eval(VanillaStepperPerfTest<MySimpleCell>("MySimpleCell", 2),                              toVector(Coord<3>(256, 256, 32)),  output);
     eval(PartitionManagerBig3DPerfTest<RecursiveBisectionPartition<3> >("RecursiveBisection"), toVector(Coord<3>::diagonal(100)), output);
     eval(PartitionManagerBig3DPerfTest<ZCurvePartition<3> >("ZCurve"),                         toVector(Coord<3>::diagonal(100)), output);
 
@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_TESTBED_PARALLELPERFORMANCETESTS_MYSIMPLECELL_H
 #define LIBGEODECOMP_TESTBED_PARALLELPERFORMANCETESTS_MYSIMPLECELL_H
 
+#include <libgeodecomp/geometry/coord.h>
 #include <libgeodecomp/misc/apitraits.h>
 
 namespace LibGeoDecomp {
@@ -14,6 +15,22 @@ public:
         public APITraits::HasPredefinedMPIDataType<double>
     {};
 
+    explicit MySimpleCell(double temp = 0) :
+        temp(temp)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, const unsigned& /* unused: nanoStep */)
+    {
+        temp = (hood[Coord<3>( 0,  0, -1)].temp +
+                hood[Coord<3>( 0, -1,  0)].temp +
+                hood[Coord<3>(-1,  0,  0)].temp +
+                hood[Coord<3>( 0,  0,  0)].temp +
+                hood[Coord<3>( 1,  0,  0)].temp +
+                hood[Coord<3>( 0,  1,  0)].temp +
+                hood[Coord<3>( 0,  0,  1)].temp) * (1.0 / 7.0);
+    }
+
     double temp;
 };
 
@@ -0,0 +1,442 @@
+/**
+ * Computes quality metrics for all available partitions, given a
+ * domain, rank count (or explicit weights), and ghost zone widths:
+ *
+ *   - imbalance: maximum relative deviation of any rank's region
+ *     size from its share as specified by the weights,
+ *   - total/max halo: number of cells which need to be received
+ *     during each ghost zone synchronization (summed up over all
+ *     ranks/the maximum of all ranks), as computed by
+ *     PartitionManager's ghost zone fragments,
+ *   - avg/max neighbors: number of ranks each rank needs to
+ *     communicate with,
+ *   - construction time: seconds required to set up the partition
+ *     and retrieve all regions.
+ *
+ * The table is written to stdout as CSV or JSON. This is meant to
+ * help with picking a partition for a given machine size without
+ * running the actual simulation.
+ */
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/partitionmanager.h>
+#include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/hierarchicalpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+#include <libgeodecomp/geometry/partitions/hindexingpartition.h>
+#include <libgeodecomp/geometry/partitions/ptscotchpartition.h>
+#include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+#include <libgeodecomp/misc/stringops.h>
+
+#include <boost/shared_ptr.hpp>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+using namespace LibGeoDecomp;
+
+/**
+ * One line of the report.
+ */
+class PartitionQuality
+{
+public:
+    std::string partition;
+    std::size_t ranks;
+    unsigned ghostZoneWidth;
+    double imbalance;
+    std::size_t totalHalo;
+    std::size_t maxHalo;
+    double avgNeighbors;
+    std::size_t maxNeighbors;
+    double constructionTime;
+};
+
+template<typename TOPOLOGY>
+class PartitionEvaluator
+{
+public:
+    static const int DIM = TOPOLOGY::DIM;
+
+    PartitionEvaluator(
+        const Coord<DIM>& dimensions,
+        const std::vector<std::size_t>& weights,
+        const std::vector<std::size_t>& nodeIDs,
+        unsigned maxGhostZoneWidth) :
+        box(Coord<DIM>(), dimensions),
+        weights(weights),
+        nodeIDs(nodeIDs),
+        maxGhostZoneWidth(maxGhostZoneWidth)
+    {}
+
+    template<typename PARTITION>
+    void evaluate(const std::string& name, std::vector<PartitionQuality> *report)
+    {
+        double constructionTime = 0;
+        boost::shared_ptr<Partition<DIM> > partition;
+        std::vector<Region<DIM> > regions;
+
+        {
+            ScopedTimer t(&constructionTime);
+            partition.reset(new PARTITION(box.origin, box.dimensions, 0, weights));
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                regions << partition->getRegion(i);
+            }
+        }
+
+        addRows(name, partition, regions, constructionTime, report);
+    }
+
+    template<typename OUTER_PARTITION, typename INNER_PARTITION>
+    void evaluateHierarchical(const std::string& name, std::vector<PartitionQuality> *report)
+    {
+        if (nodeIDs.empty()) {
+            return;
+        }
+
+        double constructionTime = 0;
+        boost::shared_ptr<Partition<DIM> > partition;
+        std::vector<Region<DIM> > regions;
+
+        {
+            ScopedTimer t(&constructionTime);
+            partition.reset(new HierarchicalPartition<DIM, OUTER_PARTITION, INNER_PARTITION>(
+                                box.origin, box.dimensions, 0, weights, nodeIDs));
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                regions << partition->getRegion(i);
+            }
+        }
+
+        addRows(name, partition, regions, constructionTime, report);
+    }
+
+private:
+    CoordBox<DIM> box;
+    std::vector<std::size_t> weights;
+    std::vector<std::size_t> nodeIDs;
+    unsigned maxGhostZoneWidth;
+
+    void addRows(
+        const std::string& name,
+        boost::shared_ptr<Partition<DIM> > partition,
+        const std::vector<Region<DIM> >& regions,
+        double constructionTime,
+        std::vector<PartitionQuality> *report)
+    {
+        std::vector<CoordBox<DIM> > boundingBoxes;
+        for (std::size_t i = 0; i < regions.size(); ++i) {
+            boundingBoxes << regions[i].boundingBox();
+        }
+        double imbalance = computeImbalance(regions);
+
+        for (unsigned ghostZoneWidth = 1; ghostZoneWidth <= maxGhostZoneWidth; ++ghostZoneWidth) {
+            PartitionQuality row;
+            row.partition = name;
+            row.ranks = weights.size();
+            row.ghostZoneWidth = ghostZoneWidth;
+            row.imbalance = imbalance;
+            row.totalHalo = 0;
+            row.maxHalo = 0;
+            row.avgNeighbors = 0;
+            row.maxNeighbors = 0;
+            row.constructionTime = constructionTime;
+
+            for (std::size_t rank = 0; rank < weights.size(); ++rank) {
+                PartitionManager<TOPOLOGY> manager;
+                manager.resetRegions(box, partition, rank, ghostZoneWidth);
+                manager.resetGhostZones(boundingBoxes);
+
+                typedef typename PartitionManager<TOPOLOGY>::RegionVecMap RegionVecMap;
+                const RegionVecMap& fragments = manager.getOuterGhostZoneFragments();
+
+                std::size_t halo = 0;
+                std::size_t neighbors = 0;
+                for (typename RegionVecMap::const_iterator i = fragments.begin(); i != fragments.end(); ++i) {
+                    if (i->first == PartitionManager<TOPOLOGY>::OUTGROUP) {
+                        continue;
+                    }
+                    halo += i->second.back().size();
+                    ++neighbors;
+                }
+
+                row.totalHalo += halo;
+                row.maxHalo = (std::max)(row.maxHalo, halo);
+                row.avgNeighbors += neighbors;
+                row.maxNeighbors = (std::max)(row.maxNeighbors, neighbors);
+            }
+
+            row.avgNeighbors /= weights.size();
+            report->push_back(row);
+        }
+    }
+
+    double computeImbalance(const std::vector<Region<DIM> >& regions) const
+    {
+        double totalWeight = sum(weights);
+        double ret = 0;
+
+        for (std::size_t i = 0; i < regions.size(); ++i) {
+            if (weights[i] == 0) {
+                continue;
+            }
+
+            double expectedSize = box.dimensions.prod() * weights[i] / totalWeight;
+            ret = (std::max)(ret, regions[i].size() / expectedSize - 1.0);
+        }
+
+        return ret;
+    }
+};
+
+template<typename TOPOLOGY>
+void evaluate2D(PartitionEvaluator<TOPOLOGY> *evaluator, std::vector<PartitionQuality> *report)
+{
+    evaluator->template evaluate<StripingPartition<2> >(         "StripingPartition",          report);
+    evaluator->template evaluate<CheckerboardingPartition<2> >(  "CheckerboardingPartition",   report);
+    evaluator->template evaluate<RecursiveBisectionPartition<2> >("RecursiveBisectionPartition", report);
+    evaluator->template evaluate<ZCurvePartition<2> >(           "ZCurvePartition",            report);
+    evaluator->template evaluate<HIndexingPartition>(            "HIndexingPartition",         report);
+    evaluator->template evaluate<HilbertPartition>(              "HilbertPartition",           report);
+#ifdef LIBGEODECOMP_WITH_SCOTCH
+#ifdef LIBGEODECOMP_WITH_MPI
+    evaluator->template evaluate<PTScotchPartition<2> >(         "PTScotchPartition",          report);
+#endif
+#endif
+    evaluator->template evaluateHierarchical<RecursiveBisectionPartition<2>, RecursiveBisectionPartition<2> >(
+        "HierarchicalPartition<RecursiveBisection>", report);
+    evaluator->template evaluateHierarchical<HilbertPartition, HilbertPartition>(
+        "HierarchicalPartition<Hilbert>", report);
+}
+
+template<typename TOPOLOGY>
+void evaluate3D(PartitionEvaluator<TOPOLOGY> *evaluator, std::vector<PartitionQuality> *report)
+{
+    evaluator->template evaluate<StripingPartition<3> >(         "StripingPartition",          report);
+    evaluator->template evaluate<CheckerboardingPartition<3> >(  "CheckerboardingPartition",   report);
+    evaluator->template evaluate<RecursiveBisectionPartition<3> >("RecursiveBisectionPartition", report);
+    evaluator->template evaluate<ZCurvePartition<3> >(           "ZCurvePartition",            report);
+    evaluator->template evaluate<HilbertPartition3D>(            "HilbertPartition3D",         report);
+#ifdef LIBGEODECOMP_WITH_SCOTCH
+#ifdef LIBGEODECOMP_WITH_MPI
+    evaluator->template evaluate<PTScotchPartition<3> >(         "PTScotchPartition",          report);
+#endif
+#endif
+    evaluator->template evaluateHierarchical<RecursiveBisectionPartition<3>, RecursiveBisectionPartition<3> >(
+        "HierarchicalPartition<RecursiveBisection>", report);
+    evaluator->template evaluateHierarchical<HilbertPartition3D, HilbertPartition3D>(
+        "HierarchicalPartition<Hilbert3D>", report);
+}
+
+void printCSV(const std::vector<PartitionQuality>& report)
+{
+    std::cout << "partition,ranks,ghost_zone_width,imbalance,total_halo,max_halo,"
+              << "avg_neighbors,max_neighbors,construction_time\n";
+    for (std::size_t i = 0; i < report.size(); ++i) {
+        const PartitionQuality& row = report[i];
+        std::cout << "\"" << row.partition << "\","
+                  << row.ranks << ","
+                  << row.ghostZoneWidth << ","
+                  << row.imbalance << ","
+                  << row.totalHalo << ","
+                  << row.maxHalo << ","
+                  << row.avgNeighbors << ","
+                  << row.maxNeighbors << ","
+                  << row.constructionTime << "\n";
+    }
+}
+
+void printJSON(const std::vector<PartitionQuality>& report)
+{
+    std::cout << "[\n";
+    for (std::size_t i = 0; i < report.size(); ++i) {
+        const PartitionQuality& row = report[i];
+        std::cout << "  {\"partition\": \"" << row.partition << "\", "
+                  << "\"ranks\": " << row.ranks << ", "
+                  << "\"ghost_zone_width\": " << row.ghostZoneWidth << ", "
+                  << "\"imbalance\": " << row.imbalance << ", "
+                  << "\"total_halo\": " << row.totalHalo << ", "
+                  << "\"max_halo\": " << row.maxHalo << ", "
+                  << "\"avg_neighbors\": " << row.avgNeighbors << ", "
+                  << "\"max_neighbors\": " << row.maxNeighbors << ", "
+                  << "\"construction_time\": " << row.constructionTime << "}"
+                  << ((i + 1) < report.size() ? "," : "") << "\n";
+    }
+    std::cout << "]\n";
+}
+
+template<int DIM>
+std::vector<PartitionQuality> evaluateAll(
+    const std::vector<int>& rawDimensions,
+    const std::vector<std::size_t>& weights,
+    const std::vector<std::size_t>& nodeIDs,
+    unsigned maxGhostZoneWidth,
+    bool torus);
+
+template<>
+std::vector<PartitionQuality> evaluateAll<2>(
+    const std::vector<int>& rawDimensions,
+    const std::vector<std::size_t>& weights,
+    const std::vector<std::size_t>& nodeIDs,
+    unsigned maxGhostZoneWidth,
+    bool torus)
+{
+    std::vector<PartitionQuality> report;
+    Coord<2> dimensions(rawDimensions[0], rawDimensions[1]);
+
+    if (torus) {
+        PartitionEvaluator<Topologies::Torus<2>::Topology> evaluator(dimensions, weights, nodeIDs, maxGhostZoneWidth);
+        evaluate2D(&evaluator, &report);
+    } else {
+        PartitionEvaluator<Topologies::Cube<2>::Topology> evaluator(dimensions, weights, nodeIDs, maxGhostZoneWidth);
+        evaluate2D(&evaluator, &report);
+    }
+
+    return report;
+}
+
+template<>
+std::vector<PartitionQuality> evaluateAll<3>(
+    const std::vector<int>& rawDimensions,
+    const std::vector<std::size_t>& weights,
+    const std::vector<std::size_t>& nodeIDs,
+    unsigned maxGhostZoneWidth,
+    bool torus)
+{
+    std::vector<PartitionQuality> report;
+    Coord<3> dimensions(rawDimensions[0], rawDimensions[1], rawDimensions[2]);
+
+    if (torus) {
+        PartitionEvaluator<Topologies::Torus<3>::Topology> evaluator(dimensions, weights, nodeIDs, maxGhostZoneWidth);
+        evaluate3D(&evaluator, &report);
+    } else {
+        PartitionEvaluator<Topologies::Cube<3>::Topology> evaluator(dimensions, weights, nodeIDs, maxGhostZoneWidth);
+        evaluate3D(&evaluator, &report);
+    }
+
+    return report;
+}
+
+void usage(const std::string& program)
+{
+    std::cerr << "usage: " << program << " [options]\n"
+              << "  -d, --dimensions X,Y[,Z]    simulation space (default: 1024,1024)\n"
+              << "  -r, --ranks N               number of ranks with equal weights (default: 64)\n"
+              << "  -w, --weights W1,W2,...     explicit weights, overrides --ranks\n"
+              << "  -n, --ranks-per-node N      also evaluate HierarchicalPartition\n"
+              << "  -g, --ghost-zone-width N    evaluate ghost zone widths 1 to N (default: 1)\n"
+              << "  -t, --torus                 use periodic boundary conditions\n"
+              << "  -f, --format csv|json       output format (default: csv)\n";
+}
+
+int main(int argc, char **argv)
+{
+#ifdef LIBGEODECOMP_WITH_MPI
+    // some partitions (e.g. PT-Scotch) require MPI:
+    MPI_Init(&argc, &argv);
+#endif
+
+    std::vector<int> dimensions;
+    dimensions << 1024 << 1024;
+    std::size_t ranks = 64;
+    std::vector<std::size_t> weights;
+    std::size_t ranksPerNode = 0;
+    unsigned maxGhostZoneWidth = 1;
+    bool torus = false;
+    std::string format = "csv";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if ((option == "-t") || (option == "--torus")) {
+            torus = true;
+            continue;
+        }
+        if ((option == "-h") || (option == "--help") || ((i + 1) >= argc)) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        std::string value = argv[++i];
+        if ((option == "-d") || (option == "--dimensions")) {
+            dimensions.clear();
+            StringVec tokens = StringOps::tokenize(value, ",x");
+            for (StringVec::iterator j = tokens.begin(); j != tokens.end(); ++j) {
+                dimensions << StringOps::atoi(*j);
+            }
+        } else if ((option == "-r") || (option == "--ranks")) {
+            ranks = StringOps::atoi(value);
+        } else if ((option == "-w") || (option == "--weights")) {
+            StringVec tokens = StringOps::tokenize(value, ",");
+            for (StringVec::iterator j = tokens.begin(); j != tokens.end(); ++j) {
+                weights << std::size_t(StringOps::atoi(*j));
+            }
+        } else if ((option == "-n") || (option == "--ranks-per-node")) {
+            ranksPerNode = StringOps::atoi(value);
+        } else if ((option == "-g") || (option == "--ghost-zone-width")) {
+            maxGhostZoneWidth = StringOps::atoi(value);
+        } else if ((option == "-f") || (option == "--format")) {
+            format = value;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((dimensions.size() < 2) || (dimensions.size() > 3) || ((format != "csv") && (format != "json"))) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::size_t numCells = 1;
+    for (std::size_t i = 0; i < dimensions.size(); ++i) {
+        numCells *= dimensions[i];
+    }
+
+    // partitions expect the weights to sum up to the number of
+    // cells, so we'll rescale them if necessary:
+    if (weights.empty()) {
+        weights = std::vector<std::size_t>(ranks, 1);
+    }
+    double totalWeight = sum(weights);
+    std::size_t prefix = 0;
+    std::size_t lastBoundary = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        prefix += weights[i];
+        std::size_t boundary = static_cast<std::size_t>(prefix * numCells / totalWeight + 0.5);
+        weights[i] = boundary - lastBoundary;
+        lastBoundary = boundary;
+    }
+
+    std::vector<std::size_t> nodeIDs;
+    if (ranksPerNode > 0) {
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            nodeIDs << i / ranksPerNode;
+        }
+    }
+
+    std::vector<PartitionQuality> report;
+    if (dimensions.size() == 2) {
+        report = evaluateAll<2>(dimensions, weights, nodeIDs, maxGhostZoneWidth, torus);
+    } else {
+        report = evaluateAll<3>(dimensions, weights, nodeIDs, maxGhostZoneWidth, torus);
+    }
+
+    if (format == "csv") {
+        printCSV(report);
+    } else {
+        printJSON(report);
+    }
+
+#ifdef LIBGEODECOMP_WITH_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
@@ -9,6 +9,7 @@
 #include <libgeodecomp/geometry/stencils.h>
 #include <libgeodecomp/geometry/partitions/hindexingpartition.h>
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
 #include <libgeodecomp/storage/grid.h>
@@ -1100,6 +1101,63 @@ public:
     }
 };
 
+class JacobiCellBricked : public JacobiCellClassic
+{
+public:
+    class API :
+        public JacobiCellClassic::API,
+        public APITraits::HasBrickedGrid
+    {};
+
+    explicit JacobiCellBricked(double t = 0) :
+        JacobiCellClassic(t)
+    {}
+};
+
+class Jacobi3DBricked : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "Jacobi3D";
+    }
+
+    std::string species()
+    {
+        return "bricked";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int maxT = 5;
+        SerialSimulator<JacobiCellBricked> sim(
+            new NoOpInitializer<JacobiCellBricked>(dim, maxT));
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            sim.run();
+        }
+
+        if (sim.getGrid()->get(Coord<3>(1, 1, 1)).temp == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        double updates = 1.0 * maxT * dim.prod();
+        double gLUPS = 1e-9 * updates / seconds;
+
+        return gLUPS;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+};
+
 class JacobiCellFixedHood
 {
 public:
@@ -2519,6 +2577,63 @@ public:
     }
 };
 
+class LBMCellBricked : public LBMCell
+{
+public:
+    class API :
+        public LBMCell::API,
+        public APITraits::HasBrickedGrid
+    {};
+
+    inline explicit LBMCellBricked(double v = 1.0, State s = LIQUID) :
+        LBMCell(v, s)
+    {}
+};
+
+class LBMBricked : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "LBM";
+    }
+
+    std::string species()
+    {
+        return "bricked";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int maxT = 20;
+        SerialSimulator<LBMCellBricked> sim(
+            new NoOpInitializer<LBMCellBricked>(dim, maxT));
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            sim.run();
+        }
+
+        if (sim.getGrid()->get(Coord<3>(1, 1, 1)).density == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        double updates = 1.0 * maxT * dim.prod();
+        double gLUPS = 1e-9 * updates / seconds;
+
+        return gLUPS;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+};
+
 class LBMSoA : public CPUBenchmark
 {
 public:
@@ -2563,7 +2678,7 @@ public:
     }
 };
 
-template<class PARTITION>
+template<class PARTITION, int DIM = 2>
 class PartitionBenchmark : public CPUBenchmark
 {
 public:
@@ -2583,22 +2698,26 @@ public:
 
     double performance(std::vector<int> rawDim)
     {
-        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        Coord<DIM> realDim;
+        Coord<DIM> origin;
+        for (int i = 0; i < DIM; ++i) {
+            realDim[i] = rawDim[i];
+            origin[i] = 100 * (i + 1);
+        }
         double duration = 0;
-        Coord<2> accu;
-        Coord<2> realDim(dim.x(), dim.y());
+        Coord<DIM> accu;
 
         {
             ScopedTimer t(&duration);
 
-            PARTITION h(Coord<2>(100, 200), realDim);
+            PARTITION h(origin, realDim);
             typename PARTITION::Iterator end = h.end();
             for (typename PARTITION::Iterator i = h.begin(); i != end; ++i) {
                 accu += *i;
             }
         }
 
-        if (accu == Coord<2>()) {
+        if (accu == Coord<DIM>()) {
             throw std::runtime_error("oops, partition iteration went bad!");
         }
 
@@ -3339,6 +3458,10 @@ int main(int argc, char **argv)
         eval(Jacobi3DClassic(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(Jacobi3DBricked(), toVector(sizes[i]));
+    }
+
     for (std::size_t i = 0; i < sizes.size(); ++i) {
         eval(Jacobi3DFixedHood(), toVector(sizes[i]));
     }
@@ -3365,6 +3488,10 @@ int main(int argc, char **argv)
         eval(LBMClassic(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(LBMBricked(), toVector(sizes[i]));
+    }
+
     for (std::size_t i = 0; i < sizes.size(); ++i) {
         eval(LBMSoA(), toVector(sizes[i]));
     }
@@ -3375,6 +3502,11 @@ int main(int argc, char **argv)
     eval(PartitionBenchmark<HilbertPartition     >("PartitionHilbert"),   dim);
     eval(PartitionBenchmark<ZCurvePartition<2>   >("PartitionZCurve"),    dim);
 
+    dim = toVector(Coord<3>(512, 512, 512));
+    eval(PartitionBenchmark<StripingPartition<3>, 3>("PartitionStriping3D"), dim);
+    eval(PartitionBenchmark<HilbertPartition3D,   3>("PartitionHilbert3D"),  dim);
+    eval(PartitionBenchmark<ZCurvePartition<3>,   3>("PartitionZCurve3D"),   dim);
+
 #ifdef LIBGEODECOMP_WITH_CUDA
     cudaTests(name, revision, cudaDevice);
 #endif
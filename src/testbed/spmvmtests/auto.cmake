@@ -0,0 +1,7 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mmio.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}mmio.h
+)